@@ -0,0 +1,166 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/*****************************************************************************
+ * Filename : sc_flat_hash_bench.cpp
+ *
+ * Description : Benchmark of sc_flat_hash against sc_phash, with pointer
+ *               keys (as in the port manager) and hierarchical name keys
+ *               (as in the object manager), on two mixes:
+ *
+ *                 lookup-heavy  insert N keys, then look each up 20 times
+ *                 insert-heavy  insert N keys, look each up once, then
+ *                               remove them all
+ *
+ *               Prints ns per operation, the best of five runs.
+ *
+ *               Build it as a console program with optimization on,
+ *               with src on the include path and sc_hash.cpp and
+ *               sc_mempool.cpp linked in, e.g.
+ *
+ *                 g++ -O2 -I../src sc_flat_hash_bench.cpp
+ *                     ../src/sc_hash.cpp ../src/sc_mempool.cpp
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sc_hash.h"
+#include "sc_flat_hash.h"
+
+const int N_KEYS = 100000;
+const int LOOKUP_HEAVY_LOOKUPS = 20;
+const int RUNS = 5;
+
+static char* ptr_keys[N_KEYS];
+static const char* name_keys[N_KEYS];
+static long sink;
+
+static double
+seconds()
+{
+  return (double) clock() / CLOCKS_PER_SEC;
+}
+
+// The keys are visited in a scattered order, as a simulation would.
+static inline int
+scatter(int i)
+{
+  return (int) (((long) i * 7919) % N_KEYS);
+}
+
+template< class T, class K >
+static void
+run_mix(T& h, K* keys, int lookups, bool remove)
+{
+  for (int i = 0; i < N_KEYS; ++i)
+    h.insert(keys[i], (long) i);
+  long s = 0;
+  for (int r = 0; r < lookups; ++r)
+    for (int i = 0; i < N_KEYS; ++i)
+      s += h[keys[scatter(i)]];
+  if (remove)
+    for (int i = 0; i < N_KEYS; ++i)
+      h.remove(keys[scatter(i)]);
+  sink += s;
+}
+
+static void
+ptr_phash(int lookups, bool remove)
+{
+  sc_phash<char*, long> h;
+  run_mix(h, ptr_keys, lookups, remove);
+}
+
+static void
+ptr_flat_hash(int lookups, bool remove)
+{
+  sc_flat_hash<char*, long> h;
+  run_mix(h, ptr_keys, lookups, remove);
+}
+
+static void
+name_phash(int lookups, bool remove)
+{
+  sc_phash<const char*, long> h;
+  h.set_hash_fn(default_str_hash_fn);
+  h.set_cmpr_fn((int (*)(const void*, const void*)) strcmp);
+  run_mix(h, name_keys, lookups, remove);
+}
+
+static void
+name_flat_hash(int lookups, bool remove)
+{
+  sc_flat_hash<const char*, long, sc_flat_str_hash_traits> h;
+  run_mix(h, name_keys, lookups, remove);
+}
+
+static double
+best_time(void (*f)(int, bool), int lookups, bool remove)
+{
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    f(lookups, remove);
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  int ops = N_KEYS * (1 + lookups + (remove ? 1 : 0));
+  return best / ops * 1e9;
+}
+
+static void
+run(const char* name, void (*phash)(int, bool), void (*flat)(int, bool))
+{
+  double p = best_time(phash, LOOKUP_HEAVY_LOOKUPS, false);
+  double f = best_time(flat, LOOKUP_HEAVY_LOOKUPS, false);
+  printf("%-14s lookup-heavy  sc_phash %6.1f  sc_flat_hash %6.1f ns/op  x%.2f\n",
+         name, p, f, p / f);
+  p = best_time(phash, 1, true);
+  f = best_time(flat, 1, true);
+  printf("%-14s insert-heavy  sc_phash %6.1f  sc_flat_hash %6.1f ns/op  x%.2f\n",
+         name, p, f, p / f);
+}
+
+int
+main()
+{
+  for (int i = 0; i < N_KEYS; ++i) {
+    ptr_keys[i] = (char*) malloc(48);
+    char* s = (char*) malloc(40);
+    sprintf(s, "top.core%d.alu.sig_%d", i % 64, i);
+    name_keys[i] = s;
+  }
+
+  run("pointer keys", ptr_phash, ptr_flat_hash);
+  run("name keys", name_phash, name_flat_hash);
+
+  printf("(%ld)\n", sink);
+  return 0;
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/*****************************************************************************
+ * Filename : sc_int_range_bench.cpp
+ *
+ * Description : Microbenchmark of sc_int / sc_uint part-selects, as an
+ *               instruction decoder uses them: range assignment with
+ *               variable and constant bounds, field reads, and reversed
+ *               field reads. Prints ns per part-select, the best of
+ *               five runs.
+ *
+ *               Build it as a console program with optimization on,
+ *               with src and src/numeric_bit on the include path and
+ *               the numeric_bit sources linked in, e.g.
+ *
+ *                 g++ -O2 -I../src -I../src/numeric_bit
+ *                     sc_int_range_bench.cpp ../src/numeric_bit/sc_*.cpp
+ *
+ *               Add -mbmi2 (cl: /arch:AVX2) for the bzhi field paths.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+#include "sc_int.h"
+#include "sc_uint.h"
+
+const int N_FIELDS = 4096;
+const int REPS = 2000;
+const int RUNS = 5;
+
+static int left_of[N_FIELDS];
+static int right_of[N_FIELDS];
+static uint64 value_of[N_FIELDS];
+static uint64 sink;
+
+// A fixed xorshift sequence, so that every run sees the same fields.
+static uint64 random_state = 88172645463325252ULL;
+
+static uint64
+next_random()
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 7;
+  random_state ^= random_state << 17;
+  return random_state;
+}
+
+static double
+seconds()
+{
+  return (double) clock() / CLOCKS_PER_SEC;
+}
+
+static void
+variable_range_assign()
+{
+  sc_int<40> a;
+  sc_uint<40> b;
+  for (int r = 0; r < REPS; ++r)
+    for (int i = 0; i < N_FIELDS; ++i) {
+      a.range(left_of[i], right_of[i]) = (int64) value_of[i];
+      b.range(left_of[i], right_of[i]) = value_of[i] + a;
+    }
+  sink += (int64) a + (uint64) b;
+}
+
+static void
+constant_range_assign()
+{
+  sc_int<40> a;
+  sc_uint<40> b;
+  for (int r = 0; r < REPS; ++r)
+    for (int i = 0; i < N_FIELDS; ++i) {
+      a.range(15, 8) = (int64) value_of[i];
+      b.range(31, 12) = value_of[i] + a;
+      a.range(39, 36) = (int64) b;
+    }
+  sink += (int64) a + (uint64) b;
+}
+
+static void
+variable_field_read()
+{
+  sc_int<40> s;
+  sc_uint<40> u;
+  uint64 x = 0;
+  for (int r = 0; r < REPS; ++r)
+    for (int i = 0; i < N_FIELDS; ++i) {
+      u = value_of[i];
+      s = (int64) value_of[i];
+      x += u.range(left_of[i], right_of[i]);
+      x += (uint64) (int64) s.range(left_of[i], right_of[i]);
+    }
+  sink += x;
+}
+
+// The fields of a 32-bit RISC-V instruction word.
+static void
+decoder_field_read()
+{
+  sc_uint<32> u;
+  uint64 x = 0;
+  for (int r = 0; r < REPS; ++r)
+    for (int i = 0; i < N_FIELDS; ++i) {
+      u = value_of[i];
+      x += u.range(6, 0) + u.range(11, 7) + u.range(14, 12) +
+           u.range(19, 15) + u.range(24, 20) + u.range(31, 25);
+    }
+  sink += x;
+}
+
+static void
+reversed_field_read()
+{
+  sc_uint<40> u;
+  uint64 x = 0;
+  for (int r = 0; r < REPS; ++r)
+    for (int i = 0; i < N_FIELDS; ++i) {
+      u = value_of[i];
+      x += u.range(right_of[i], left_of[i]);
+    }
+  sink += x;
+}
+
+static void
+run(const char *name, void (*f)(), int ops_per_field)
+{
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    f();
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  printf("%-24s %6.2f ns/op\n", name,
+         best / ((double) REPS * N_FIELDS * ops_per_field) * 1e9);
+}
+
+int
+main()
+{
+  for (int i = 0; i < N_FIELDS; ++i) {
+    int a = (int) (next_random() % 40);
+    int b = (int) (next_random() % 40);
+    left_of[i] = (a > b) ? a : b;
+    right_of[i] = (a > b) ? b : a;
+    value_of[i] = next_random();
+  }
+
+  run("variable range assign", variable_range_assign, 2);
+  run("constant range assign", constant_range_assign, 3);
+  run("variable field read", variable_field_read, 2);
+  run("decoder field read", decoder_field_read, 6);
+  run("reversed field read", reversed_field_read, 1);
+
+  printf("(%llu)\n", (unsigned long long) sink);
+  return 0;
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/*****************************************************************************
+ * Filename : sc_modulus_bench.cpp
+ *
+ * Description : Benchmark of repeated reduction by the same modulus, as a
+ *               modular multiplier model does it:
+ *
+ *                 acc = (acc * x) % p;    // % on sc_unsigned
+ *                 acc = (acc * x) % m;    // m is an sc_modulus of p
+ *
+ *               for moduli of 128 to 8192 bits. Prints us per modular
+ *               multiplication, the best of five runs, and checks that
+ *               both give the same results.
+ *
+ *               Moduli whose products do not fit in MAX_NBITS in
+ *               sc_constants.h are skipped; undefine it to run all of
+ *               them.
+ *
+ *               Build it as a console program with optimization on,
+ *               with src and src/numeric_bit on the include path and
+ *               the numeric_bit sources linked in, e.g.
+ *
+ *                 g++ -O2 -I../src -I../src/numeric_bit
+ *                     sc_modulus_bench.cpp ../src/numeric_bit/sc_*.cpp
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+#include "sc_unsigned.h"
+#include "sc_modulus.h"
+
+const int RUNS = 5;
+
+// A fixed xorshift sequence, so that every run sees the same values.
+static unsigned random_state = 2463534242U;
+
+static unsigned
+next_random()
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+static double
+seconds()
+{
+  return (double) clock() / CLOCKS_PER_SEC;
+}
+
+static void
+fill(sc_unsigned& u, int nbits)
+{
+  u = 0;
+  for (int j = 0; j < nbits; j += 32) {
+    u <<= 32;
+    u += (unsigned long) next_random();
+  }
+}
+
+// Each run starts from the same acc, so that the results compare.
+template< class M >
+static double
+time_mod_mul(sc_unsigned& acc, const sc_unsigned& start,
+             const sc_unsigned& x, const M& mod, int reps)
+{
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    acc = start;
+    double t = seconds();
+    for (int r = 0; r < reps; ++r)
+      acc = (acc * x) % mod;
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  return best / reps * 1e6;
+}
+
+int
+main()
+{
+  static const int widths[] = { 128, 240, 512, 1024, 2048, 4096, 8192 };
+  const int n_widths = sizeof(widths) / sizeof(widths[0]);
+  for (int i = 0; i < n_widths; ++i) {
+    int nbits = widths[i];
+#ifdef MAX_NBITS
+    if (2 * nbits > MAX_NBITS) {
+      printf("%5d bits skipped: MAX_NBITS is %d\n", nbits, MAX_NBITS);
+      continue;
+    }
+#endif
+    sc_unsigned p(nbits);
+    sc_unsigned x(nbits);
+    sc_unsigned start(nbits);
+    fill(p, nbits);
+    fill(x, nbits);
+    fill(start, nbits);
+    p[nbits - 1] = 1;   // A full-width, odd modulus.
+    p[0] = 1;
+    x %= p;
+    start %= p;
+
+    sc_modulus m(p);
+    sc_unsigned plain(nbits);
+    sc_unsigned reused(nbits);
+    int reps = 200000000 / (nbits * (nbits / 64 + 8)) + 1;
+    double t_plain = time_mod_mul(plain, start, x, p, reps);
+    double t_reused = time_mod_mul(reused, start, x, m, reps);
+    printf("%5d bits  %% p %8.3f us  %% sc_modulus %8.3f us  x%.2f\n",
+           nbits, t_plain, t_reused, t_plain / t_reused);
+    if (plain != reused) {
+      printf("sc_modulus differs from %%\n");
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,156 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/*****************************************************************************
+ * Filename : sc_radix_bench.cpp
+ *
+ * Description : Benchmark of sc_unsigned radix conversion from 64 to 16384
+ *               bits: to_string() and assignment from a string, in
+ *               decimal, which is done by divide and conquer above a
+ *               threshold, and in hexadecimal, which is done by slicing
+ *               bits. Prints us per conversion, the best of five runs,
+ *               and checks that every string converts back to the same
+ *               number.
+ *
+ *               Widths above MAX_NBITS in sc_constants.h are skipped;
+ *               undefine it to run all of them.
+ *
+ *               Build it as a console program with optimization on,
+ *               with src and src/numeric_bit on the include path and
+ *               the numeric_bit sources and src/sc_string.cpp linked
+ *               in, e.g.
+ *
+ *                 g++ -O2 -I../src -I../src/numeric_bit sc_radix_bench.cpp
+ *                     ../src/numeric_bit/sc_*.cpp ../src/sc_string.cpp
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+#include "sc_string.h"
+#include "sc_unsigned.h"
+
+const int RUNS = 5;
+
+static unsigned sink;
+
+// A fixed xorshift sequence, so that every run sees the same values.
+static unsigned random_state = 2463534242U;
+
+static unsigned
+next_random()
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+static double
+seconds()
+{
+  return (double) clock() / CLOCKS_PER_SEC;
+}
+
+static double
+time_to_string(const sc_unsigned& u, sc_numrep base, int reps)
+{
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    for (int r = 0; r < reps; ++r)
+      sink += u.to_string(base, true).length();
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  return best / reps * 1e6;
+}
+
+static double
+time_from_string(sc_unsigned& v, const char* s, int reps)
+{
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    for (int r = 0; r < reps; ++r) {
+      v = s;
+      sink += (unsigned) v.test(0);
+    }
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  return best / reps * 1e6;
+}
+
+// Time both directions in one base, and check the round trip. The
+// strings are formatted, with a 0d or 0x prefix, so that assignment
+// reads them in the same base.
+static bool
+run(const char* name, const sc_unsigned& u, sc_numrep base, int reps)
+{
+  sc_string s = u.to_string(base, true);
+  sc_unsigned v(u.length());
+  double to = time_to_string(u, base, reps);
+  double from = time_from_string(v, s, reps);
+  printf("%6d bits %-4s to_string %10.2f us  from string %10.2f us\n",
+         u.length(), name, to, from);
+  if (v != u) {
+    printf("%s string does not convert back\n", name);
+    return false;
+  }
+  return true;
+}
+
+int
+main()
+{
+  static const int widths[] = { 64, 256, 1024, 4096, 16384 };
+  const int n_widths = sizeof(widths) / sizeof(widths[0]);
+  for (int i = 0; i < n_widths; ++i) {
+    int nbits = widths[i];
+#ifdef MAX_NBITS
+    if (nbits > MAX_NBITS) {
+      printf("%6d bits skipped: MAX_NBITS is %d\n", nbits, MAX_NBITS);
+      continue;
+    }
+#endif
+    sc_unsigned u(nbits);
+    u = 0;
+    for (int j = 0; j < nbits; j += 32) {
+      u <<= 32;
+      u += (unsigned long) next_random();
+    }
+
+    int reps = 20000000 / (nbits * (nbits / 64 + 8)) + 1;
+    if (! run("dec", u, SC_DEC, reps) || ! run("hex", u, SC_HEX, reps))
+      return 1;
+  }
+
+  printf("(%u)\n", sink);
+  return 0;
+}
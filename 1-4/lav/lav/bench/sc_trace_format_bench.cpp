@@ -0,0 +1,175 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/*****************************************************************************
+ * Filename : sc_trace_format_bench.cpp
+ *
+ * Description : Benchmark of formatting traced sc_unsigned and sc_signed
+ *               values of 64, 512 and 4096 bits as bit strings, as the
+ *               VCD and WIF writers do: one bit at a time through
+ *               operator[], as they used to, and a word at a time with
+ *               get_bin_chars(). The signed values are negative, which
+ *               made every operator[] complement the whole number.
+ *               Prints ns per value, the best of five runs, and checks
+ *               that both give the same string.
+ *
+ *               Widths above MAX_NBITS in sc_constants.h are skipped;
+ *               undefine it to run all of them.
+ *
+ *               Build it as a console program with optimization on,
+ *               with src and src/numeric_bit on the include path and
+ *               the numeric_bit sources linked in, e.g.
+ *
+ *                 g++ -O2 -I../src -I../src/numeric_bit
+ *                     sc_trace_format_bench.cpp ../src/numeric_bit/sc_*.cpp
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "sc_unsigned.h"
+#include "sc_signed.h"
+
+const int RUNS = 5;
+
+static char per_bit_buf[4096 + 1];
+static char word_buf[4096 + 1];
+static unsigned sink;
+
+// A fixed xorshift sequence, so that every run sees the same values.
+static unsigned random_state = 2463534242U;
+
+static unsigned
+next_random()
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+static double
+seconds()
+{
+  return (double) clock() / CLOCKS_PER_SEC;
+}
+
+// The formatting of the trace writers before get_bin_chars().
+template< class T >
+static void
+per_bit_chars(const T& object, char* buf)
+{
+  char* p = buf;
+  for (int bitindex = object.length() - 1; bitindex >= 0; --bitindex)
+    *p++ = "01"[object[bitindex]];
+  *p = '\0';
+}
+
+template< class T >
+static double
+time_per_bit(const T& object, int reps)
+{
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    for (int r = 0; r < reps; ++r) {
+      per_bit_chars(object, per_bit_buf);
+      sink += per_bit_buf[r % object.length()];
+    }
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  return best / reps * 1e9;
+}
+
+template< class T >
+static double
+time_word(const T& object, int reps)
+{
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    for (int r = 0; r < reps; ++r) {
+      object.get_bin_chars(word_buf);
+      sink += word_buf[r % object.length()];
+    }
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  word_buf[object.length()] = '\0';
+  return best / reps * 1e9;
+}
+
+template< class T >
+static bool
+run(const char* name, const T& object)
+{
+  int reps = 4000000 / object.length();
+  double per_bit = time_per_bit(object, reps);
+  double word = time_word(object, reps);
+  printf("%5d-bit %-11s per bit %10.0f ns  word-level %8.0f ns  x%.1f\n",
+         object.length(), name, per_bit, word, per_bit / word);
+  if (strcmp(per_bit_buf, word_buf) != 0) {
+    printf("get_bin_chars() differs from operator[]\n");
+    return false;
+  }
+  return true;
+}
+
+int
+main()
+{
+  static const int widths[] = { 64, 512, 4096 };
+  const int n_widths = sizeof(widths) / sizeof(widths[0]);
+  for (int i = 0; i < n_widths; ++i) {
+    int nbits = widths[i];
+#ifdef MAX_NBITS
+    if (nbits > MAX_NBITS) {
+      printf("%5d-bit skipped: MAX_NBITS is %d\n", nbits, MAX_NBITS);
+      continue;
+    }
+#endif
+    sc_unsigned u(nbits);
+    sc_signed s(nbits);
+    u = 0;
+    for (int j = 0; j < nbits; j += 32) {
+      u <<= 32;
+      u += (unsigned long) next_random();
+    }
+    s = u;
+    if (s > 0)
+      s = -s;
+
+    if (! run("sc_unsigned", u) || ! run("sc_signed <0", s))
+      return 1;
+  }
+
+  printf("(%u)\n", sink);
+  return 0;
+}
@@ -0,0 +1,120 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/*****************************************************************************
+ * Filename : sc_vcd_bench.cpp
+ *
+ * Description : Benchmark of VCD tracing. Traces 256 32-bit integers,
+ *               all of which change every cycle, and 64 bools, which
+ *               change at random, and runs 100000 cycles with
+ *               sc_cycle(). Prints the throughput of the trace file in
+ *               MB/s and in values/s, from the first cycle until the
+ *               file is closed.
+ *
+ *               Build it in place of main.cpp, with the sources of
+ *               lav.vcxproj, which provide main() and call sc_main().
+ *               vcd_bench.vcd is left in the working directory.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+#include "systemc.h"
+
+const int N_INTS = 256;
+const int N_BOOLS = 64;
+const int CYCLES = 100000;
+
+static unsigned ints[N_INTS];
+static bool bools[N_BOOLS];
+
+// A fixed xorshift sequence, so that every run writes the same file.
+static unsigned random_state = 2463534242U;
+
+static unsigned
+next_random()
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+static double
+seconds()
+{
+  return (double) clock() / CLOCKS_PER_SEC;
+}
+
+static long
+file_size(const char* name)
+{
+  FILE* fp = fopen(name, "rb");
+  if (fp == 0)
+    return 0;
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fclose(fp);
+  return size;
+}
+
+int
+sc_main(int ac, char* av[])
+{
+  sc_trace_file* tf = sc_create_vcd_trace_file("vcd_bench");
+  char name[32];
+  for (int i = 0; i < N_INTS; ++i) {
+    sprintf(name, "int%d", i);
+    sc_trace(tf, ints[i], name);
+  }
+  for (int i = 0; i < N_BOOLS; ++i) {
+    sprintf(name, "bool%d", i);
+    sc_trace(tf, bools[i], name);
+  }
+
+  sc_initialize();
+
+  double values = 0;
+  double t = seconds();
+  for (int c = 0; c < CYCLES; ++c) {
+    for (int i = 0; i < N_INTS; ++i)
+      ints[i] += next_random() | 1;
+    for (int i = 0; i < N_BOOLS; ++i)
+      if (next_random() & 1) {
+        bools[i] = ! bools[i];
+        ++values;
+      }
+    values += N_INTS;
+    sc_cycle(10);
+  }
+  sc_close_vcd_trace_file(tf);
+  t = seconds() - t;
+
+  double mb = file_size("vcd_bench.vcd") / 1e6;
+  printf("%.1f MB, %.0f values in %.2f s: %.1f MB/s, %.2f M values/s\n",
+         mb, values, t, mb / t, values / t / 1e6);
+  return 0;
+}
@@ -0,0 +1,243 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/*****************************************************************************
+ * Filename : vec_mul_bench.cpp
+ *
+ * Description : Randomized cross-check and benchmark of vec_mul(), which
+ *               dispatches to Karatsuba and Toom-3, against the schoolbook
+ *               vec_mul_basecase(). The check multiplies operands of
+ *               random, unequal lengths up to 600 digits, including all-
+ *               ones and mostly-zero digits, and exits with 1 on the
+ *               first difference. The benchmark then prints the time of
+ *               both for squares of 512 to 16384 bits, the best of five
+ *               runs.
+ *
+ *               vec_mul() works on digit vectors of any length, so this
+ *               runs in the default configuration. sc_signed and
+ *               sc_unsigned reach the fast kernels only with operands of
+ *               at least VEC_MUL_KARATSUBA_THRESHOLD digits, which
+ *               MAX_NBITS in sc_constants.h does not allow; their
+ *               operator* is timed too when MAX_NBITS is not defined.
+ *
+ *               Build it as a console program with optimization on,
+ *               with src and src/numeric_bit on the include path and
+ *               the numeric_bit sources linked in, e.g.
+ *
+ *                 g++ -O2 -I../src -I../src/numeric_bit
+ *                     vec_mul_bench.cpp ../src/numeric_bit/sc_*.cpp
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "sc_nbutils.h"
+#include "sc_unsigned.h"
+
+const int CHECKS = 3000;
+const length_type CHECK_MAX_DIGITS = 600;
+const int RUNS = 5;
+
+// A fixed xorshift sequence, so that every run sees the same operands.
+static uint64 random_state = 88172645463325252ULL;
+
+static uint64
+next_random()
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 7;
+  random_state ^= random_state << 17;
+  return random_state;
+}
+
+static digit_type
+random_digit()
+{
+  return (digit_type) next_random() & DIGIT_MASK;
+}
+
+static double
+seconds()
+{
+  return (double) clock() / CLOCKS_PER_SEC;
+}
+
+// Fill u with ulen digits: random ones, all ones, or mostly zeros.
+static void
+fill(length_type ulen, digit_type *u, int mode)
+{
+  for (length_type i = 0; i < ulen; ++i) {
+    if (mode == 1)
+      u[i] = DIGIT_MASK;
+    else if ((mode == 2) && (next_random() % 3 != 0))
+      u[i] = 0;
+    else
+      u[i] = random_digit();
+  }
+}
+
+static bool
+check()
+{
+  for (int k = 0; k < CHECKS; ++k) {
+    length_type ulen = 1 + (length_type) (next_random() % CHECK_MAX_DIGITS);
+    length_type vlen = 1 + (length_type) (next_random() % CHECK_MAX_DIGITS);
+    if (ulen < vlen) {
+      length_type t = ulen;
+      ulen = vlen;
+      vlen = t;
+    }
+    // Every other case, multiply operands of the same length, which
+    // go to the kernels whole.
+    if (k % 2 == 0)
+      vlen = ulen;
+
+    digit_type *u = new digit_type[ulen];
+    digit_type *v = new digit_type[vlen];
+    digit_type *expect = new digit_type[ulen + vlen];
+    digit_type *w = new digit_type[ulen + vlen];
+
+    int mode = (int) (next_random() % 4);
+    fill(ulen, u, mode);
+    fill(vlen, v, mode);
+    vec_zero(ulen + vlen, expect);
+    vec_zero(ulen + vlen, w);
+    vec_mul_basecase(ulen, u, vlen, v, expect);
+    vec_mul(ulen, u, vlen, v, w);
+
+    bool same = (memcmp(expect, w, (ulen + vlen) * sizeof(digit_type)) == 0);
+    delete [] u;
+    delete [] v;
+    delete [] expect;
+    delete [] w;
+
+    if (! same) {
+      printf("vec_mul differs from vec_mul_basecase: ulen = %d, vlen = %d\n",
+             ulen, vlen);
+      return false;
+    }
+  }
+  printf("cross-check: %d products agree\n", CHECKS);
+  return true;
+}
+
+static void
+time_vec_mul(int nbits)
+{
+  length_type n = DIV_CEIL(nbits);
+  digit_type *u = new digit_type[n];
+  digit_type *v = new digit_type[n];
+  digit_type *w = new digit_type[2 * n];
+  fill(n, u, 0);
+  fill(n, v, 0);
+
+  int reps = 2000000 / (n * n) + 1;
+  double best_basecase = 0;
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    for (int r = 0; r < reps; ++r) {
+      vec_zero(2 * n, w);
+      vec_mul_basecase(n, u, n, v, w);
+    }
+    t = seconds() - t;
+    if ((k == 0) || (t < best_basecase))
+      best_basecase = t;
+
+    t = seconds();
+    for (int r = 0; r < reps; ++r) {
+      vec_zero(2 * n, w);
+      vec_mul(n, u, n, v, w);
+    }
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  printf("%6d bits %5d digits  basecase %10.2f us  vec_mul %10.2f us  x%.2f\n",
+         nbits, n, best_basecase / reps * 1e6, best / reps * 1e6,
+         best_basecase / best);
+
+  delete [] u;
+  delete [] v;
+  delete [] w;
+}
+
+#ifndef MAX_NBITS
+static void
+time_operator_mul(int nbits)
+{
+  sc_unsigned a(nbits);
+  sc_unsigned b(nbits);
+  sc_unsigned p(2 * nbits);
+  a = 0;
+  b = 0;
+  for (int i = 0; i < nbits; i += 32) {
+    a <<= 32;
+    a += (unsigned long) (next_random() & 0xffffffffUL);
+    b <<= 32;
+    b += (unsigned long) (next_random() & 0xffffffffUL);
+  }
+
+  length_type n = DIV_CEIL(nbits);
+  int reps = 2000000 / (n * n) + 1;
+  double best = 0;
+  for (int k = 0; k < RUNS; ++k) {
+    double t = seconds();
+    for (int r = 0; r < reps; ++r)
+      p = a * b;
+    t = seconds() - t;
+    if ((k == 0) || (t < best))
+      best = t;
+  }
+  printf("%6d bits  sc_unsigned operator* %10.2f us\n",
+         nbits, best / reps * 1e6);
+}
+#endif
+
+int
+main()
+{
+  if (! check())
+    return 1;
+
+  printf("Karatsuba from %d digits, Toom-3 from %d digits of %d bits\n",
+         VEC_MUL_KARATSUBA_THRESHOLD, VEC_MUL_TOOM3_THRESHOLD,
+         (int) BITS_PER_DIGIT);
+
+  static const int sizes[] = { 512, 1024, 2048, 4096, 8192, 16384 };
+  const int n_sizes = sizeof(sizes) / sizeof(sizes[0]);
+  for (int i = 0; i < n_sizes; ++i)
+    time_vec_mul(sizes[i]);
+
+#ifndef MAX_NBITS
+  for (int i = 0; i < n_sizes; ++i)
+    time_operator_mul(sizes[i]);
+#else
+  printf("sc_unsigned operator* not timed: MAX_NBITS is %d\n", MAX_NBITS);
+#endif
+  return 0;
+}
@@ -45,8 +45,8 @@
 #include "sc_simcontext.h"
 #endif
 
-#ifndef   SC_HASH_H
-#include "sc_hash.h"
+#ifndef   SC_FLAT_HASH_H
+#include "sc_flat_hash.h"
 #endif
 
 
@@ -86,7 +86,7 @@ private:
 
     static sc_global<T>* _instance;
 
-    sc_phash<const sc_process_b*,const T*> _map;
+    sc_flat_hash<const sc_process_b*,const T*> _map;
     const sc_process_b*                    _proc;
     const T*                               _value_ptr;
 
@@ -59,6 +59,7 @@
 
 class sc_fxnum_observer;
 class sc_fxnum_fast_observer;
+template <class T> class sc_trace_value;
 
 
 // ----------------------------------------------------------------------------
@@ -73,9 +74,7 @@ class sc_fxnum
     friend class sc_fxnum_bitref;
     friend class sc_fxnum_subref;
 
-    friend class isdb_sc_fxnum_trace;
-    friend class vcd_sc_fxnum_trace;
-    friend class wif_sc_fxnum_trace;
+    friend class sc_trace_value<sc_fxnum>;
 
 protected:
 
@@ -434,9 +433,7 @@ class sc_fxnum_fast
     friend class sc_fxnum_fast_bitref;
     friend class sc_fxnum_fast_subref;
 
-    friend class isdb_sc_fxnum_fast_trace;
-    friend class vcd_sc_fxnum_fast_trace;
-    friend class wif_sc_fxnum_fast_trace;
+    friend class sc_trace_value<sc_fxnum_fast>;
 
 protected:
 
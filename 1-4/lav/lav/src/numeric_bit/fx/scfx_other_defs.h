@@ -105,7 +105,7 @@ sc_bigint<W>::operator = ( const sc_fxnum_fast& v )
 template <int W>
 inline
 sc_bigint<W>::sc_bigint( const sc_fxval& v )
-: sc_signed( W )
+: SC_BIGINT_BASE
 {
     *this = v;
 }
@@ -113,7 +113,7 @@ sc_bigint<W>::sc_bigint( const sc_fxval& v )
 template <int W>
 inline
 sc_bigint<W>::sc_bigint( const sc_fxval_fast& v )
-: sc_signed( W )
+: SC_BIGINT_BASE
 {
     *this = v;
 }
@@ -121,7 +121,7 @@ sc_bigint<W>::sc_bigint( const sc_fxval_fast& v )
 template <int W>
 inline
 sc_bigint<W>::sc_bigint( const sc_fxnum& v )
-: sc_signed( W )
+: SC_BIGINT_BASE
 {
     *this = v;
 }
@@ -129,7 +129,7 @@ sc_bigint<W>::sc_bigint( const sc_fxnum& v )
 template <int W>
 inline
 sc_bigint<W>::sc_bigint( const sc_fxnum_fast& v )
-: sc_signed( W )
+: SC_BIGINT_BASE
 {
     *this = v;
 }
@@ -183,7 +183,7 @@ sc_biguint<W>::operator = ( const sc_fxnum_fast& v )
 template <int W>
 inline
 sc_biguint<W>::sc_biguint( const sc_fxval& v )
-: sc_unsigned( W )
+: SC_BIGUINT_BASE
 {
     *this = v;
 }
@@ -191,7 +191,7 @@ sc_biguint<W>::sc_biguint( const sc_fxval& v )
 template <int W>
 inline
 sc_biguint<W>::sc_biguint( const sc_fxval_fast& v )
-: sc_unsigned( W )
+: SC_BIGUINT_BASE
 {
     *this = v;
 }
@@ -199,7 +199,7 @@ sc_biguint<W>::sc_biguint( const sc_fxval_fast& v )
 template <int W>
 inline
 sc_biguint<W>::sc_biguint( const sc_fxnum& v )
-: sc_unsigned( W )
+: SC_BIGUINT_BASE
 {
     *this = v;
 }
@@ -207,7 +207,7 @@ sc_biguint<W>::sc_biguint( const sc_fxnum& v )
 template <int W>
 inline
 sc_biguint<W>::sc_biguint( const sc_fxnum_fast& v )
-: sc_unsigned( W )
+: SC_BIGUINT_BASE
 {
     *this = v;
 }
@@ -218,9 +218,9 @@ sc_biguint<W>::sc_biguint( const sc_fxnum_fast& v )
 // ----------------------------------------------------------------------------
 
 #ifndef _32BIT_
-#define NUM_WIDTH LLWIDTH
+#define NUM_SIGN_EXTEND sign_extend64
 #else
-#define NUM_WIDTH INTWIDTH
+#define NUM_SIGN_EXTEND sign_extend32
 #endif
 
 
@@ -241,8 +241,7 @@ sc_int_base::operator = ( const sc_fxval& v )
     for( int i = 0; i < width; ++ i )
 	set( i, v.get_bit( i ) );
 
-    int S = NUM_WIDTH - width;
-    num = num << S >> S;
+    num = NUM_SIGN_EXTEND( num, width );
 
     return *this;
 }
@@ -262,8 +261,7 @@ sc_int_base::operator = ( const sc_fxval_fast& v )
     for( int i = 0; i < width; ++ i )
 	set( i, v.get_bit( i ) );
 
-    int S = NUM_WIDTH - width;
-    num = num << S >> S;
+    num = NUM_SIGN_EXTEND( num, width );
 
     return *this;
 }
@@ -283,8 +281,7 @@ sc_int_base::operator = ( const sc_fxnum& v )
     for( int i = 0; i < width; ++ i )
 	set( i, v.value().get_bit( i ) );
 
-    int S = NUM_WIDTH - width;
-    num = num << S >> S;
+    num = NUM_SIGN_EXTEND( num, width );
 
     return *this;
 }
@@ -304,13 +301,12 @@ sc_int_base::operator = ( const sc_fxnum_fast& v )
     for( int i = 0; i < width; ++ i )
 	set( i, v.value().get_bit( i ) );
 
-    int S = NUM_WIDTH - width;
-    num = num << S >> S;
+    num = NUM_SIGN_EXTEND( num, width );
 
     return *this;
 }
 
-#undef NUM_WIDTH
+#undef NUM_SIGN_EXTEND
 
 
 // ----------------------------------------------------------------------------
@@ -42,6 +42,7 @@
 #include "sc_signed.h"
 #include "sc_bigint.h"
 #include "sc_biguint.h"
+#include "sc_modulus.h"
 #include "sc_int.h"
 #include "sc_uint.h"
 #ifdef SC_INCLUDE_FX
@@ -53,6 +53,13 @@ namespace sc_bv_ns
 using sc_bv_ns::sc_bv;
 using sc_bv_ns::sc_lv;
 
+// The base class is given the digits of the object, if it has them.
+#ifdef MAX_NBITS
+#define SC_BIGINT_BASE sc_signed(W)
+#else
+#define SC_BIGINT_BASE sc_signed(W, fixed_digit)
+#endif
+
 #ifdef MAX_NBITS
 template< int W = MAX_NBITS >
 #else
@@ -62,33 +69,33 @@ class sc_bigint : public sc_signed {
 
 public:
 
-  sc_bigint() : sc_signed(W)                            { }
+  sc_bigint() : SC_BIGINT_BASE                            { }
 
-  sc_bigint(const sc_bigint<W>&       v) : sc_signed(W) { *this = v; }
+  sc_bigint(const sc_bigint<W>&       v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(const sc_signed&          v) : sc_signed(W) { *this = v; }
+  sc_bigint(const sc_signed&          v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(const sc_signed_subref&   v) : sc_signed(W) { *this = v; }
+  sc_bigint(const sc_signed_subref&   v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(const sc_unsigned&        v) : sc_signed(W) { *this = v; }
+  sc_bigint(const sc_unsigned&        v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(const sc_unsigned_subref& v) : sc_signed(W) { *this = v; }
+  sc_bigint(const sc_unsigned_subref& v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(const char*               v) : sc_signed(W) { *this = v; }
+  sc_bigint(const char*               v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(int64                     v) : sc_signed(W) { *this = v; }
+  sc_bigint(int64                     v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(uint64                    v) : sc_signed(W) { *this = v; }
+  sc_bigint(uint64                    v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(long                      v) : sc_signed(W) { *this = v; }
+  sc_bigint(long                      v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(unsigned long             v) : sc_signed(W) { *this = v; }
+  sc_bigint(unsigned long             v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(int                       v) : sc_signed(W) { *this = v; } 
+  sc_bigint(int                       v) : SC_BIGINT_BASE { *this = v; } 
 
-  sc_bigint(unsigned int              v) : sc_signed(W) { *this = v; } 
+  sc_bigint(unsigned int              v) : SC_BIGINT_BASE { *this = v; } 
 
-  sc_bigint(double                    v) : sc_signed(W) { *this = v; }
+  sc_bigint(double                    v) : SC_BIGINT_BASE { *this = v; }
 
 #ifdef SC_INCLUDE_FX
   explicit sc_bigint( const sc_fxval& );
@@ -102,18 +109,19 @@ public:
 
 #ifdef SC_LOGIC_VECTOR_H
 
-  sc_bigint(const sc_logic_vector&    v) : sc_signed(W) { *this = v; }
+  sc_bigint(const sc_logic_vector&    v) : SC_BIGINT_BASE { *this = v; }
 
-  sc_bigint(const sc_bool_vector&     v) : sc_signed(W) { *this = v; }
+  sc_bigint(const sc_bool_vector&     v) : SC_BIGINT_BASE { *this = v; }
 
 #endif
 
 #ifndef MAX_NBITS
-  ~sc_bigint() { }
+  // fixed_digit is not to be freed by ~sc_signed().
+  ~sc_bigint() { digit = small_digit; }
 #endif
  
   sc_bigint<W>& operator=(const sc_bigint<W>&       v)
-  { sc_signed::operator=(v); return *this; }
+  { sgn = v.sgn; vec_fixed<N>::copy(digit, v.digit); return *this; }
 
   sc_bigint<W>& operator=(const sc_signed&          v)
   { sc_signed::operator=(v); return *this; }
@@ -172,12 +180,109 @@ public:
 
 #endif
 
+  // Operators on two numbers of this width work on the N digits of
+  // their 2's complement, in loops with a constant trip count. Other
+  // operands are handled by sc_signed.
+
+  using sc_signed::operator+=;
+  using sc_signed::operator-=;
+  using sc_signed::operator&=;
+  using sc_signed::operator|=;
+  using sc_signed::operator^=;
+
+  sc_bigint<W>& operator+=(const sc_bigint<W>& v)
+  {
+    digit_type d[N];
+    to_2C(v.sgn, v.digit, d);
+    to_2C(sgn, digit, digit);
+    vec_fixed<N>::add_on(digit, d);
+    return from_2C();
+  }
+
+  sc_bigint<W>& operator-=(const sc_bigint<W>& v)
+  {
+    digit_type d[N];
+    to_2C(v.sgn, v.digit, d);
+    to_2C(sgn, digit, digit);
+    vec_fixed<N>::sub_on(digit, d);
+    return from_2C();
+  }
+
+  sc_bigint<W>& operator&=(const sc_bigint<W>& v)
+  {
+    digit_type d[N];
+    to_2C(v.sgn, v.digit, d);
+    to_2C(sgn, digit, digit);
+    vec_fixed<N>::and_on(digit, d);
+    return from_2C();
+  }
+
+  sc_bigint<W>& operator|=(const sc_bigint<W>& v)
+  {
+    digit_type d[N];
+    to_2C(v.sgn, v.digit, d);
+    to_2C(sgn, digit, digit);
+    vec_fixed<N>::or_on(digit, d);
+    return from_2C();
+  }
+
+  sc_bigint<W>& operator^=(const sc_bigint<W>& v)
+  {
+    digit_type d[N];
+    to_2C(v.sgn, v.digit, d);
+    to_2C(sgn, digit, digit);
+    vec_fixed<N>::xor_on(digit, d);
+    return from_2C();
+  }
+
+private:
+
+  // Number of digits, and the bits of the last one that are in the
+  // number.
+  enum { N = DIV_CEIL(W) };
+
+  static digit_type top_mask()
+    { return DIGIT_MASK >> (N * BITS_PER_DIGIT - W); }
+
+  // d = the 2's complement of the number with sign s and digits u.
+  static void to_2C(small_type s, const digit_type *u, digit_type *d)
+  {
+    if (s == SC_ZERO)
+      vec_fixed<N>::zero(d);
+    else {
+      if (d != u)
+        vec_fixed<N>::copy(d, u);
+      if (s == SC_NEG)
+        vec_fixed<N>::complement(d);
+    }
+  }
+
+  // Convert the digits from 2's complement of W bits back to
+  // sign-magnitude.
+  sc_bigint<W>& from_2C()
+  {
+    digit[N - 1] &= top_mask();
+    if (digit[N - 1] >> ((W - 1) % BITS_PER_DIGIT)) {
+      vec_fixed<N>::complement(digit);
+      digit[N - 1] &= top_mask();
+      sgn = SC_NEG;
+    }
+    else
+      sgn = (vec_fixed<N>::is_zero(digit) ? SC_ZERO : SC_POS);
+    return *this;
+  }
+
+#ifndef MAX_NBITS
+  digit_type fixed_digit[N];
+#endif
+
 };
 
 // Implementation of sc_bv and sc_lv parts.
 
 template<int W> 
 sc_bigint<W>::sc_bigint( const sc_bv<W>& v)
+  : SC_BIGINT_BASE
 {
   for( int i = W-1; i >= 0; i-- )
     set( i, v[i]);
@@ -185,6 +290,7 @@ sc_bigint<W>::sc_bigint( const sc_bv<W>& v)
 
 template<int W> 
 sc_bigint<W>::sc_bigint( const sc_lv<W>& v )
+  : SC_BIGINT_BASE
 {
   for( int i = W-1; i >= 0; i-- ){
     if( v[i] > 1 )
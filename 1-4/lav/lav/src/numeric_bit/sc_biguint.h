@@ -53,6 +53,13 @@ template<int W> class sc_lv;
 using sc_bv_ns::sc_bv;
 using sc_bv_ns::sc_lv;
 
+// The base class is given the digits of the object, if it has them.
+#ifdef MAX_NBITS
+#define SC_BIGUINT_BASE sc_unsigned(W)
+#else
+#define SC_BIGUINT_BASE sc_unsigned(W, fixed_digit)
+#endif
+
 #ifdef MAX_NBITS
 template< int W = MAX_NBITS >
 #else
@@ -62,33 +69,33 @@ class sc_biguint : public sc_unsigned {
 
 public:
 
-  sc_biguint() : sc_unsigned(W)                            { }
+  sc_biguint() : SC_BIGUINT_BASE                            { }
 
-  sc_biguint(const sc_biguint<W>&      v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(const sc_biguint<W>&      v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(const sc_unsigned&        v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(const sc_unsigned&        v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(const sc_unsigned_subref& v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(const sc_unsigned_subref& v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(const sc_signed&          v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(const sc_signed&          v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(const sc_signed_subref&   v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(const sc_signed_subref&   v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(const char*               v) : sc_unsigned(W) { *this = v; } 
+  sc_biguint(const char*               v) : SC_BIGUINT_BASE { *this = v; } 
 
-  sc_biguint(int64                     v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(int64                     v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(uint64                    v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(uint64                    v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(long                      v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(long                      v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(unsigned long             v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(unsigned long             v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(int                       v) : sc_unsigned(W) { *this = v; } 
+  sc_biguint(int                       v) : SC_BIGUINT_BASE { *this = v; } 
 
-  sc_biguint(unsigned int              v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(unsigned int              v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(double                    v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(double                    v) : SC_BIGUINT_BASE { *this = v; }
 
 #ifdef SC_INCLUDE_FX
   explicit sc_biguint( const sc_fxval&  );
@@ -102,18 +109,19 @@ public:
 
 #ifdef SC_LOGIC_VECTOR_H
 
-  sc_biguint(const sc_logic_vector&    v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(const sc_logic_vector&    v) : SC_BIGUINT_BASE { *this = v; }
 
-  sc_biguint(const sc_bool_vector&     v) : sc_unsigned(W) { *this = v; }
+  sc_biguint(const sc_bool_vector&     v) : SC_BIGUINT_BASE { *this = v; }
 
 #endif
 
 #ifndef MAX_NBITS
-  ~sc_biguint()  { }
+  // fixed_digit is not to be freed by ~sc_unsigned().
+  ~sc_biguint()  { digit = small_digit; }
 #endif
  
   sc_biguint<W>& operator=(const sc_biguint<W>&      v)
-  { sc_unsigned::operator=(v); return *this; }
+  { sgn = v.sgn; vec_fixed<N>::copy(digit, v.digit); return *this; }
 
   sc_biguint<W>& operator=(const sc_unsigned&        v)
   { sc_unsigned::operator=(v); return *this; }
@@ -172,12 +180,59 @@ public:
   { sc_unsigned::operator=(v); return *this; }
 
 #endif
- 
+
+  // Operators on two numbers of this width work on their N digits, in
+  // loops with a constant trip count. Other operands are handled by
+  // sc_unsigned.
+
+  using sc_unsigned::operator+=;
+  using sc_unsigned::operator-=;
+  using sc_unsigned::operator&=;
+  using sc_unsigned::operator|=;
+  using sc_unsigned::operator^=;
+
+  sc_biguint<W>& operator+=(const sc_biguint<W>& v)
+    { vec_fixed<N>::add_on(digit, v.digit); return reduce(); }
+
+  sc_biguint<W>& operator-=(const sc_biguint<W>& v)
+    { vec_fixed<N>::sub_on(digit, v.digit); return reduce(); }
+
+  sc_biguint<W>& operator&=(const sc_biguint<W>& v)
+    { vec_fixed<N>::and_on(digit, v.digit); return reduce(); }
+
+  sc_biguint<W>& operator|=(const sc_biguint<W>& v)
+    { vec_fixed<N>::or_on(digit, v.digit); return reduce(); }
+
+  sc_biguint<W>& operator^=(const sc_biguint<W>& v)
+    { vec_fixed<N>::xor_on(digit, v.digit); return reduce(); }
+
+private:
+
+  // Number of digits, and the bits of the last one that are in the
+  // number.
+  enum { N = DIV_CEIL(W + 1) };
+
+  static digit_type top_mask()
+    { return DIGIT_MASK >> (N * BITS_PER_DIGIT - W); }
+
+  // Reduce the digits modulo 2^W, and set the sign.
+  sc_biguint<W>& reduce()
+  {
+    digit[N - 1] &= top_mask();
+    sgn = (vec_fixed<N>::is_zero(digit) ? SC_ZERO : SC_POS);
+    return *this;
+  }
+
+#ifndef MAX_NBITS
+  digit_type fixed_digit[N];
+#endif
+
 };
 
 // Implementation of sc_bv and sc_lv parts.
 template<int W>  
 sc_biguint<W>::sc_biguint( const sc_bv<W>& v)
+  : SC_BIGUINT_BASE
 {
   for( int i = W-1; i >= 0; i-- )
     set( i, v[i] );
@@ -185,6 +240,7 @@ sc_biguint<W>::sc_biguint( const sc_bv<W>& v)
 
 template<int W>  
 sc_biguint<W>::sc_biguint( const sc_lv<W>& v )
+  : SC_BIGUINT_BASE
 {
   for( int i = W-1; i >= 0; i-- ){
     if( v[i] > 1 )
@@ -68,8 +68,6 @@ template<int W> class sc_lv;
 using sc_bv_ns::sc_bv;
 using sc_bv_ns::sc_lv;
 
-extern const uint64 mask64[LLWIDTH][LLWIDTH];
-
 
 //Base class for sc_int. 
 
@@ -84,17 +82,16 @@ public:
   
 
   /* Constructors */
-  sc_int_base() : num(0),width(LLWIDTH) { } 
-  explicit sc_int_base(int w) : num(0),width(w) { }
-  sc_int_base(int64 value, int w) : width(w) { int S = (LLWIDTH - w); num = value << S >> S; }
-  sc_int_base( const sc_int_base& v ) { width = v.width; num = v.num; }
+  SC_CONSTEXPR sc_int_base() : num(0),width(LLWIDTH) { } 
+  explicit SC_CONSTEXPR sc_int_base(int w) : num(0),width(w) { }
+  SC_CONSTEXPR sc_int_base(int64 value, int w) : num(sign_extend64(value, w)),width(w) { }
+  SC_CONSTEXPR sc_int_base( const sc_int_base& v ) : num(v.num),width(v.width) { }
   sc_int_base( const sc_int_subref& v );
 #if !defined(__SUNPRO_CC)
   template <class T1, class T2> sc_int_base( const sc_int_concat<T1, T2>& v ) 
   { 
       width = v.bitwidth();
-      int S = LLWIDTH - width;
-      num = (v.operator int64()) << S >> S;
+      num = sign_extend64(v.operator int64(), width);
   }
 #endif
   sc_int_base( const sc_bool_vector& v); 
@@ -102,18 +99,17 @@ public:
   sc_int_base( const sc_signed& v);
   sc_int_base( const sc_unsigned& v);
 
-  // Destructor
-  ~sc_int_base() { }
+  // No destructor, so that the implicit one is trivial and
+  // sc_int_base is a literal type.
   
   // Assignment operators
-  sc_int_base& operator=(int64 v ) { int S = (LLWIDTH - width); num = v << S >> S; return *this; }
-  sc_int_base& operator=( const sc_int_base& v ) { int S = (LLWIDTH - width); num = v.num << S >> S; return *this; }
+  SC_CONSTEXPR sc_int_base& operator=(int64 v ) { num = sign_extend64(v, width); return *this; }
+  SC_CONSTEXPR sc_int_base& operator=( const sc_int_base& v ) { num = sign_extend64(v.num, width); return *this; }
   sc_int_base& operator=( const sc_int_subref& v); 
 #if !defined(__SUNPRO_CC)
   template< class T1, class T2 > sc_int_base& operator=( const sc_int_concat<T1, T2>& v)
   {
-      int S = LLWIDTH - width;
-      num = (v.operator int64()) << S >> S;
+      num = sign_extend64(v.operator int64(), width);
       return *this;
   }
 #endif
@@ -128,11 +124,11 @@ public:
   sc_int_base& operator = ( const sc_fxnum_fast& );
 #endif
   
-  operator int64() const { return num; }
+  SC_CONSTEXPR operator int64() const { return num; }
 
-  unsigned int to_uint() const {return (unsigned int)num; }
-  int to_int() const {return (int)num; }
-  long long_low() const { 
+  SC_CONSTEXPR unsigned int to_uint() const {return (unsigned int)num; }
+  SC_CONSTEXPR int to_int() const {return (int)num; }
+  SC_CONSTEXPR long long_low() const { 
 #ifndef WIN32
       return (long)(num & 0x00000000ffffffffULL);
 #else
@@ -140,7 +136,7 @@ public:
 #endif
   }
 
-  long long_high() const {
+  SC_CONSTEXPR long long_high() const {
 #ifndef WIN32
       return (long)( (num >> 32)  & 0x00000000ffffffffULL );
 #else
@@ -149,126 +145,113 @@ public:
   }
 
   //Arithmetic operators
-  sc_int_base& operator+=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator+=(int64 v) 
   { 
       int64 val = num;
-      int S = LLWIDTH - width; 
       val += v;
-      num = val << S >> S;
+      num = sign_extend64(val, width);
       return *this; 
   }
-  sc_int_base& operator-=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator-=(int64 v) 
   { 
       int64 val = num;
-      int S = LLWIDTH - width; 
       val -= v;
-      num = val << S >> S;
+      num = sign_extend64(val, width);
       return *this;
   }
   
-  sc_int_base& operator*=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator*=(int64 v) 
   { 
     int64 val = num;
-    int S = LLWIDTH - width; 
     val *= v;
-    num = val << S >> S; 
+    num = sign_extend64(val, width); 
     return *this;
   }
   
-  sc_int_base& operator/=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator/=(int64 v) 
   { 
     int64 val = num;
-    int S = LLWIDTH - width; 
     val /= v; 
-    num = val << S >> S; 
+    num = sign_extend64(val, width); 
     return *this; 
   }
-  sc_int_base& operator%=(int64 v)
+  SC_CONSTEXPR sc_int_base& operator%=(int64 v)
   { 
     int64 val = num;
-    int S = LLWIDTH - width;
     val %= v; 
-    num = val << S >> S;
+    num = sign_extend64(val, width);
     return *this; 
   }
   
   //Bitwise operators
-  sc_int_base& operator&=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator&=(int64 v) 
   { 
     int64 val = num;
-    int S = LLWIDTH - width; 
     val &= v;
-    num = val << S >> S;
+    num = sign_extend64(val, width);
     return *this;
   }
-  sc_int_base& operator|=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator|=(int64 v) 
   {
     int64 val = num;
-    int S = LLWIDTH - width; 
     val |= v;
-    num = val << S >> S;
+    num = sign_extend64(val, width);
     return *this;
   }
 
-  sc_int_base& operator^=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator^=(int64 v) 
   {
     int64 val = num;
-    int S = LLWIDTH - width; 
     val ^= v;
-    num = val << S >> S;
+    num = sign_extend64(val, width);
     return *this;
   }
-  sc_int_base& operator<<=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator<<=(int64 v) 
   {
     int64 val = num;
-    int S = LLWIDTH - width; 
-    val <<= v;
-    num = val << S >> S;
+    val = (int64) ((uint64) val << v);
+    num = sign_extend64(val, width);
     return *this;
   }
 
-  sc_int_base& operator>>=(int64 v) 
+  SC_CONSTEXPR sc_int_base& operator>>=(int64 v) 
   {
     num >>= v;  //No sign extension needed.
     return *this;
   }
   
   //postfix and prefix increment & decrement operators
-  sc_int_base& operator++() // prefix
+  SC_CONSTEXPR sc_int_base& operator++() // prefix
   {
     int64 val = num;
-    int S = LLWIDTH - width;
     ++val;
-    num = val << S >> S;
+    num = sign_extend64(val, width);
     return *this;
   }
 
-  const sc_int_base operator++(int) // postfix
+  SC_CONSTEXPR const sc_int_base operator++(int) // postfix
   {
     int64 val = num;
-    int S = LLWIDTH - width;
     int64 tmp = val;
     val++;
-    num = val << S >> S;
+    num = sign_extend64(val, width);
     return sc_int_base(tmp, width);
   }
 
-  sc_int_base& operator--() //prefix
+  SC_CONSTEXPR sc_int_base& operator--() //prefix
   {
     int64 val = num;
-    int S = LLWIDTH - width;
     --val;
-    num = val << S >> S; 
+    num = sign_extend64(val, width); 
     return *this;
   }
   
-  const sc_int_base operator--(int) //postfix 
+  SC_CONSTEXPR const sc_int_base operator--(int) //postfix 
   {
     int64 val = num;  
-    int S = LLWIDTH - width;
     int64 tmp = val;
     val--;
-    num = val << S >> S;
+    num = sign_extend64(val, width);
     return sc_int_base(tmp, width);
   }
 
@@ -276,11 +259,11 @@ public:
   // Bit-select and part-select operators
   
   sc_int_bitref operator[] ( int i ); 
-  bit operator[] (int i) const { return test(i); }
+  SC_CONSTEXPR bit operator[] (int i) const { return test(i); }
   sc_int_subref range(int left, int right ); 
-  int64 range( int left, int right ) const;
+  SC_CONSTEXPR int64 range( int left, int right ) const;
 
-  bit test(int i) const 
+  SC_CONSTEXPR bit test(int i) const 
   {
 #ifndef WIN32
       return (  0 != ( num & (1ULL << i) ) ); 
@@ -288,7 +271,7 @@ public:
       return (  0 != ( num & (1i64 << i) ) );
 #endif
   }  
-  void set(int i) 
+  SC_CONSTEXPR void set(int i) 
   {
 #ifndef WIN32
       num |= (1ULL << i); 
@@ -297,7 +280,7 @@ public:
 #endif
   }
 
-  void set(int i, bit v )
+  SC_CONSTEXPR void set(int i, bit v )
   {
 #ifndef WIN32
     int64 val = num;  
@@ -312,19 +295,19 @@ public:
 #endif
   }
 
-  int bitwidth() const { return width; }
+  SC_CONSTEXPR int bitwidth() const { return width; }
 
-  friend bool operator == ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator == ( const sc_int_base& a, const sc_int_base& b )
     { return a.num == b.num; }
-  friend bool operator != ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator != ( const sc_int_base& a, const sc_int_base& b )
     { return a.num != b.num; }
-  friend bool operator < ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator < ( const sc_int_base& a, const sc_int_base& b )
     { return a.num < b.num; }
-  friend bool operator <= ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator <= ( const sc_int_base& a, const sc_int_base& b )
     { return a.num <= b.num; }
-  friend bool operator > ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator > ( const sc_int_base& a, const sc_int_base& b )
     { return a.num > b.num; }
-  friend bool operator >= ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator >= ( const sc_int_base& a, const sc_int_base& b )
     { return a.num >= b.num; }
 
 };
@@ -343,10 +326,10 @@ class sc_int : public sc_int_base {
 
 public:
   // Constructors
-  sc_int() : sc_int_base(W) { }
-  sc_int(int64 v) : sc_int_base(W) { num = v << (LLWIDTH - W) >> (LLWIDTH - W); }
-  sc_int( const sc_int<W>& v) : sc_int_base(W) { num = v.num ; }
-  sc_int( const sc_int_base& v ) : sc_int_base(W) { num = v.num << (LLWIDTH - W) >> (LLWIDTH - W); }
+  SC_CONSTEXPR sc_int() : sc_int_base(W) { }
+  SC_CONSTEXPR sc_int(int64 v) : sc_int_base(W) { num = sign_extend64(v, W); }
+  SC_CONSTEXPR sc_int( const sc_int<W>& v) : sc_int_base(W) { num = v.num ; }
+  SC_CONSTEXPR sc_int( const sc_int_base& v ) : sc_int_base(W) { num = sign_extend64(v.num, W); }
   sc_int( const sc_int_subref& v ) : sc_int_base( v ) { }
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_int( const sc_int_concat<T1,T2>& v) : sc_int_base(v) { }
@@ -365,10 +348,10 @@ public:
   sc_int( const sc_lv<W>& v );
 
   //Assignment operators
- sc_int& operator=(int64 v) { num = v << (LLWIDTH - W) >> (LLWIDTH - W); return *this; }
- sc_int& operator=( const sc_int_base& v ) { num = v.num << (LLWIDTH - W) >> (LLWIDTH - W); return *this; }
+ SC_CONSTEXPR sc_int& operator=(int64 v) { num = sign_extend64(v, W); return *this; }
+ SC_CONSTEXPR sc_int& operator=( const sc_int_base& v ) { num = sign_extend64(v.num, W); return *this; }
  sc_int& operator=( const sc_int_subref& v ) { sc_int_base::operator=(v); return *this; }
- sc_int& operator=( const sc_int<W>& v) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_int& operator=( const sc_int<W>& v) { num = v.num; return *this; }
 #if !defined(__SUNPRO_CC)
  template<class T1, class T2> sc_int& operator=( const sc_int_concat<T1, T2>& v) { sc_int_base::operator=(v); return *this; }
 #endif
@@ -392,113 +375,113 @@ public:
     // operator int64() const { return num; }
  
  //Arithmetic operators
-  sc_int& operator+=(int64 v) 
+  SC_CONSTEXPR sc_int& operator+=(int64 v) 
   { 
     int64 val = num;
     val += v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator-=(int64 v) 
+  SC_CONSTEXPR sc_int& operator-=(int64 v) 
   {
     int64 val = num;
     val -= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator*=(int64 v) 
+  SC_CONSTEXPR sc_int& operator*=(int64 v) 
   {
     int64 val = num;
     val *= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator/=(int64 v) 
+  SC_CONSTEXPR sc_int& operator/=(int64 v) 
   {
     int64 val = num;
     val /= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator%=(int64 v) 
+  SC_CONSTEXPR sc_int& operator%=(int64 v) 
   {
     int64 val = num;
     val %= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
   
   //Bitwise operators
-  sc_int& operator&=(int64 v) 
+  SC_CONSTEXPR sc_int& operator&=(int64 v) 
   {
     int64 val = num;
     val &= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator|=(int64 v) 
+  SC_CONSTEXPR sc_int& operator|=(int64 v) 
   {
     int64 val = num;
     val |= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator^=(int64 v) 
+  SC_CONSTEXPR sc_int& operator^=(int64 v) 
   {
     int64 val = num;
     val ^= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator<<=(int64 v) 
+  SC_CONSTEXPR sc_int& operator<<=(int64 v) 
   {
     int64 val = num;
-    val <<= v;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    val = (int64) ((uint64) val << v);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  sc_int& operator>>=(int64 v) { num >>= v; return *this; }
+  SC_CONSTEXPR sc_int& operator>>=(int64 v) { num >>= v; return *this; }
   
   //postfix and prefix increment & decrement operators
-  sc_int& operator++() // prefix
+  SC_CONSTEXPR sc_int& operator++() // prefix
   {
     int64 val = num;  
     ++val;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return *this;
   }
 
-  const sc_int operator++(int) // postfix
+  SC_CONSTEXPR const sc_int operator++(int) // postfix
   {
     int64 val = num;
     int64 tmp = val;
     val++;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return sc_int<W>(tmp);
   }
 
-  sc_int& operator--() //prefix
+  SC_CONSTEXPR sc_int& operator--() //prefix
   {
     int64 val = num;
     --val;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W); 
+    num = sign_extend64(val, W); 
     return *this;
   }
   
-  const sc_int operator--(int) //postfix 
+  SC_CONSTEXPR const sc_int operator--(int) //postfix 
   {
     int64 val = num;
     int64 tmp = val;
     val--;
-    num = val << (LLWIDTH - W) >> (LLWIDTH - W);
+    num = sign_extend64(val, W);
     return sc_int<W>(tmp);
   }
 
@@ -519,28 +502,22 @@ public:
 
   sc_int_bitref& operator=( const sc_int_bitref& b)
   {
-    int64 val;
     int len = obj->width;
 
     obj->set(index, (b.obj)->test(b.index) );
     if( index == len - 1 ){
-	val = obj->num;
-	val = val << (LLWIDTH - len) >> (LLWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend64(obj->num, len);
     }
     return *this;
   }
    
   sc_int_bitref& operator=( bit b )
   {
-    int64 val;
     int len = obj->width;
 
     obj->set(index, b );
     if( index == len - 1 ){
-	val = obj->num;
-	val = val << (LLWIDTH - len) >> (LLWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend64(obj->num, len);
     }
     return *this;
   }
@@ -548,21 +525,17 @@ public:
   
   sc_int_bitref& operator&=( bit b )
   {
-    int64 val;
     int len = obj->width;
 
-    obj->num &= ~ ( ( !b ) << index );
+    obj->num &= ~ ( (uint64) ( !b ) << index );
     if( index == len - 1 ){
-	val = obj->num;
-	val = val << (LLWIDTH - len) >> (LLWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend64(obj->num, len);
     }
     return *this;
   }
 
   sc_int_bitref& operator|=( bit b )
   {
-      int64 val;
       int len = obj->width;
 #ifndef WIN32
     obj->num |= ( (b & 1ULL) << index );
@@ -570,15 +543,12 @@ public:
     obj->num |= ( (b & 1i64) << index );
 #endif
     if( index == len - 1 ) {
-	val = obj->num;
-	val = val << (LLWIDTH - len) >> (LLWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend64(obj->num, len);
     }
     return *this;
   }
   sc_int_bitref& operator^=( bit b )
   {
-    int64 val;
     int len = obj->width;
 #ifndef WIN32
     obj->num ^= ((b & 1ULL ) << index );
@@ -586,9 +556,7 @@ public:
     obj->num ^= ((b & 1i64 ) << index );
 #endif
     if ( index == len - 1 ){
-	val = obj->num;
-	val = val << (LLWIDTH - len) >> (LLWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend64(obj->num, len);
     }
     return *this;
   }
@@ -625,20 +593,7 @@ public:
   
   sc_int_subref& operator=( const sc_int_base& v)
   { 
-    int64 val = obj->num;
-    int len = obj->width;
-
-    // Mask the bits out that are part-selected
-    val &= mask64[left][right];
-
-    // set the part-selected bits
-    val |= (v.num << right) & ~mask64[left][right];
-    
-    // normalize the value
-    val = val << (LLWIDTH - len) >> (LLWIDTH - len);
-
-    obj->num = val;
-    return *this;
+    return operator=( v.num );
   }
     
   sc_int_subref& operator=( const sc_int_subref& v)
@@ -650,32 +605,27 @@ public:
   
   sc_int_subref& operator=( int64 v )
   {
-    int64 val = obj->num;
-    int len = obj->width;
-    
-    // Mask the bits out that are part-selected
-    val &= mask64[left][right];
-
-    //Set the part-selected bits
-    val |= (v << right) & ~mask64[left][right];
+    // Replace the part-selected bits. If left < right, the range is
+    // reversed: bit i of v goes to bit right - i. set_field64() leaves
+    // a reversed range alone, so only the reversed fix-up is conditional.
+    uint64 val = set_field64(obj->num, (uint64) v, left, right);
+    if( left < right )
+      val = set_reversed_field64(val, (uint64) v, left, right);
 
     // Normalize the value
-    val = val << (LLWIDTH - len) >> (LLWIDTH - len);
-
-    obj->num = val;
+    obj->num = sign_extend64((int64) val, obj->width);
     return *this;
   }
   
   operator int64() const 
   { 
-    int64 val = obj->num;
-    if( left == obj->width - 1 )
-      return val >> right;
-    else
-      return val << (LLWIDTH - (left + 1)) >> (LLWIDTH -( left + 1) + right); 
+    if( left >= right )
+      return get_signed_field64(obj->num, left, right);
+    return sign_extend64((int64) get_reversed_field64(obj->num, left, right),
+                         right - left + 1);
   }
 
-  int bitwidth() const { return left - right + 1; }
+  int bitwidth() const { return (left >= right) ? left - right + 1 : right - left + 1; }
 
 private:
   sc_int_base* obj;
@@ -746,7 +696,7 @@ public:
     int64 high = (left << right.bitwidth() ) & (~mask);
     int64 low  = right & mask;
     int64 tmp = high | low;
-    return ( tmp << (LLWIDTH - len) >> (LLWIDTH - len) );
+    return sign_extend64(tmp, len);
   }
 
   int bitwidth() const { return len; }
@@ -66,8 +66,6 @@ template<int W> class sc_lv;
 using sc_bv_ns::sc_bv;
 using sc_bv_ns::sc_lv;
 
-extern const unsigned int  mask32[INTWIDTH][INTWIDTH];
-
 
 //Base class for sc_int. 
 
@@ -82,17 +80,16 @@ public:
   
 
   /* Constructors */
-  sc_int_base() : num(0),width(INTWIDTH) { } 
-  explicit sc_int_base(int w) : num(0),width(w) { }
-  sc_int_base(int value, int w) : width(w) { int S = (INTWIDTH - w); num = value << S >> S; }
-  sc_int_base( const sc_int_base& v ) { width = v.width; num = v.num; }
+  SC_CONSTEXPR sc_int_base() : num(0),width(INTWIDTH) { } 
+  explicit SC_CONSTEXPR sc_int_base(int w) : num(0),width(w) { }
+  SC_CONSTEXPR sc_int_base(int value, int w) : num(sign_extend32(value, w)),width(w) { }
+  SC_CONSTEXPR sc_int_base( const sc_int_base& v ) : num(v.num),width(v.width) { }
   sc_int_base( const sc_int_subref& v );
 #if !defined(__SUNPRO_CC)
   template <class T1, class T2> sc_int_base( const sc_int_concat<T1, T2>& v ) 
   { 
       width = v.bitwidth();
-      int S = INTWIDTH - width;
-      num = (v.operator int()) << S >> S;
+      num = sign_extend32(v.operator int(), width);
   }
 #endif
   sc_int_base( const sc_bool_vector& v); 
@@ -100,18 +97,17 @@ public:
   sc_int_base( const sc_signed& v);
   sc_int_base( const sc_unsigned& v);
 
-  // Destructor
-  ~sc_int_base() { }
+  // No destructor, so that the implicit one is trivial and
+  // sc_int_base is a literal type.
   
   // Assignment operators
-  sc_int_base& operator=(int v ) { int S = (INTWIDTH - width); num = v << S >> S; return *this; }
-  sc_int_base& operator=( const sc_int_base& v ) { int S = (INTWIDTH - width); num = v.num << S >> S; return *this; }
+  SC_CONSTEXPR sc_int_base& operator=(int v ) { num = sign_extend32(v, width); return *this; }
+  SC_CONSTEXPR sc_int_base& operator=( const sc_int_base& v ) { num = sign_extend32(v.num, width); return *this; }
   sc_int_base& operator=( const sc_int_subref& v); 
 #if !defined(__SUNPRO_CC)
   template< class T1, class T2 > sc_int_base& operator=( const sc_int_concat<T1, T2>& v)
   {
-      int S = INTWIDTH - width;
-      num = (v.operator int()) << S >> S;
+      num = sign_extend32(v.operator int(), width);
       return *this;
   }
 #endif
@@ -126,133 +122,120 @@ public:
   sc_int_base& operator = ( const sc_fxnum_fast& );
 #endif
   
-  operator int() const { return num; }
+  SC_CONSTEXPR operator int() const { return num; }
 
-  unsigned int to_uint() const {return (unsigned int)num; }
-  int to_int() const {return (int)num; }
+  SC_CONSTEXPR unsigned int to_uint() const {return (unsigned int)num; }
+  SC_CONSTEXPR int to_int() const {return (int)num; }
   
 
   //Arithmetic operators
-  sc_int_base& operator+=(int v) 
+  SC_CONSTEXPR sc_int_base& operator+=(int v) 
   { 
       int val = num;
-      int S = INTWIDTH - width; 
       val += v;
-      num = val << S >> S;
+      num = sign_extend32(val, width);
       return *this; 
   }
-  sc_int_base& operator-=(int v) 
+  SC_CONSTEXPR sc_int_base& operator-=(int v) 
   { 
       int val = num;
-      int S = INTWIDTH - width; 
       val -= v;
-      num = val << S >> S;
+      num = sign_extend32(val, width);
       return *this;
   }
   
-  sc_int_base& operator*=(int v) 
+  SC_CONSTEXPR sc_int_base& operator*=(int v) 
   { 
     int val = num;
-    int S = INTWIDTH - width; 
     val *= v;
-    num = val << S >> S; 
+    num = sign_extend32(val, width); 
     return *this;
   }
   
-  sc_int_base& operator/=(int v) 
+  SC_CONSTEXPR sc_int_base& operator/=(int v) 
   { 
     int val = num;
-    int S = INTWIDTH - width; 
     val /= v; 
-    num = val << S >> S; 
+    num = sign_extend32(val, width); 
     return *this; 
   }
-  sc_int_base& operator%=(int v)
+  SC_CONSTEXPR sc_int_base& operator%=(int v)
   { 
     int val = num;
-    int S = INTWIDTH - width;
     val %= v; 
-    num = val << S >> S;
+    num = sign_extend32(val, width);
     return *this; 
   }
   
   //Bitwise operators
-  sc_int_base& operator&=(int v) 
+  SC_CONSTEXPR sc_int_base& operator&=(int v) 
   { 
     int val = num;
-    int S = INTWIDTH - width; 
     val &= v;
-    num = val << S >> S;
+    num = sign_extend32(val, width);
     return *this;
   }
-  sc_int_base& operator|=(int v) 
+  SC_CONSTEXPR sc_int_base& operator|=(int v) 
   {
     int val = num;
-    int S = INTWIDTH - width; 
     val |= v;
-    num = val << S >> S;
+    num = sign_extend32(val, width);
     return *this;
   }
 
-  sc_int_base& operator^=(int v) 
+  SC_CONSTEXPR sc_int_base& operator^=(int v) 
   {
     int val = num;
-    int S = INTWIDTH - width; 
     val ^= v;
-    num = val << S >> S;
+    num = sign_extend32(val, width);
     return *this;
   }
-  sc_int_base& operator<<=(int v) 
+  SC_CONSTEXPR sc_int_base& operator<<=(int v) 
   {
     int val = num;
-    int S = INTWIDTH - width; 
-    val <<= v;
-    num = val << S >> S;
+    val = (int) ((unsigned int) val << v);
+    num = sign_extend32(val, width);
     return *this;
   }
 
-  sc_int_base& operator>>=(int v) 
+  SC_CONSTEXPR sc_int_base& operator>>=(int v) 
   {
     num >>= v;  //No sign extension needed.
     return *this;
   }
   
   //postfix and prefix increment & decrement operators
-  sc_int_base& operator++() // prefix
+  SC_CONSTEXPR sc_int_base& operator++() // prefix
   {
     int val = num;
-    int S = INTWIDTH - width;
     ++val;
-    num = val << S >> S;
+    num = sign_extend32(val, width);
     return *this;
   }
 
-  const sc_int_base operator++(int) // postfix
+  SC_CONSTEXPR const sc_int_base operator++(int) // postfix
   {
     int val = num;
-    int S = INTWIDTH - width;
     int tmp = val;
     val++;
-    num = val << S >> S;
+    num = sign_extend32(val, width);
     return sc_int_base(tmp, width);
   }
 
-  sc_int_base& operator--() //prefix
+  SC_CONSTEXPR sc_int_base& operator--() //prefix
   {
     int val = num;
-    int S = INTWIDTH - width;
     --val;
-    num = val << S >> S; 
+    num = sign_extend32(val, width); 
     return *this;
   }
   
-  const sc_int_base operator--(int) //postfix 
+  SC_CONSTEXPR const sc_int_base operator--(int) //postfix 
   {
     int val = num;  
-    int S = INTWIDTH - width;
     int tmp = val;
     val--;
-    num = val << S >> S;
+    num = sign_extend32(val, width);
     return sc_int_base(tmp, width);
   }
 
@@ -260,20 +243,20 @@ public:
   // Bit-select and part-select operators
   
   sc_int_bitref operator[] ( int i ); 
-  bit operator[] (int i) const { return test(i); }
+  SC_CONSTEXPR bit operator[] (int i) const { return test(i); }
   sc_int_subref range(int left, int right ); 
-  int range( int left, int right ) const;
+  SC_CONSTEXPR int range( int left, int right ) const;
 
-  bit test(int i) const 
+  SC_CONSTEXPR bit test(int i) const 
   {
       return (  0 != ( num & (1U << i) ) ); 
   }  
-  void set(int i) 
+  SC_CONSTEXPR void set(int i) 
   {
       num |= (1U << i); 
   }
 
-  void set(int i, bit v )
+  SC_CONSTEXPR void set(int i, bit v )
   {
     int val = num;  
     val &= ~ (1U << i );
@@ -281,19 +264,19 @@ public:
     num = val;
   }
 
-  int bitwidth() const { return width; }
+  SC_CONSTEXPR int bitwidth() const { return width; }
 
-  friend bool operator == ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator == ( const sc_int_base& a, const sc_int_base& b )
     { return a.num == b.num; }
-  friend bool operator != ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator != ( const sc_int_base& a, const sc_int_base& b )
     { return a.num != b.num; }
-  friend bool operator < ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator < ( const sc_int_base& a, const sc_int_base& b )
     { return a.num < b.num; }
-  friend bool operator <= ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator <= ( const sc_int_base& a, const sc_int_base& b )
     { return a.num <= b.num; }
-  friend bool operator > ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator > ( const sc_int_base& a, const sc_int_base& b )
     { return a.num > b.num; }
-  friend bool operator >= ( const sc_int_base& a, const sc_int_base& b )
+  friend SC_CONSTEXPR bool operator >= ( const sc_int_base& a, const sc_int_base& b )
     { return a.num >= b.num; }
 
 };
@@ -312,10 +295,10 @@ class sc_int : public sc_int_base {
 
 public:
   // Constructors
-  sc_int() : sc_int_base(W) { }
-  sc_int(int v) : sc_int_base(W) { num = v << (INTWIDTH - W) >> (INTWIDTH - W); }
-  sc_int( const sc_int<W>& v) : sc_int_base(W) { num = v.num ; }
-  sc_int( const sc_int_base& v ) : sc_int_base(W) { num = v.num << (INTWIDTH - W) >> (INTWIDTH - W); }
+  SC_CONSTEXPR sc_int() : sc_int_base(W) { }
+  SC_CONSTEXPR sc_int(int v) : sc_int_base(W) { num = sign_extend32(v, W); }
+  SC_CONSTEXPR sc_int( const sc_int<W>& v) : sc_int_base(W) { num = v.num ; }
+  SC_CONSTEXPR sc_int( const sc_int_base& v ) : sc_int_base(W) { num = sign_extend32(v.num, W); }
   sc_int( const sc_int_subref& v ) : sc_int_base( v ) { }
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_int( const sc_int_concat<T1,T2>& v) : sc_int_base(v) { }
@@ -334,10 +317,10 @@ public:
   sc_int( const sc_lv<W>& v );
 
   //Assignment operators
- sc_int& operator=(int v) { num = v << (INTWIDTH - W) >> (INTWIDTH - W); return *this; }
- sc_int& operator=( const sc_int_base& v ) { num = v.num << (INTWIDTH - W) >> (INTWIDTH - W); return *this; }
+ SC_CONSTEXPR sc_int& operator=(int v) { num = sign_extend32(v, W); return *this; }
+ SC_CONSTEXPR sc_int& operator=( const sc_int_base& v ) { num = sign_extend32(v.num, W); return *this; }
  sc_int& operator=( const sc_int_subref& v ) { sc_int_base::operator=(v); return *this; }
- sc_int& operator=( const sc_int<W>& v) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_int& operator=( const sc_int<W>& v) { num = v.num; return *this; }
 #if !defined(__SUNPRO_CC)
  template<class T1, class T2> sc_int& operator=( const sc_int_concat<T1, T2>& v) { sc_int_base::operator=(v); return *this; }
 #endif
@@ -361,113 +344,113 @@ public:
     // operator int() const { return num; }
  
  //Arithmetic operators
-  sc_int& operator+=(int v) 
+  SC_CONSTEXPR sc_int& operator+=(int v) 
   { 
     int val = num;
     val += v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator-=(int v) 
+  SC_CONSTEXPR sc_int& operator-=(int v) 
   {
     int val = num;
     val -= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator*=(int v) 
+  SC_CONSTEXPR sc_int& operator*=(int v) 
   {
     int val = num;
     val *= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator/=(int v) 
+  SC_CONSTEXPR sc_int& operator/=(int v) 
   {
     int val = num;
     val /= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator%=(int v) 
+  SC_CONSTEXPR sc_int& operator%=(int v) 
   {
     int val = num;
     val %= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
   
   //Bitwise operators
-  sc_int& operator&=(int v) 
+  SC_CONSTEXPR sc_int& operator&=(int v) 
   {
     int val = num;
     val &= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator|=(int v) 
+  SC_CONSTEXPR sc_int& operator|=(int v) 
   {
     int val = num;
     val |= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator^=(int v) 
+  SC_CONSTEXPR sc_int& operator^=(int v) 
   {
     int val = num;
     val ^= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator<<=(int v) 
+  SC_CONSTEXPR sc_int& operator<<=(int v) 
   {
     int val = num;
-    val <<= v;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    val = (int) ((unsigned int) val << v);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  sc_int& operator>>=(int v) { num >>= v; return *this; }
+  SC_CONSTEXPR sc_int& operator>>=(int v) { num >>= v; return *this; }
   
   //postfix and prefix increment & decrement operators
-  sc_int& operator++() // prefix
+  SC_CONSTEXPR sc_int& operator++() // prefix
   {
     int val = num;  
     ++val;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return *this;
   }
 
-  const sc_int operator++(int) // postfix
+  SC_CONSTEXPR const sc_int operator++(int) // postfix
   {
     int val = num;
     int tmp = val;
     val++;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return sc_int(tmp);
   }
 
-  sc_int& operator--() //prefix
+  SC_CONSTEXPR sc_int& operator--() //prefix
   {
     int val = num;
     --val;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W); 
+    num = sign_extend32(val, W); 
     return *this;
   }
   
-  const sc_int operator--(int) //postfix 
+  SC_CONSTEXPR const sc_int operator--(int) //postfix 
   {
     int val = num;
     int tmp = val;
     val--;
-    num = val << (INTWIDTH - W) >> (INTWIDTH - W);
+    num = sign_extend32(val, W);
     return sc_int(tmp);
   }
 
@@ -488,28 +471,22 @@ public:
 
   sc_int_bitref& operator=( const sc_int_bitref& b)
   {
-    int val;
     int len = obj->width;
 
     obj->set(index, (b.obj)->test(b.index) );
     if( index == len - 1 ){
-	val = obj->num;
-	val = val << (INTWIDTH - len) >> (INTWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend32(obj->num, len);
     }
     return *this;
   }
    
   sc_int_bitref& operator=( bit b )
   {
-    int val;
     int len = obj->width;
 
     obj->set(index, b );
     if( index == len - 1 ){
-	val = obj->num;
-	val = val << (INTWIDTH - len) >> (INTWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend32(obj->num, len);
     }
     return *this;
   }
@@ -517,41 +494,32 @@ public:
   
   sc_int_bitref& operator&=( bit b )
   {
-    int val;
     int len = obj->width;
 
-    obj->num &= ~ ( ( !b ) << index );
+    obj->num &= ~ ( (unsigned int) ( !b ) << index );
     if( index == len - 1 ){
-	val = obj->num;
-	val = val << (INTWIDTH - len) >> (INTWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend32(obj->num, len);
     }
     return *this;
   }
 
   sc_int_bitref& operator|=( bit b )
   {
-      int val;
       int len = obj->width;
       obj->num |= ( (b & 1U) << index );
       if( index == len - 1 ) {
-	val = obj->num;
-        val = val << (INTWIDTH - len) >> (INTWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend32(obj->num, len);
       }
     return *this;
   }
   sc_int_bitref& operator^=( bit b )
   {
-    int val;
     int len = obj->width;
 
     obj->num ^= ((b & 1U ) << index );
 
     if ( index == len - 1 ){
-	val = obj->num;
-	val = val << (INTWIDTH - len) >> (INTWIDTH - len);
-	obj->num = val;
+	obj->num = sign_extend32(obj->num, len);
     }
     return *this;
   }
@@ -588,20 +556,7 @@ public:
   
   sc_int_subref& operator=( const sc_int_base& v)
   { 
-    int val = obj->num;
-    int len = obj->width;
-
-    // Mask the bits out that are part-selected
-    val &= mask32[left][right];
-
-    // set the part-selected bits
-    val |= (v.num << right) & ~mask32[left][right];
-    
-    // normalize the value
-    val = val << (INTWIDTH - len) >> (INTWIDTH - len);
-
-    obj->num = val;
-    return *this;
+    return operator=( v.num );
   }
     
   sc_int_subref& operator=( const sc_int_subref& v)
@@ -613,32 +568,27 @@ public:
   
   sc_int_subref& operator=( int v )
   {
-    int val = obj->num;
-    int len = obj->width;
-    
-    // Mask the bits out that are part-selected
-    val &= mask32[left][right];
-
-    //Set the part-selected bits
-    val |= (v << right) & ~mask32[left][right];
+    // Replace the part-selected bits. If left < right, the range is
+    // reversed: bit i of v goes to bit right - i. set_field32() leaves
+    // a reversed range alone, so only the reversed fix-up is conditional.
+    unsigned int val = set_field32(obj->num, (unsigned int) v, left, right);
+    if( left < right )
+      val = set_reversed_field32(val, (unsigned int) v, left, right);
 
     // Normalize the value
-    val = val << (INTWIDTH - len) >> (INTWIDTH - len);
-
-    obj->num = val;
+    obj->num = sign_extend32((int) val, obj->width);
     return *this;
   }
   
   operator int() const 
   { 
-    int val = obj->num;
-    if( left == obj->width - 1 )
-      return val >> right;
-    else
-      return val << (INTWIDTH - (left + 1)) >> (INTWIDTH -( left + 1) + right); 
+    if( left >= right )
+      return get_signed_field32(obj->num, left, right);
+    return sign_extend32((int) get_reversed_field32(obj->num, left, right),
+                         right - left + 1);
   }
 
-  int bitwidth() const { return left - right + 1; }
+  int bitwidth() const { return (left >= right) ? left - right + 1 : right - left + 1; }
 
 private:
   sc_int_base* obj;
@@ -703,7 +653,7 @@ public:
     int high = (left << right.bitwidth() ) & (~mask);
     int low  = right & mask;
     int tmp = high | low;
-    return ( tmp << (INTWIDTH - len) >> (INTWIDTH - len) );
+    return sign_extend32(tmp, len);
   }
 
   int bitwidth() const { return len; }
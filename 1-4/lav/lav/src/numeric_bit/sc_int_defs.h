@@ -43,29 +43,27 @@
 template<int W>  sc_int<W>::sc_int( const sc_bv<W>& v)
 {
   width = W;
-  int S = LLWIDTH - width;
   for( int i = width-1; i >= 0; i-- ){
     set( i, v[i]);
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
 }
 
 template<int W>  sc_int<W>::sc_int( const sc_lv<W>& v )
 {
   width = W;
-  int S = LLWIDTH - width;
   for( int i = width-1; i >= 0; i-- ){
     if(v[i]>1)
       throw "cannot convert logic to bit";
     set( i, v[i]);
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
 }
 
 inline 
 sc_int_base::sc_int_base(const sc_int_subref& v)
 {
-  width = v.left - v.right + 1; num = v.operator int64();
+  width = v.bitwidth(); num = v.operator int64();
 }
 
 #if defined(__BCPLUSPLUS__)
@@ -74,47 +72,43 @@ sc_int_base::sc_int_base(const sc_int_subref& v)
 inline sc_int_base::sc_int_base( const sc_bool_vector& v )
 {
   width = v.length();
-  int S = LLWIDTH - width;
   for( int i = width-1; i >= 0; i-- ){
     set( i, *(v.get_data_ptr(i)) );
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
 
 }
 
 inline sc_int_base::sc_int_base( const sc_logic_vector& v )
 {
   width = v.length();
-  int S = LLWIDTH - width;
   for( int i = width-1; i >= 0; i-- ){
     set( i, v.get_data_ptr(i)->to_bool() );
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
 }
 
 inline sc_int_base::sc_int_base( const sc_unsigned& v )
 {
   width = v.length();
 
-  int S = LLWIDTH - width;
 
   for( int i = width-1; i >= 0; i-- ){
     set(i, v.test(i));
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
 }
 
 
 inline sc_int_base::sc_int_base( const sc_signed& v )
 {
   width = v.length();
-  int S = LLWIDTH - width;
     
   for( int i = width-1; i >= 0; i-- ){
     set(i, v.test(i));
   }
   
-  num = num << S >> S;
+  num = sign_extend64(num, width);
 }
   
 
@@ -127,20 +121,18 @@ inline sc_int_base& sc_int_base::operator=( const sc_int_subref& v )
 
 inline sc_int_base& sc_int_base::operator=( const sc_bool_vector& v )
 {
-  int S = LLWIDTH - width;
   int vlen = v.length();
   int len = MIN( width, vlen );
   
   for( int i = len-1 ; i >= 0; i-- ){
     set( i, *(v.get_data_ptr(i)) );
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
   return *this;
 }
   
 inline sc_int_base& sc_int_base::operator=( const sc_logic_vector& v )
 {
-  int S = LLWIDTH - width;
   int vlen = v.length();
   int len = MIN( width, vlen );
   
@@ -149,37 +141,34 @@ inline sc_int_base& sc_int_base::operator=( const sc_logic_vector& v )
     set( i, v.get_data_ptr(i)->to_bool() );
   }
   
-  num = num << S >> S;
+  num = sign_extend64(num, width);
   return *this;
 }
 
 template<int W>
 inline sc_int<W>& sc_int<W>::operator=( const sc_bv<W>& v )
 {
-  int S = LLWIDTH - width;
   for( int i = W-1 ; i >= 0; i-- ){
     set( i, v[i] );
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
   return *this;
 }
 
 template<int W>
 inline sc_int<W>& sc_int<W>::operator=( const sc_lv<W>& v )
 {
-  int S = LLWIDTH - width;
   for( int i = W-1 ; i >= 0; i-- ){
     if(v[i]>1)
       throw "cannot convert logic to bit";
     set( i, v[i] );
   }
-  num = num << S >> S;
+  num = sign_extend64(num, width);
   return *this;
 }
 
 inline sc_int_base& sc_int_base::operator=( const sc_unsigned& v )
 {
-  int S = LLWIDTH - width;
   int vlen = v.length();
   int minlen = MIN(width, vlen);
 
@@ -189,13 +178,12 @@ inline sc_int_base& sc_int_base::operator=( const sc_unsigned& v )
   for( ; i < width; ++i )
     set(i, 0); /* zero-extend */
  
-  num = num << S >> S;
+  num = sign_extend64(num, width);
   return *this;
 }
 
 inline sc_int_base& sc_int_base::operator=( const sc_signed& v )
 {
-  int S = LLWIDTH - width;
   int vlen = v.length();
   int minlen = MIN(width, vlen);
 
@@ -206,7 +194,7 @@ inline sc_int_base& sc_int_base::operator=( const sc_signed& v )
   for( ; i < width; ++i ) 
     set( i, sgn );     /* sign-extend */
 
-  num = num << S >> S;
+  num = sign_extend64(num, width);
   
   return *this;
 }
@@ -225,9 +213,14 @@ inline sc_int_subref sc_int_base::range( int left, int right )
   return sc_int_subref( this, left, right );
 }
 
-inline int64 sc_int_base::range( int left, int right ) const
+// If left < right, the range is reversed: bit i of the result is bit
+// right - i of the number.
+inline SC_CONSTEXPR int64 sc_int_base::range( int left, int right ) const
 {
-  return num << (LLWIDTH - (left + 1)) >> ( LLWIDTH -( left + 1) + right );  
+  if( left >= right )
+    return (int64) ((uint64) num << (LLWIDTH - (left + 1))) >> ( LLWIDTH -( left + 1) + right );  
+  else
+    return (int64) (reverse_bits64(num) << left) >> (LLWIDTH - 1 - right + left);
 }
 
 // here we define concatenation operators taking args of all possible combinations.
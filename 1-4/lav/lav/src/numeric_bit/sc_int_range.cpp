@@ -0,0 +1,71 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+
+/******************************************************************************
+
+    sc_int_range.cpp -- Reversed part-selects of sc_int and sc_uint.
+
+******************************************************************************/
+
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#if defined(__BCPLUSPLUS__)
+#pragma hdrstop
+#endif
+#include "sc_nbdefs.h"
+
+
+// Return the bits left up to right of x, left < right, in the low
+// bits: bit i of the result is bit right - i of x.
+uint64
+get_reversed_field64(uint64 x, int left, int right)
+{
+  return (reverse_bits64(x) << left) >> (LLWIDTH - 1 - right + left);
+}
+
+unsigned int
+get_reversed_field32(unsigned int x, int left, int right)
+{
+  return (reverse_bits32(x) << left) >> (INTWIDTH - 1 - right + left);
+}
+
+
+// Return x with its bits left up to right, left < right, replaced by
+// the low bits of v: bit i of v goes to bit right - i.
+uint64
+set_reversed_field64(uint64 x, uint64 v, int left, int right)
+{
+  uint64 mask = range_mask64(right, left);
+  return (x & ~mask) | ((reverse_bits64(v) >> (LLWIDTH - 1 - right)) & mask);
+}
+
+unsigned int
+set_reversed_field32(unsigned int x, unsigned int v, int left, int right)
+{
+  unsigned int mask = range_mask32(right, left);
+  return (x & ~mask) | ((reverse_bits32(v) >> (INTWIDTH - 1 - right)) & mask);
+}
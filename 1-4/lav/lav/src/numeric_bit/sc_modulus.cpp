@@ -0,0 +1,187 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+
+/******************************************************************************
+
+    sc_modulus.cpp -- A divisor prepared for repeated remainders: u % m
+    for many u and the same m.
+
+******************************************************************************/
+
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+    
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <assert.h>
+#if defined(__BCPLUSPLUS__)
+#pragma hdrstop
+#endif
+#include "sc_modulus.h"
+#include "sc_nbutils.h"
+
+
+sc_modulus::sc_modulus(const sc_unsigned& m)
+{
+  init(m.sgn, m.nbits, m.ndigits, m.digit);
+}
+
+
+sc_modulus::sc_modulus(const sc_signed& m)
+{
+  init(m.sgn, m.nbits, m.ndigits, m.digit);
+}
+
+
+sc_modulus::~sc_modulus()
+{
+  delete [] digit;
+  delete [] norm;
+  delete [] inv;
+}
+
+
+void
+sc_modulus::init(small_type s, length_type nb, length_type nd, 
+                 const digit_type *d)
+{
+
+  div_by_zero(s);
+
+  nbits = nb;
+  ndigits = vec_skip_leading_zeros(nd, d);
+
+  digit = new digit_type[ndigits];
+  norm = new digit_type[ndigits];
+  inv = NULL;
+
+  vec_copy(ndigits, digit, d);
+
+  shift = vec_div_normalize(ndigits, digit, norm, recip);
+
+  if (ndigits >= VEC_DIV_BARRETT_THRESHOLD) {
+    inv = new digit_type[ndigits + 1];
+    vec_barrett_inverse(ndigits, digit, inv);
+  }
+
+}
+
+
+// Set d = u % m, and return the sign of d: us, or SC_ZERO.
+// - d has nd = MAXT(und, ndigits) + 1 digits.
+small_type
+sc_modulus::rem(small_type us, length_type und, const digit_type *ud, 
+                length_type nd, digit_type *d) const
+{
+
+  vec_zero(nd, d);
+
+  if (us == SC_ZERO)
+    return SC_ZERO;
+
+  und = vec_skip_leading_zeros(und, ud);
+
+  // u < m => u % m = u, if u is shorter.
+  if (und < ndigits)
+    vec_copy(und, d, ud);
+
+  else if ((ndigits == 1) && (und == 1))
+    d[0] = (*ud) % (*digit);
+
+  else if (inv && (und <= 2 * ndigits)) {
+    vec_copy(und, d, ud);
+    vec_div_barrett(und, d, ndigits, digit, inv, NULL);
+  }
+
+  else
+    vec_div_norm(und, ud, ndigits, norm, shift, recip, NULL, d);
+
+  return check_for_zero(us, nd - 1, d);
+
+}
+
+
+sc_unsigned
+sc_modulus::reduce(const sc_unsigned& u) const
+{
+
+  length_type nd = MAXT(u.ndigits, ndigits) + 1;
+
+#ifdef MAX_NBITS
+  digit_type d[MAX_NDIGITS + 1];
+#else
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
+#endif
+
+  small_type s = rem(u.sgn, u.ndigits, u.digit, nd, d);
+
+  if (s == SC_ZERO) {
+#ifndef MAX_NBITS
+    if (d != small_d)
+      vec_delete(d);
+#endif
+    return sc_unsigned();
+  }
+
+#ifdef MAX_NBITS
+  return sc_unsigned(s, MINT(u.nbits, nbits), nd - 1, d);
+#else
+  return sc_unsigned(s, MINT(u.nbits, nbits), nd - 1, d, (d != small_d));
+#endif
+
+}
+
+
+sc_signed
+sc_modulus::reduce(const sc_signed& u) const
+{
+
+  length_type nd = MAXT(u.ndigits, ndigits) + 1;
+
+#ifdef MAX_NBITS
+  digit_type d[MAX_NDIGITS + 1];
+#else
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
+#endif
+
+  small_type s = rem(u.sgn, u.ndigits, u.digit, nd, d);
+
+  if (s == SC_ZERO) {
+#ifndef MAX_NBITS
+    if (d != small_d)
+      vec_delete(d);
+#endif
+    return sc_signed();
+  }
+
+#ifdef MAX_NBITS
+  return sc_signed(s, MINT(u.nbits, nbits), nd - 1, d);
+#else
+  return sc_signed(s, MINT(u.nbits, nbits), nd - 1, d, (d != small_d));
+#endif
+
+}
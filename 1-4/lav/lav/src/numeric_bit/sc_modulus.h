@@ -0,0 +1,124 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+
+/******************************************************************************
+
+    sc_modulus.h -- A divisor prepared for repeated remainders: u % m
+    for many u and the same m.
+
+******************************************************************************/
+
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+    
+
+******************************************************************************/
+
+
+#ifndef SC_MODULUS_H
+#define SC_MODULUS_H
+
+#include "sc_unsigned.h"
+#include "sc_signed.h"
+
+
+// A model that reduces many numbers by the same modulus, e.g.,
+//
+//   sc_modulus m(p);
+//   ...
+//   acc = (acc * x) % m;
+//
+// gets the same results as with % p, but the work that depends only
+// on p is done once, here: p is normalized for long division and the
+// reciprocal of its top digit is found, and for a wide p, its inverse
+// for Barrett's method is computed, so that each remainder then costs
+// two multiplications. The modulus is copied; changing p afterwards
+// does not change m.
+class sc_modulus {
+
+public:
+
+  // The magnitude of m is the modulus; m must not be zero.
+  explicit sc_modulus(const sc_unsigned& m);
+  explicit sc_modulus(const sc_signed&   m);
+
+  ~sc_modulus();
+
+  // Return u % m. As with %, the result of a signed u has the sign of
+  // u, and the result has as many bits as the shorter of u and m.
+  sc_unsigned reduce(const sc_unsigned& u) const;
+  sc_signed   reduce(const sc_signed&   u) const;
+
+private:
+
+  length_type  nbits;     // The number of bits of the modulus object.
+  length_type  ndigits;   // The number of digits of the modulus, without
+                          // leading zeros.
+  digit_type  *digit;     // The digits of the modulus.
+  digit_type  *norm;      // The modulus, its reciprocal, and the shift
+  digit_type   recip;     // from vec_div_normalize().
+  int          shift;
+  digit_type  *inv;       // Its inverse from vec_barrett_inverse(), or 
+                          // NULL if the modulus is too short for it.
+
+  void init(small_type s, length_type nb, length_type nd, 
+            const digit_type *d);
+
+  small_type rem(small_type us, length_type und, const digit_type *ud, 
+                 length_type nd, digit_type *d) const;
+
+  // Disabled.
+  sc_modulus(const sc_modulus&);
+  sc_modulus& operator=(const sc_modulus&);
+
+};
+
+
+inline
+sc_unsigned
+operator%(const sc_unsigned& u, const sc_modulus& m)
+{
+  return m.reduce(u);
+}
+
+inline
+sc_signed
+operator%(const sc_signed& u, const sc_modulus& m)
+{
+  return m.reduce(u);
+}
+
+inline
+sc_unsigned&
+operator%=(sc_unsigned& u, const sc_modulus& m)
+{
+  return (u = m.reduce(u));
+}
+
+inline
+sc_signed&
+operator%=(sc_signed& u, const sc_modulus& m)
+{
+  return (u = m.reduce(u));
+}
+
+#endif
@@ -70,7 +70,7 @@ sc_signed::sc_signed(const sc_logic_vector& v)
 #ifdef MAX_NBITS
   test_bound(nbits);
 #else
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   for (register length_type i = nbits - 1; i >= 0; --i)
@@ -90,7 +90,7 @@ sc_signed::sc_signed(const sc_bool_vector& v)
 #ifdef MAX_NBITS
   test_bound(nbits);
 #else
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   for (register length_type i = nbits - 1; i >= 0; --i)
@@ -147,7 +147,7 @@ sc_unsigned::sc_unsigned(const sc_logic_vector& v)
 #ifdef MAX_NBITS
   test_bound(nbits - 1);
 #else
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   digit[ndigits - 1] = 0;
@@ -168,7 +168,7 @@ sc_unsigned::sc_unsigned(const sc_bool_vector& v)
 #ifdef MAX_NBITS
   test_bound(nbits - 1);
 #else
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   digit[ndigits - 1] = 0;
@@ -65,7 +65,25 @@ CLASS_TYPE::CLASS_TYPE(length_type nb)
 #ifdef MAX_NBITS
   test_bound(nb);
 #else
-  digit = new digit_type[ndigits];
+  alloc_digits();
+#endif
+
+}
+
+
+// Create a CLASS_TYPE number with nb bits whose digits are in d.
+CLASS_TYPE::CLASS_TYPE(length_type nb, digit_type *d)
+{
+
+  sgn = default_sign();
+  nbits = num_bits(nb);
+  ndigits = DIV_CEIL(nbits);
+
+#ifdef MAX_NBITS
+  test_bound(nb);
+  (void) d;  // The digits are in the digit array member.
+#else
+  digit = d;
 #endif
 
 }
@@ -120,7 +138,7 @@ CLASS_TYPE::CLASS_TYPE(const char *v)
     ndigits = 1;
 
 #ifndef MAX_NBITS
-    digit = new digit_type[1];
+    alloc_digits();
 #endif
 
     digit[0] = 0;
@@ -133,7 +151,7 @@ CLASS_TYPE::CLASS_TYPE(const char *v)
     ndigits = v_num.ndigits;
 
 #ifndef MAX_NBITS
-    digit = new digit_type[ndigits];
+    alloc_digits();
 #endif
 
     vec_copy(ndigits, digit, v_num.digit);
@@ -152,7 +170,7 @@ CLASS_TYPE::CLASS_TYPE(const CLASS_TYPE& v)
   ndigits = v.ndigits;
 
 #ifndef MAX_NBITS
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   vec_copy(ndigits, digit, v.digit);
@@ -174,7 +192,7 @@ CLASS_TYPE::CLASS_TYPE(const OTHER_CLASS_TYPE& v)
 #endif
 
 #ifndef MAX_NBITS
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   copy_digits(v.nbits, v.ndigits, v.digit);
@@ -414,7 +432,7 @@ operator<<(ostream& os, const CLASS_TYPE& u)
 #ifdef MAX_NBITS
   char num_str[MAX_NBITS / 3];
 #else
-  char *num_str = new char[(nd * BITS_PER_DIGIT) / 3];
+  char *num_str = new char[(nd * BITS_PER_DIGIT) / 3 + 1];
 #endif
 
   register length_type inx = 0;
@@ -424,7 +442,8 @@ operator<<(ostream& os, const CLASS_TYPE& u)
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
   vec_copy(nd, d, u.digit);
@@ -449,14 +468,12 @@ operator<<(ostream& os, const CLASS_TYPE& u)
       s = SC_ZERO;
 
     // Get the number in base b from d into num_str.
-    while (nd) {
-      digit_type r = vec_rem_on_small(nd, d, b);
-      num_str[inx++] = xdigs[r + up_len];
-      nd = vec_skip_leading_zeros(nd, d);
-    }
+    if (nd)
+      inx = vec_to_str(nd, d, b, xdigs + up_len, num_str);
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
   }
@@ -534,8 +551,8 @@ operator<<(ostream& os, const CLASS_TYPE& u)
   }
 
   // Print the number itself.
-  while (--num_str_len >= 0)
-    out_str[inx++] = num_str[num_str_len];
+  for (register length_type i = 0; i < num_str_len; ++i)
+    out_str[inx++] = num_str[i];
 
   // For left adjustment, perform padding.
   if (adjust_flags == ios::left) {
@@ -544,7 +561,7 @@ operator<<(ostream& os, const CLASS_TYPE& u)
   }
 
 #ifndef MAX_NBITS
-  delete num_str;
+  delete [] num_str;
 #endif
 
   out_str[inx] = '\0';
@@ -656,7 +673,8 @@ CLASS_TYPE::operator++(int) // postfix
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[ndigits];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (ndigits <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(ndigits);
 #endif
 
   small_type s = sgn;
@@ -665,7 +683,11 @@ CLASS_TYPE::operator++(int) // postfix
 
   ++(*this);
 
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, nbits, ndigits, d);
+#else
+  return CLASS_TYPE(s, nbits, ndigits, d, (d != small_d));
+#endif
 
 }
 
@@ -879,7 +901,8 @@ CLASS_TYPE::operator--(int) // postfix
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[ndigits];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (ndigits <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(ndigits);
 #endif
 
   small_type s = sgn;
@@ -888,7 +911,11 @@ CLASS_TYPE::operator--(int) // postfix
 
   --(*this);
 
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, nbits, ndigits, d);
+#else
+  return CLASS_TYPE(s, nbits, ndigits, d, (d != small_d));
+#endif
 
 }
 
@@ -1943,7 +1970,8 @@ operator~(const CLASS_TYPE& u)
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
   vec_copy(nd, d, u.digit);
@@ -1964,7 +1992,11 @@ operator~(const CLASS_TYPE& u)
 
   }
 
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, u.nbits, nd, d);
+#else
+  return CLASS_TYPE(s, u.nbits, nd, d, (d != small_d));
+#endif
 
 }
 
@@ -2093,18 +2125,23 @@ operator<<(const CLASS_TYPE& u, unsigned long v)
   test_bound(nb);
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif  
 
   vec_copy_and_zero(nd, d, u.ndigits, u.digit);
 
-  convert_SM_to_2C(u.sgn, nd, d);
-
+  // Shifting the magnitude gives the same number as shifting the 2's
+  // complement; since nb grows by v, nothing is shifted out.
   vec_shift_left(nd, d, v);
 
-  small_type s = convert_signed_2C_to_SM(nb, nd, d);
+  small_type s = convert_signed_SM_to_2C_to_SM(u.sgn, nb, nd, d);
 
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, nb, nd, d);
+#else
+  return CLASS_TYPE(s, nb, nd, d, (d != small_d));
+#endif
 
 }
 
@@ -2131,11 +2168,12 @@ CLASS_TYPE::operator<<=(unsigned long v)
   if (sgn == SC_ZERO)
     return *this;
 
-  convert_SM_to_2C();
-
+  // Shifting the magnitude and wrapping it to nbits gives the same
+  // number as shifting the 2's complement. The wrapping does not
+  // touch the digits unless bits are shifted into the sign.
   vec_shift_left(ndigits, digit, v);
 
-  convert_2C_to_SM();
+  convert_SM_to_2C_to_SM();
 
   return *this;
 
@@ -2267,21 +2305,41 @@ operator>>(const CLASS_TYPE& u, unsigned long v)
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif  
 
   vec_copy(nd, d, u.digit);
 
-  convert_SM_to_2C(u.sgn, nd, d);
+  small_type s;
+
+  if (u.sgn == SC_NEG) {
+
+    // -m >> v = -ceil(m / 2^v), so the magnitude is shifted and
+    // rounded up if any of the bits shifted out is one.
+    bool round_up = vec_low_bits_nonzero(nd, d, v);
 
-  if (u.sgn == SC_NEG)
-    vec_shift_right(nd, d, v, DIGIT_MASK);
-  else
     vec_shift_right(nd, d, v, 0);
-    
-  small_type s = convert_signed_2C_to_SM(nb, nd, d);
 
+    if (round_up)
+      vec_add_small_on(nd, d, 1);
+
+    s = SC_NEG;
+
+  }
+  else {
+
+    vec_shift_right(nd, d, v, 0);
+
+    s = check_for_zero(SC_POS, nd, d);
+
+  }
+
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, nb, nd, d);
+#else
+  return CLASS_TYPE(s, nb, nd, d, (d != small_d));
+#endif
 
 }
 
@@ -2308,14 +2366,25 @@ CLASS_TYPE::operator>>=(unsigned long v)
   if (sgn == SC_ZERO)
     return *this;
 
-  convert_SM_to_2C();
+  // As in operator>>, the magnitude of a negative number is rounded
+  // up.
+  if (sgn == SC_NEG) {
+
+    bool round_up = vec_low_bits_nonzero(ndigits, digit, v);
 
-  if (sgn == SC_NEG)
-    vec_shift_right(ndigits, digit, v, DIGIT_MASK);
-  else 
     vec_shift_right(ndigits, digit, v, 0);
 
-  convert_2C_to_SM();
+    if (round_up)
+      vec_add_small_on(ndigits, digit, 1);
+
+  }
+  else {
+
+    vec_shift_right(ndigits, digit, v, 0);
+
+    sgn = check_for_zero(sgn, ndigits, digit);
+
+  }
 
   return *this;
 
@@ -2682,13 +2751,18 @@ CLASS_TYPE::to_string(sc_numrep base, bool formatted) const
 
     register length_type nd = DIV_CEIL(out_nb);
 
+    // d also holds the digits of the number, which can be one more
+    // than nd for an unsigned number.
+    length_type dlen = MAXT(nd, ndigits);
+
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (dlen <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(dlen);
 #endif
 
-    vec_copy_and_zero(nd, d, ndigits, digit);
+    vec_copy_and_zero(dlen, d, ndigits, digit);
 
     // Below the first call is needed to determine the actual sign of
     // the number. After that call, we get the number in
@@ -2711,14 +2785,12 @@ CLASS_TYPE::to_string(sc_numrep base, bool formatted) const
       s = SC_ZERO;
   
     // Get the number in base b from d into num_str.
-    while (nd) {
-      digit_type r = vec_rem_on_small(nd, d, base);
-      num_str[len++] = "0123456789ABCDEF"[r];
-      nd = vec_skip_leading_zeros(nd, d);
-    }
+    if (nd)
+      len = vec_to_str(nd, d, base, "0123456789ABCDEF", num_str);
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
   }
@@ -2746,7 +2818,7 @@ CLASS_TYPE::to_string(sc_numrep base, bool formatted) const
   for (register length_type j = out_nd - 1; j >= len; ++i, --j)
     u.set(i, '0');
 
-  for (register length_type j = len - 1; j >= 0; ++i, --j)
+  for (register length_type j = 0; j < len; ++i, ++j)
     u.set(i, num_str[j]);
 
   u.set(ulen, '\0');
@@ -2818,7 +2890,8 @@ CLASS_TYPE::to_uint64() const
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[ndigits];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (ndigits <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(ndigits);
 #endif
 
     vec_copy(ndigits, d, digit);
@@ -2829,7 +2902,8 @@ CLASS_TYPE::to_uint64() const
       v = (v << BITS_PER_DIGIT) + d[vnd];
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
   }
@@ -2861,7 +2935,8 @@ CLASS_TYPE::to_ulong() const
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[ndigits];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (ndigits <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(ndigits);
 #endif
 
     vec_copy(ndigits, d, digit);
@@ -2872,7 +2947,8 @@ CLASS_TYPE::to_ulong() const
       v = (v << BITS_PER_DIGIT) + d[vnd];
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
   }
@@ -2904,7 +2980,8 @@ CLASS_TYPE::to_uint() const
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[ndigits];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (ndigits <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(ndigits);
 #endif
 
     vec_copy(ndigits, d, digit);
@@ -2915,7 +2992,8 @@ CLASS_TYPE::to_uint() const
       v = (v << BITS_PER_DIGIT) + d[vnd];
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
   }
@@ -2980,7 +3058,8 @@ CLASS_TYPE::test(length_type i) const
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[ndigits];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (ndigits <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(ndigits);
 #endif
 
     vec_copy(ndigits, d, digit);
@@ -2988,7 +3067,8 @@ CLASS_TYPE::test(length_type i) const
     bit val = ((d[digit_num] & one_and_zeros(bit_num)) != 0);
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
     return val;
@@ -3054,68 +3134,17 @@ CLASS_TYPE::reverse()
 void 
 CLASS_TYPE::get_packed_rep(digit_type *buf) const
 {
+  vec_to_packed_2C(sgn, length(), ndigits, digit, buf);
+}
 
-  length_type buf_ndigits = (length() - 1) / BITS_PER_DIGIT_TYPE + 1;
-
-  // Initialize buf to zero.
-  vec_zero(buf_ndigits, buf);
-
-  if (sgn == SC_ZERO)
-    return;
-
-  const digit_type *digit_or_d;
-
-  if (sgn == SC_POS)
-    digit_or_d = digit;
-
-  else {
-
-#ifdef MAX_NBITS
-    digit_type d[MAX_NDIGITS];
-#else
-    digit_type *d = new digit_type[ndigits];
-#endif
-
-    // If sgn is negative, we have to convert digit to its 2's
-    // complement. Since this function is const, we can not do it on
-    // digit. Since buf doesn't have overflow bits, we cannot also do
-    // it on buf. Thus, we have to do the complementation on a copy of
-    // digit, i.e., on d.
-
-    vec_copy(ndigits, d, digit);
-    vec_complement(ndigits, d);
-
-    buf[buf_ndigits - 1] = ~((digit_type) 0);
-
-    digit_or_d = d;
-
-  }
-
-  // Copy the bits from digit to buf. The division and mod operations
-  // below can be converted to addition/subtraction and comparison
-  // operations at the expense of complicating the code. We can do it
-  // if we see any performance problems.
-
-  for (register length_type i = length() - 1; i >= 0; --i) {
-
-    if ((digit_or_d[digit_ord(i)] & one_and_zeros(bit_ord(i))) != 0) // Test.
-
-      buf[i / BITS_PER_DIGIT_TYPE] |= 
-        one_and_zeros(i % BITS_PER_DIGIT_TYPE); // Set.
-
-    else  
-
-      buf[i / BITS_PER_DIGIT_TYPE] &= 
-        ~(one_and_zeros(i % BITS_PER_DIGIT_TYPE));  // Clear.
 
-  }
-
-  if (sgn == SC_NEG) {
-#ifndef MAX_NBITS
-    delete [] digit_or_d;
-#endif
-  }
-  
+// Get the bits of the number as '0' and '1' characters, most
+// significant bit first. buf has room for length() characters; no
+// null character is appended.
+void
+CLASS_TYPE::get_bin_chars(char *buf) const
+{
+  vec_to_bin_chars(sgn, length(), digit, buf);
 }
 
 
@@ -3159,7 +3188,7 @@ CLASS_TYPE::CLASS_TYPE()
   ndigits = 1;
 
 #ifndef MAX_NBITS
-  digit = new digit_type[1];
+  alloc_digits();
 #endif
 
   digit[0] = 0;
@@ -3175,7 +3204,7 @@ CLASS_TYPE::CLASS_TYPE(const CLASS_TYPE& v, small_type s)
   ndigits = v.ndigits;
 
 #ifndef MAX_NBITS
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   vec_copy(ndigits, digit, v.digit);
@@ -3197,7 +3226,7 @@ CLASS_TYPE::CLASS_TYPE(const OTHER_CLASS_TYPE& v, small_type s)
 #endif
 
 #ifndef MAX_NBITS
-  digit = new digit_type[ndigits];
+  alloc_digits();
 #endif
 
   copy_digits(v.nbits, v.ndigits, v.digit);
@@ -3217,7 +3246,17 @@ CLASS_TYPE::CLASS_TYPE(small_type s, length_type nb,
   ndigits = DIV_CEIL(nbits);
 
 #ifndef MAX_NBITS
-  digit = new digit_type[ndigits];
+
+  // The result of an operator on wide numbers takes over the digits
+  // computed for it, instead of copying and deleting them. The digits
+  // past ndigits are left unused.
+  if (alloc && (ndigits > SMALL_NDIGITS) && (ndigits <= nd)) {
+    digit = d;
+    return;
+  }
+
+  alloc_digits();
+
 #endif
 
   if (ndigits <= nd)
@@ -3227,7 +3266,7 @@ CLASS_TYPE::CLASS_TYPE(small_type s, length_type nb,
 
 #ifndef MAX_NBITS
   if (alloc)
-    delete [] d;
+    vec_delete(d);
 #endif
 
 }
@@ -3274,7 +3313,7 @@ CLASS_TYPE::CLASS_TYPE(const CLASS_TYPE* u, length_type l, length_type r)
     ndigits = 1;
 
 #ifndef MAX_NBITS
-    digit = new digit_type[1];
+    alloc_digits();
 #endif
 
     digit[0] = 0;
@@ -3308,8 +3347,9 @@ CLASS_TYPE::CLASS_TYPE(const CLASS_TYPE* u, length_type l, length_type r)
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit = new digit_type[ndigits];
-  digit_type *d = new digit_type[nd];
+  alloc_digits();
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
   
   // Getting the range on the 2's complement representation.
@@ -3386,7 +3426,8 @@ CLASS_TYPE::CLASS_TYPE(const CLASS_TYPE* u, length_type l, length_type r)
   convert_2C_to_SM();
   
 #ifndef MAX_NBITS
-  delete [] d;
+  if (d != small_d)
+    vec_delete(d);
 #endif
   
 }
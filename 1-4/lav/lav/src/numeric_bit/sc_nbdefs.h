@@ -128,6 +128,15 @@ const length_type MAX_NDIGITS      = DIV_CEIL(MAX_NBITS) + 2;
 // DIV_CEIL(y) <= DIV_CEIL(MAX_NBITS) + 2. This is the reason for +2
 // above. With this change, MAX_NDIGITS must be enough to hold the
 // result of any operation.
+#else
+// Without MAX_NBITS, digits are allocated, except for numbers of at
+// most SMALL_NBITS bits, which keep their digits in the object, and
+// the temporary digits of operations on them, which are kept on the
+// stack. SMALL_NBITS covers a 128-bit sc_unsigned number, which has
+// an extra bit. A temporary may hold the product of two such numbers.
+const length_type SMALL_NBITS        = 129;
+const length_type SMALL_NDIGITS      = DIV_CEIL(SMALL_NBITS);
+const length_type SMALL_TEMP_NDIGITS = 2 * SMALL_NDIGITS;
 #endif
 
 // Support for the long long type. This type is not in the standard
@@ -140,6 +149,20 @@ typedef __int64             int64;
 typedef unsigned __int64   uint64;
 #endif
 
+// Type of the product of two digits, if the compiler has a type that
+// holds it. Then, the multiplication routines multiply whole digits
+// instead of half digits. For 32-bit digits, e.g. with MSVC, where a
+// long has 32 bits also on x64, this is the 64-bit integer, and the
+// compiler multiplies two digits in one instruction. For 64-bit
+// digits, it is the 128-bit integer of GNU compilers.
+#if ULONG_MAX == 0xffffffffUL
+#define SC_DOUBLE_DIGIT
+typedef uint64 double_digit_type;
+#elif defined(__SIZEOF_INT128__)
+#define SC_DOUBLE_DIGIT
+typedef unsigned __int128 double_digit_type;
+#endif
+
 // Bits per ...
 const length_type BITS_PER_CHAR   = BITS_PER_BYTE;
 const length_type BITS_PER_INT    = BITS_PER_BYTE * sizeof(int);
@@ -180,4 +203,165 @@ const small_type NB_DEFAULT_BASE = SC_DEC;
 #define LLWIDTH  BITS_PER_INT64
 #define INTWIDTH BITS_PER_INT
 
+// With C++14 constexpr, the value operations of sc_int and sc_uint
+// below can be evaluated at compile time, and fold to a few
+// instructions when W and the operands are constants.
+#if !defined(SC_CONSTEXPR)
+#if __cplusplus >= 201402L || (defined(_MSC_VER) && _MSC_VER >= 1910)
+#define SC_CONSTEXPR constexpr
+#else
+#define SC_CONSTEXPR
+#endif
+#endif
+
+// Return the low w bits of v, sign extended. The left shift is done
+// unsigned, which is also defined for negative v.
+inline SC_CONSTEXPR int64
+sign_extend64(int64 v, int w)
+{
+  return (int64) ((uint64) v << (LLWIDTH - w)) >> (LLWIDTH - w);
+}
+
+inline SC_CONSTEXPR int
+sign_extend32(int v, int w)
+{
+  return (int) ((unsigned int) v << (INTWIDTH - w)) >> (INTWIDTH - w);
+}
+
+// Return the mask of bits left down to right, left >= right, that a
+// part-select of sc_int or sc_uint replaces. With constant bounds,
+// the mask folds into a constant.
+inline SC_CONSTEXPR uint64 
+range_mask64(int left, int right)
+{
+  return (~((uint64) 0) >> (LLWIDTH - 1 - left)) & (~((uint64) 0) << right);
+}
+
+inline SC_CONSTEXPR unsigned int
+range_mask32(int left, int right)
+{
+  return (~0U >> (INTWIDTH - 1 - left)) & (~0U << right);
+}
+
+// Return x with its bits in reverse order, for part-selects with left
+// < right. ones / 3, ones / 5, ... are the masks 0x55..., 0x33..., 
+// 0x0f..., 0x00ff..., and 0x0000ffff....
+inline SC_CONSTEXPR uint64
+reverse_bits64(uint64 x)
+{
+  const uint64 ones = ~((uint64) 0);
+
+  x = ((x >> 1) & (ones / 3)) | ((x & (ones / 3)) << 1);
+  x = ((x >> 2) & (ones / 5)) | ((x & (ones / 5)) << 2);
+  x = ((x >> 4) & (ones / 17)) | ((x & (ones / 17)) << 4);
+  x = ((x >> 8) & (ones / 257)) | ((x & (ones / 257)) << 8);
+  x = ((x >> 16) & (ones / 65537)) | ((x & (ones / 65537)) << 16);
+
+  return (x >> 32) | (x << 32);
+}
+
+inline SC_CONSTEXPR unsigned int
+reverse_bits32(unsigned int x)
+{
+  x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+  x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+  x = ((x >> 4) & 0x0f0f0f0fU) | ((x & 0x0f0f0f0fU) << 4);
+  x = ((x >> 8) & 0x00ff00ffU) | ((x & 0x00ff00ffU) << 8);
+
+  return (x >> 16) | (x << 16);
+}
+
+// Field access for the part-select proxies of sc_int and sc_uint.
+// These run only at simulation time, so with BMI2 enabled at compile
+// time, e.g. g++ -mbmi2 or cl /arch:AVX2, they use bzhi to cut a field
+// to its width. Define SC_NO_BMI2 to keep the portable shifts.
+#if !defined(SC_NO_BMI2) && \
+    (defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#include <immintrin.h>
+#define SC_BMI2
+#endif
+
+// Return the bits left down to right of x, left >= right, in the low
+// bits.
+inline uint64
+get_field64(uint64 x, int left, int right)
+{
+#ifdef SC_BMI2
+  return _bzhi_u64(x >> right, left - right + 1);
+#else
+  return (x << (LLWIDTH - 1 - left)) >> (LLWIDTH - 1 - left + right);
+#endif
+}
+
+inline unsigned int
+get_field32(unsigned int x, int left, int right)
+{
+#ifdef SC_BMI2
+  return _bzhi_u32(x >> right, left - right + 1);
+#else
+  return (x << (INTWIDTH - 1 - left)) >> (INTWIDTH - 1 - left + right);
+#endif
+}
+
+// As get_field64(), with the field sign extended.
+inline int64
+get_signed_field64(int64 x, int left, int right)
+{
+  return (int64) ((uint64) x << (LLWIDTH - 1 - left)) >> (LLWIDTH - 1 - left + right);
+}
+
+inline int
+get_signed_field32(int x, int left, int right)
+{
+  return (int) ((unsigned int) x << (INTWIDTH - 1 - left)) >> (INTWIDTH - 1 - left + right);
+}
+
+// Return x with its bits left down to right, left >= right, replaced
+// by the low bits of v. If left < right, the mask is empty and x is
+// returned.
+inline uint64
+set_field64(uint64 x, uint64 v, int left, int right)
+{
+#ifdef SC_BMI2
+  uint64 mask = _bzhi_u64(~((uint64) 0) << right, left + 1);
+#else
+  uint64 mask = range_mask64(left, right);
+#endif
+  return (x & ~mask) | ((v << right) & mask);
+}
+
+inline unsigned int
+set_field32(unsigned int x, unsigned int v, int left, int right)
+{
+#ifdef SC_BMI2
+  unsigned int mask = _bzhi_u32(~0U << right, left + 1);
+#else
+  unsigned int mask = range_mask32(left, right);
+#endif
+  return (x & ~mask) | ((v << right) & mask);
+}
+
+// Reversed fields, left < right: bit i of the field is bit right - i
+// of x. They are rare, so these are out of line (sc_int_range.cpp) and
+// keep the inline code of the forward fields short. They read and
+// write no memory, which SC_CONST_FUNCTION tells the compiler, so that
+// a call on the reversed path does not make it reload the operands of
+// the forward path.
+#if defined(__GNUC__)
+#define SC_CONST_FUNCTION __attribute__((const))
+#elif defined(_MSC_VER)
+#define SC_CONST_FUNCTION __declspec(noalias)
+#else
+#define SC_CONST_FUNCTION
+#endif
+
+extern SC_CONST_FUNCTION uint64
+get_reversed_field64(uint64 x, int left, int right);
+extern SC_CONST_FUNCTION unsigned int
+get_reversed_field32(unsigned int x, int left, int right);
+extern SC_CONST_FUNCTION uint64
+set_reversed_field64(uint64 x, uint64 v, int left, int right);
+extern SC_CONST_FUNCTION unsigned int
+set_reversed_field32(unsigned int x, unsigned int v, int left, int right);
+
 #endif
@@ -152,7 +152,8 @@ mul_on_help(small_type &us,
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
   
   vec_zero(nd, d);
@@ -172,7 +173,8 @@ mul_on_help(small_type &us,
   COPY_DIGITS(us, unb, old_und, ud, unb + vnb, nd, d);
   
 #ifndef MAX_NBITS
-  delete [] d;
+  if (d != small_d)
+    vec_delete(d);
 #endif
 
 }
@@ -224,7 +226,8 @@ mul_on_help_signed(small_type &us,
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
   
     vec_zero(nd, d);
@@ -244,7 +247,8 @@ mul_on_help_signed(small_type &us,
     COPY_DIGITS(us, unb, old_und, ud, unb + vnb, nd, d);
     
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
     
   }
@@ -299,7 +303,8 @@ mul_on_help_unsigned(small_type &us,
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
   
     vec_zero(nd, d);
@@ -319,7 +324,8 @@ mul_on_help_unsigned(small_type &us,
     COPY_DIGITS(us, unb, old_und, ud, unb + vnb, nd, d);
     
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
     
   }
@@ -372,7 +378,8 @@ div_on_help(small_type &us,
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS + 1];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
   vec_zero(nd, d);
@@ -393,7 +400,8 @@ div_on_help(small_type &us,
   COPY_DIGITS(us, unb, old_und, ud, MAXT(unb, vnb), nd - 1, d);
 
 #ifndef MAX_NBITS
-  delete [] d;
+  if (d != small_d)
+    vec_delete(d);
 #endif
 
 }
@@ -439,7 +447,8 @@ div_on_help_signed(small_type &us,
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS + 1];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -460,7 +469,8 @@ div_on_help_signed(small_type &us,
     COPY_DIGITS(us, unb, old_und, ud, MAXT(unb, vnb), nd - 1, d);
     
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
     
   }
@@ -509,7 +519,8 @@ div_on_help_unsigned(small_type &us,
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS + 1];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -530,7 +541,8 @@ div_on_help_unsigned(small_type &us,
     COPY_DIGITS(us, unb, old_und, ud, MAXT(unb, vnb), nd - 1, d);
     
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
     
   }
@@ -591,7 +603,8 @@ mod_on_help(small_type &us,
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS + 1];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
   vec_zero(nd, d);
@@ -613,7 +626,8 @@ mod_on_help(small_type &us,
     COPY_DIGITS(us, unb, old_und, ud, MINT(unb, vnd), nd - 1, d);
 
 #ifndef MAX_NBITS
-  delete [] d;
+  if (d != small_d)
+    vec_delete(d);
 #endif
   
 }
@@ -667,7 +681,8 @@ mod_on_help_signed(small_type &us,
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS + 1];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -689,7 +704,8 @@ mod_on_help_signed(small_type &us,
       COPY_DIGITS(us, unb, old_und, ud, MINT(unb, vnd), nd - 1, d);
     
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
     
   }
@@ -745,7 +761,8 @@ mod_on_help_unsigned(small_type &us,
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS + 1];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -767,7 +784,8 @@ mod_on_help_unsigned(small_type &us,
       COPY_DIGITS(us, unb, old_und, ud, MINT(unb, vnd), nd - 1, d);
     
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
     
   }
@@ -75,7 +75,8 @@ ADD_HELPER(small_type us, length_type unb, length_type und,
   test_bound(nb);
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
   
   d[nd - 1] = d[nd - 2] = 0;
@@ -104,8 +105,13 @@ ADD_HELPER(small_type us, length_type unb, length_type und,
 
     length_type cmp_res = vec_cmp(und, ud, vnd, vd);
     
-    if (cmp_res == 0) // u == v
+    if (cmp_res == 0) { // u == v
+#ifndef MAX_NBITS
+      if (d != small_d)
+        vec_delete(d);
+#endif
       return CLASS_TYPE();
+    }
     
     if (cmp_res > 0)  { // u > v
 
@@ -127,7 +133,11 @@ ADD_HELPER(small_type us, length_type unb, length_type und,
     }
   }
   
+#ifdef MAX_NBITS
   return CLASS_TYPE(us, nb, nd, d);
+#else
+  return CLASS_TYPE(us, nb, nd, d, (d != small_d));
+#endif
   
 }
 
@@ -155,7 +165,8 @@ MUL_HELPER(small_type s,
   test_bound(nb);
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
   vec_zero(nd, d);
@@ -185,7 +196,11 @@ MUL_HELPER(small_type s,
   else
     vec_mul(vnd, vd, und, ud, d);
   
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, nb, nd, d);
+#else
+  return CLASS_TYPE(s, nb, nd, d, (d != small_d));
+#endif
 
 }
 
@@ -218,7 +233,8 @@ DIV_HELPER(small_type s,
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS + 1];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
   vec_zero(nd, d);
@@ -243,7 +259,11 @@ DIV_HELPER(small_type s,
   else
     vec_div_large(und, ud, vnd, vd, d);
 
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, MAXT(unb, vnb), nd - 1, d);
+#else
+  return CLASS_TYPE(s, MAXT(unb, vnb), nd - 1, d, (d != small_d));
+#endif
   
 }
 
@@ -281,7 +301,8 @@ MOD_HELPER(small_type us,
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS + 1];
 #else
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
   vec_zero(nd, d);
@@ -303,10 +324,19 @@ MOD_HELPER(small_type us,
 
   us = check_for_zero(us, nd - 1, d);
 
-  if (us == SC_ZERO)
+  if (us == SC_ZERO) {
+#ifndef MAX_NBITS
+    if (d != small_d)
+      vec_delete(d);
+#endif
     return CLASS_TYPE();
+  }
   else
+#ifdef MAX_NBITS
     return CLASS_TYPE(us, MINT(unb, vnb), nd - 1, d);
+#else
+    return CLASS_TYPE(us, MINT(unb, vnb), nd - 1, d, (d != small_d));
+#endif
 
 }
 
@@ -331,7 +361,8 @@ AND_HELPER(small_type us,
 #ifdef MAX_NBITS
   digit_type dbegin[MAX_NDIGITS];
 #else
-  digit_type *dbegin = new digit_type[nd];
+  digit_type small_dbegin[SMALL_TEMP_NDIGITS];
+  digit_type *dbegin = (nd <= SMALL_TEMP_NDIGITS) ? small_dbegin : vec_new(nd);
 #endif
 
   digit_type *d = dbegin;
@@ -438,7 +469,11 @@ AND_HELPER(small_type us,
 
   s = convert_signed_2C_to_SM(nb, nd, dbegin);
 
-  return CLASS_TYPE(s, nb, nd, dbegin);  
+#ifdef MAX_NBITS
+  return CLASS_TYPE(s, nb, nd, dbegin);
+#else
+  return CLASS_TYPE(s, nb, nd, dbegin, (dbegin != small_dbegin));
+#endif
 
 }
 
@@ -463,7 +498,8 @@ OR_HELPER(small_type us,
 #ifdef MAX_NBITS
   digit_type dbegin[MAX_NDIGITS];
 #else
-  digit_type *dbegin = new digit_type[nd];
+  digit_type small_dbegin[SMALL_TEMP_NDIGITS];
+  digit_type *dbegin = (nd <= SMALL_TEMP_NDIGITS) ? small_dbegin : vec_new(nd);
 #endif
 
   digit_type *d = dbegin;
@@ -574,7 +610,11 @@ OR_HELPER(small_type us,
 
   s = convert_signed_2C_to_SM(nb, nd, dbegin);
 
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, nb, nd, dbegin);
+#else
+  return CLASS_TYPE(s, nb, nd, dbegin, (dbegin != small_dbegin));
+#endif
 
 }
 
@@ -599,7 +639,8 @@ XOR_HELPER(small_type us,
 #ifdef MAX_NBITS
   digit_type dbegin[MAX_NDIGITS];
 #else
-  digit_type *dbegin = new digit_type[nd];
+  digit_type small_dbegin[SMALL_TEMP_NDIGITS];
+  digit_type *dbegin = (nd <= SMALL_TEMP_NDIGITS) ? small_dbegin : vec_new(nd);
 #endif
 
   digit_type *d = dbegin;
@@ -708,7 +749,11 @@ XOR_HELPER(small_type us,
 
   s = convert_signed_2C_to_SM(nb, nd, dbegin);
 
+#ifdef MAX_NBITS
   return CLASS_TYPE(s, nb, nd, dbegin);
+#else
+  return CLASS_TYPE(s, nb, nd, dbegin, (dbegin != small_dbegin));
+#endif
 
 }
 
@@ -37,6 +37,7 @@
 
 
 #include <ctype.h>
+#include <string.h>
 #include "sc_nbutils.h"
 
 /////////////////////////////////////////////////////////////////////////////
@@ -165,6 +166,562 @@ const char
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+// SECTION: Allocation of vectors.
+/////////////////////////////////////////////////////////////////////////////
+
+// A vector from vec_new() has a power-of-two number of digits, at
+// least 2^VEC_NEW_MIN_CLASS, and its size class in the digit before
+// it. Up to VEC_NEW_CACHE_SIZE released vectors of each class up to
+// VEC_NEW_MAX_CLASS are kept; larger vectors cost little to allocate
+// next to the operations on them, and go back to the heap. As in
+// sc_mempool, each thread keeps its own vectors, so that no lock is
+// taken, and frees them when it exits.
+
+#if defined(_MSC_VER)
+#define SC_NB_TLS __declspec(thread)
+#else
+#define SC_NB_TLS __thread
+#include <pthread.h>
+#endif
+
+const int VEC_NEW_MIN_CLASS  = 3;     // 8 digits
+const int VEC_NEW_MAX_CLASS  = 12;    // 4096 digits
+const int VEC_NEW_CACHE_SIZE = 8;
+
+struct vec_cache {
+  int count[VEC_NEW_MAX_CLASS + 1];
+  digit_type *free[VEC_NEW_MAX_CLASS + 1][VEC_NEW_CACHE_SIZE];
+};
+
+static SC_NB_TLS vec_cache vec_released;
+
+// True once vec_release_thread() is set to run when this thread exits.
+static SC_NB_TLS bool vec_thread_guarded;
+
+static void vec_guard_thread();
+
+digit_type *
+vec_new(length_type n)
+{
+
+  int c = VEC_NEW_MIN_CLASS;
+  while ((c <= VEC_NEW_MAX_CLASS) && ((((length_type) 1) << c) < n))
+    ++c;
+
+  digit_type *d;
+
+  if (c > VEC_NEW_MAX_CLASS)
+    d = new digit_type[n + 1];
+
+  else {
+
+    vec_cache &cache = vec_released;
+
+    if (cache.count[c] > 0)
+      return cache.free[c][--cache.count[c]];
+
+    d = new digit_type[(((length_type) 1) << c) + 1];
+
+  }
+
+  d[0] = c;
+
+  return d + 1;
+
+}
+
+void
+vec_delete(digit_type *d)
+{
+
+  int c = (int) d[-1];
+
+  if (c <= VEC_NEW_MAX_CLASS) {
+
+    vec_cache &cache = vec_released;
+
+    if (cache.count[c] < VEC_NEW_CACHE_SIZE) {
+      if (! vec_thread_guarded)
+        vec_guard_thread();
+      cache.free[c][cache.count[c]++] = d;
+      return;
+    }
+
+  }
+
+  delete [] (d - 1);
+
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+// SECTION: Conversion between vectors and strings of digits.
+/////////////////////////////////////////////////////////////////////////////
+
+// Digits in bases 2, 8, and 16 are sliced from, or put into, the bits
+// of a vector. Digits in base 10 are converted DEC_CHUNK at a time,
+// by a division or a multiplication by DEC_CHUNK_RADIX =
+// 10^DEC_CHUNK, the largest power of ten that vec_rem_on_small() and
+// vec_mul_small_on() take. Longer numbers are converted by divide and
+// conquer: a number is split into a quotient and a remainder by a
+// power 10^(DEC_CHUNK * 2^i), or a string into a high and a low part
+// of DEC_CHUNK * 2^i digits, and the two halves are converted
+// separately. The powers are computed when first needed and kept, by
+// each thread for itself, like the vectors above. The thresholds were
+// measured for 62-bit digits.
+const length_type DEC_CHUNK       = (BITS_PER_HALF_DIGIT >= 30) ? 9 : 4;
+const digit_type  DEC_CHUNK_RADIX = (BITS_PER_HALF_DIGIT >= 30) ? 1000000000 : 10000;
+
+const length_type VEC_TO_STR_DC_THRESHOLD   = 12;   // digits
+const length_type VEC_FROM_STR_DC_THRESHOLD = 150;  // chars
+
+// dec_pow[i] = 10^(DEC_CHUNK * 2^i) has dec_pow_len[i] digits.
+// dec_inv[i], of dec_pow_len[i] + 1 digits, is the inverse of
+// dec_pow[i] for vec_div_barrett(). With MAX_NBITS, numbers are too
+// short to gain from divide and conquer.
+const int DEC_POW_MAX = 32;
+static SC_NB_TLS digit_type  *dec_pow[DEC_POW_MAX];
+static SC_NB_TLS length_type  dec_pow_len[DEC_POW_MAX];
+#ifndef MAX_NBITS
+static SC_NB_TLS digit_type  *dec_inv[DEC_POW_MAX];
+#endif
+
+// Free the vectors and powers that this thread keeps. This runs when
+// the thread exits: with MSVC, from the destructor of a thread_local
+// object, and elsewhere from the destructor of a pthread key. Neither
+// runs when a fiber is deleted, so the processes of a simulation,
+// which may be fibers of one thread, share its vectors.
+static void
+vec_release_thread(void *)
+{
+
+  vec_cache &cache = vec_released;
+
+  for (int c = VEC_NEW_MIN_CLASS; c <= VEC_NEW_MAX_CLASS; ++c)
+    while (cache.count[c] > 0)
+      delete [] (cache.free[c][--cache.count[c]] - 1);
+
+  for (int i = 0; i < DEC_POW_MAX; ++i) {
+    delete [] dec_pow[i];
+    dec_pow[i] = 0;
+#ifndef MAX_NBITS
+    delete [] dec_inv[i];
+    dec_inv[i] = 0;
+#endif
+  }
+
+#if !defined(_MSC_VER)
+  // A pthread key destructor runs again if the key is set again.
+  vec_thread_guarded = false;
+#endif
+
+}
+
+#if defined(_MSC_VER)
+
+struct vec_thread_guard {
+  bool armed;
+  ~vec_thread_guard() { if (armed) vec_release_thread(0); }
+};
+
+static thread_local vec_thread_guard vec_guard;
+
+#else
+
+static pthread_key_t  vec_key;
+static pthread_once_t vec_key_once = PTHREAD_ONCE_INIT;
+
+static void
+vec_make_key()
+{
+  pthread_key_create(&vec_key, vec_release_thread);
+}
+
+#endif
+
+// Make vec_release_thread() run when this thread exits.
+static void
+vec_guard_thread()
+{
+
+  vec_thread_guarded = true;
+
+#if defined(_MSC_VER)
+  vec_guard.armed = true;
+#else
+  pthread_once(&vec_key_once, vec_make_key);
+  pthread_setspecific(vec_key, &vec_thread_guarded);
+#endif
+
+}
+
+// Compute w = u * v, where ulen and vlen are both positive.
+// - w has ulen + vlen digits.
+static void
+vec_mul_any(length_type ulen, const digit_type *u,
+            length_type vlen, const digit_type *v, digit_type *w)
+{
+  vec_zero(ulen + vlen, w);
+
+  if (ulen >= vlen)
+    vec_mul(ulen, u, vlen, v, w);
+  else
+    vec_mul(vlen, v, ulen, u, w);
+}
+
+static void
+make_dec_pow(int i)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert((0 <= i) && (i < DEC_POW_MAX));
+#endif
+
+  if (dec_pow[i])
+    return;
+
+  if (i == 0) {
+    if (! vec_thread_guarded)
+      vec_guard_thread();
+    dec_pow[0] = new digit_type[1];
+    dec_pow[0][0] = DEC_CHUNK_RADIX;
+    dec_pow_len[0] = 1;
+    return;
+  }
+
+  make_dec_pow(i - 1);
+
+  length_type n = dec_pow_len[i - 1];
+  digit_type *w = new digit_type[2 * n];
+
+  vec_mul_any(n, dec_pow[i - 1], n, dec_pow[i - 1], w);
+
+  dec_pow[i] = w;
+  dec_pow_len[i] = vec_skip_leading_zeros(2 * n, w);
+
+}
+
+// Reverse the n chars of v.
+static void
+reverse_chars(length_type n, char *v)
+{
+  for (register length_type i = 0, j = n - 1; i < j; ++i, --j) {
+    char c = v[i];
+    v[i] = v[j];
+    v[j] = c;
+  }
+}
+
+// Set v = the decimal digits of u, a chunk at a time, and return
+// their number. If width is positive, there are width digits, with
+// leading zeros; otherwise, there are no leading zeros, and zero has
+// one digit. u is destroyed.
+static length_type
+vec_to_dec_basecase(length_type ulen, digit_type *u, const char *xdigs,
+                    char *v, length_type width)
+{
+
+  register length_type n = 0;
+
+  while (ulen) {
+
+    digit_type r = vec_rem_on_small(ulen, u, DEC_CHUNK_RADIX);
+
+    ulen = vec_skip_leading_zeros(ulen, u);
+
+    // Only the last chunk is not padded.
+    for (length_type j = 0; (j < DEC_CHUNK) && (ulen || r); ++j) {
+      v[n++] = xdigs[r % 10];
+      r /= 10;
+    }
+
+  }
+
+  while (n < width)
+    v[n++] = xdigs[0];
+
+  if (n == 0)
+    v[n++] = xdigs[0];
+
+  reverse_chars(n, v);
+
+  return n;
+
+}
+
+#ifndef MAX_NBITS
+
+static void
+make_dec_inv(int i)
+{
+
+  if (dec_inv[i])
+    return;
+
+  make_dec_pow(i);
+
+  dec_inv[i] = new digit_type[dec_pow_len[i] + 1];
+
+  vec_barrett_inverse(dec_pow_len[i], dec_pow[i], dec_inv[i]);
+
+}
+
+// Same as vec_to_dec_basecase(), where u < dec_pow[i + 1].
+static length_type
+vec_to_dec(length_type ulen, digit_type *u, int i, const char *xdigs,
+           char *v, length_type width)
+{
+
+  if (ulen)
+    ulen = vec_skip_leading_zeros(ulen, u);
+
+  if ((i < 0) || (ulen < VEC_TO_STR_DC_THRESHOLD))
+    return vec_to_dec_basecase(ulen, u, xdigs, v, width);
+
+  length_type m = dec_pow_len[i];
+
+  if ((width <= 0) && (vec_cmp(ulen, u, m, dec_pow[i]) < 0))
+    return vec_to_dec(ulen, u, i - 1, xdigs, v, width);
+
+  // The remainder has DEC_CHUNK * 2^i digits, and the quotient the
+  // rest.
+  length_type rwidth = DEC_CHUNK << i;
+
+  digit_type *q = vec_new(m + 1);
+
+  make_dec_inv(i);
+
+  length_type qlen = vec_div_barrett(ulen, u, m, dec_pow[i], dec_inv[i], q);
+
+  length_type n = vec_to_dec(qlen, q, i - 1, xdigs, v,
+                             (width > 0) ? width - rwidth : 0);
+
+  vec_delete(q);
+
+  return n + vec_to_dec(MINT(ulen, m), u, i - 1, xdigs, v + n, rwidth);
+
+}
+
+#endif
+
+// Set v = the digits of u in base b, b in 2, 8, and 16, without
+// leading zeros, and return their number.
+static length_type
+vec_to_pow2(length_type ulen, const digit_type *u, length_type lg,
+            const char *xdigs, char *v)
+{
+
+  if (ulen == 0) {
+    v[0] = xdigs[0];
+    return 1;
+  }
+
+  length_type nb = (ulen - 1) * BITS_PER_DIGIT;
+
+  for (digit_type d = u[ulen - 1]; d; d >>= 1)
+    ++nb;
+
+  const length_type n = DIV_CEIL2(nb, lg);
+  const digit_type mask = one_and_ones(lg);
+
+  for (register length_type j = 0, i = (n - 1) * lg; j < n; ++j, i -= lg) {
+
+    length_type k = digit_ord(i);
+    length_type s = bit_ord(i);
+
+    digit_type d = u[k] >> s;
+
+    if ((s + lg > (length_type) BITS_PER_DIGIT) && (k + 1 < ulen))
+      d |= u[k + 1] << (BITS_PER_DIGIT - s);
+
+    v[j] = xdigs[d & mask];
+
+  }
+
+  return n;
+
+}
+
+// Set v = the digits of u in base b, most significant first, as the
+// chars xdigs[0 .. b - 1], and return their number. Zero has one
+// digit. v is not null-terminated, and u is destroyed.
+// - b is 2, 8, 10, or 16.
+length_type
+vec_to_str(length_type ulen, digit_type *u, small_type b,
+           const char *xdigs, char *v)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert((ulen > 0) && (u != NULL));
+  assert((xdigs != NULL) && (v != NULL));
+#endif
+
+  ulen = vec_skip_leading_zeros(ulen, u);
+
+  switch (b) {
+  case SC_BIN: return vec_to_pow2(ulen, u, 1, xdigs, v);
+  case SC_OCT: return vec_to_pow2(ulen, u, 3, xdigs, v);
+  case SC_HEX: return vec_to_pow2(ulen, u, 4, xdigs, v);
+  default: break;
+  }
+
+#ifdef DEBUG_SYSTEMC
+  assert(b == SC_DEC);
+#endif
+
+#ifdef MAX_NBITS
+
+  return vec_to_dec_basecase(ulen, u, xdigs, v, 0);
+
+#else
+
+  if (ulen < VEC_TO_STR_DC_THRESHOLD)
+    return vec_to_dec_basecase(ulen, u, xdigs, v, 0);
+
+  // Split by the largest power whose square exceeds u.
+  int i = 0;
+
+  make_dec_pow(1);
+
+  while (dec_pow_len[i + 1] <= ulen)
+    make_dec_pow(++i + 1);
+
+  return vec_to_dec(ulen, u, i, xdigs, v, 0);
+
+#endif
+
+}
+
+// Numeric value of a digit char, which is alphanumeric.
+inline
+digit_type
+char_value(char c)
+{
+  return ((c <= '9') ? (c - '0') : ((c | 0x20) - 'a' + 10));
+}
+
+// Set u = the number of the n digits in v, in base b, b in 2, 8, and
+// 16. The digits that do not fit into u are ignored.
+static void
+vec_from_pow2(length_type und, digit_type *u, const char *v,
+              length_type n, length_type lg)
+{
+
+  vec_zero(und, u);
+
+  const length_type nb = und * BITS_PER_DIGIT;
+
+  for (register length_type i = 0; (n > 0) && (i < nb); i += lg) {
+
+    digit_type val = char_value(v[--n]);
+
+    length_type k = digit_ord(i);
+    length_type s = bit_ord(i);
+
+    u[k] |= (val << s) & DIGIT_MASK;
+
+    if ((s + lg > (length_type) BITS_PER_DIGIT) && (k + 1 < und))
+      u[k + 1] |= val >> (BITS_PER_DIGIT - s);
+
+  }
+
+}
+
+// Set u = the number of the n decimal digits in v, a chunk at a time,
+// modulo DIGIT_RADIX^und.
+static void
+vec_from_dec_basecase(length_type und, digit_type *u, const char *v,
+                      length_type n)
+{
+
+  vec_zero(und, u);
+
+  // The first chunk takes the digits left over by the others.
+  length_type k = n % DEC_CHUNK;
+
+  if (k == 0)
+    k = DEC_CHUNK;
+
+  for ( ; n > 0; n -= k, k = DEC_CHUNK) {
+
+    digit_type val = 0;
+    digit_type radix = 1;
+
+    for (length_type j = 0; j < k; ++j) {
+      val = val * 10 + (*v++ - '0');
+      radix *= 10;
+    }
+
+    // digit = digit * radix + val;
+    vec_mul_small_on(und, u, radix);
+
+    if (val)
+      vec_add_small_on(und, u, val);
+
+  }
+
+}
+
+// The number of digits that hold a number of n decimal digits, and
+// the product of its two parts in vec_from_dec().
+inline
+length_type
+dec_to_digits(length_type n)
+{
+  return DIV_CEIL(4 * n) + 1;
+}
+
+// Set w = the number of the n decimal digits in v, and return the
+// number of its digits without leading zeros.
+// - w has dec_to_digits(n) digits.
+static length_type
+vec_from_dec(digit_type *w, const char *v, length_type n)
+{
+
+  length_type wlen = dec_to_digits(n);
+
+  if (n < VEC_FROM_STR_DC_THRESHOLD) {
+    vec_from_dec_basecase(wlen, w, v, n);
+    return vec_skip_leading_zeros(wlen, w);
+  }
+
+  // The low part has DEC_CHUNK * 2^i digits, the largest such number
+  // below n, and the high part the rest: w = high * dec_pow[i] + low.
+  int i = 0;
+
+  while ((DEC_CHUNK << (i + 1)) < n)
+    ++i;
+
+  make_dec_pow(i);
+
+  length_type lown = DEC_CHUNK << i;
+
+  digit_type *t = vec_new(dec_to_digits(n - lown));
+
+  length_type tlen = vec_from_dec(t, v, n - lown);
+
+  if (tlen)
+    vec_mul_any(tlen, t, dec_pow_len[i], dec_pow[i], w);
+
+  vec_zero(tlen ? tlen + dec_pow_len[i] : 0, wlen, w);
+
+  vec_delete(t);
+
+  t = vec_new(dec_to_digits(lown));
+
+  tlen = vec_from_dec(t, v + n - lown, lown);
+
+  if (tlen)
+    vec_add_on(wlen, w, tlen, t);
+
+  vec_delete(t);
+
+  return vec_skip_leading_zeros(wlen, w);
+
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 // SECTION: Utility functions involving unsigned vectors.
 /////////////////////////////////////////////////////////////////////////////
@@ -197,43 +754,49 @@ vec_from_str(length_type unb, length_type und, digit_type *u,
     }
   }
 
-  vec_zero(und, u);
-
   char c;
+  length_type n = 0;
 
 #if defined(__BCPLUSPLUS__)
 #pragma warn -pia
 #endif
-  
-  for ( ; (c = *v); ++v) {
+
+  // Check the digits before converting them.
+  for ( ; (c = v[n]); ++n) {
 
     if (isalnum(c)) {
       
-      small_type val;  // Numeric value of a char.
-    
-      if (isalpha(c)) // Hex digit.
-        val = toupper(c) - 'A' + 10;
-      else
-        val = c - '0';
-      
-      if (val >= b) {
-        printf("SystemC error: %c is not a valid digit in base %d\n", *v, b);
+      if (char_value(c) >= (digit_type) b) {
+        printf("SystemC error: %c is not a valid digit in base %d\n", c, b);
         abort();
       }
-      
-      // digit = digit * b + val;
-      vec_mul_small_on(und, u, b);
-      
-      if (val)
-        vec_add_small_on(und, u, val);
 
     }
     else {
-      printf("SystemC error: %c is not a valid digit in base %d\n", *v, b);
+      printf("SystemC error: %c is not a valid digit in base %d\n", c, b);
       abort();
     }
   }
 
+  switch (b) {
+  case SC_BIN: vec_from_pow2(und, u, v, n, 1); break;
+  case SC_OCT: vec_from_pow2(und, u, v, n, 3); break;
+  case SC_HEX: vec_from_pow2(und, u, v, n, 4); break;
+  default:
+    if (n < VEC_FROM_STR_DC_THRESHOLD)
+      vec_from_dec_basecase(und, u, v, n);
+    else {
+      // The digits that do not fit into u are ignored.
+      digit_type *w = vec_new(dec_to_digits(n));
+      length_type wlen = vec_from_dec(w, v, n);
+      vec_zero(und, u);
+      if (wlen)
+        vec_copy(MINT(und, wlen), u, w);
+      vec_delete(w);
+    }
+    break;
+  }
+
   return convert_signed_SM_to_2C_to_SM(s, unb, und, u);
   
 }
@@ -596,11 +1159,13 @@ vec_sub_small_on(length_type ulen, digit_type *u, digit_type v)
 
 }
 
-// Compute w = u * v, where w, u, and v are vectors.
+// Compute w = u * v, where w, u, and v are vectors, by the schoolbook
+// method.
+// - w has ulen + vlen digits, all zero.
 void
-vec_mul(length_type ulen, const digit_type *u,
-        length_type vlen, const digit_type *vbegin, 
-        digit_type *wbegin)
+vec_mul_basecase(length_type ulen, const digit_type *u,
+                 length_type vlen, const digit_type *vbegin, 
+                 digit_type *wbegin)
 {
 
   /* Consider u = Ax + B and v = Cx + D where x is equal to
@@ -665,6 +1230,46 @@ vec_mul(length_type ulen, const digit_type *u,
   assert(wbegin != NULL);
 #endif
 
+#ifdef SC_DOUBLE_DIGIT
+
+  // The product of two digits plus two more digits fits into a
+  // double_digit_type, so whole digits are multiplied, and the carry
+  // is the part of the product above BITS_PER_DIGIT.
+
+  const digit_type *uend = (u + ulen);
+  const digit_type *vend = (vbegin + vlen);
+
+  while (u < uend) {
+
+    register double_digit_type u_i = (*u++);
+
+#ifdef DEBUG_SYSTEMC
+    // The overflow bits must be zero.
+    assert(u_i == (u_i & DIGIT_MASK));
+#endif
+
+    register digit_type carry = 0;
+
+    register digit_type *w = (wbegin++);
+
+    register const digit_type *v = vbegin;
+
+    while (v < vend) {
+
+      double_digit_type prod = u_i * (*v++) + (*w) + carry;
+
+      (*w++) = ((digit_type) prod) & DIGIT_MASK;
+
+      carry = (digit_type) (prod >> BITS_PER_DIGIT);
+
+    }
+
+    (*w) = carry;
+
+  }
+
+#else
+
 #define prod_h carry
 
   const digit_type *uend = (u + ulen);
@@ -701,19 +1306,377 @@ vec_mul(length_type ulen, const digit_type *u,
 
       digit_type prod_l = (*w) + u_l * v_l + low_half(carry);
 
-      prod_h = u_h * v_l + u_l * v_h + high_half(prod_l) + high_half(carry);
+      prod_h = u_h * v_l + u_l * v_h + high_half(prod_l) + high_half(carry);
+
+      (*w++) = concat(low_half(prod_h), low_half(prod_l));
+
+      carry = u_h * v_h + high_half(prod_h);
+
+    }
+
+    (*w) = carry;
+
+  }
+
+#undef prod_h
+
+#endif
+
+}
+
+// Multiplication of long vectors. Below VEC_MUL_KARATSUBA_THRESHOLD
+// digits, vec_mul() uses vec_mul_basecase(); below
+// VEC_MUL_TOOM3_THRESHOLD digits, Karatsuba's method splits the
+// operands in two halves, and above it, Toom-3 splits them in three
+// thirds. The recursive functions multiply operands of the same
+// length n and overwrite the 2n digits of w. Their temporaries are
+// taken from a scratch area of vec_mul_scratch(n) digits, so that
+// vec_mul() allocates only once.
+
+static void
+vec_mul_n(length_type n, const digit_type *u, const digit_type *v,
+          digit_type *w, digit_type *scratch);
+
+// Return the number of scratch digits that vec_mul_n() needs for
+// operands of n digits.
+static length_type
+vec_mul_scratch(length_type n)
+{
+  if (n < VEC_MUL_KARATSUBA_THRESHOLD)
+    return 0;
+
+  if (n < VEC_MUL_TOOM3_THRESHOLD) {
+    length_type k = n - n / 2;
+    return 6 * k + 1 + vec_mul_scratch(k);
+  }
+
+  length_type k = (n + 2) / 3;
+  length_type m = k + 1;
+  return 19 * m + MAXT(vec_mul_scratch(m), vec_mul_scratch(k));
+}
+
+// Compute w = u + v, where w, u, and v have n digits. Return the
+// carry. w may be u or v.
+static digit_type
+vec_add_n(length_type n, const digit_type *u, const digit_type *v,
+          digit_type *w)
+{
+  register digit_type carry = 0;
+
+  for (register length_type i = 0; i < n; ++i) {
+    carry += u[i] + v[i];
+    w[i] = carry & DIGIT_MASK;
+    carry >>= BITS_PER_DIGIT;
+  }
+
+  return carry;
+}
+
+// Compute w = u - v, where w, u, and v have n digits, and u >= v. w
+// may be u or v.
+static void
+vec_sub_n(length_type n, const digit_type *u, const digit_type *v,
+          digit_type *w)
+{
+  register digit_type borrow = 0;
+
+  for (register length_type i = 0; i < n; ++i) {
+    borrow = (u[i] + DIGIT_RADIX) - v[i] - borrow;
+    w[i] = borrow & DIGIT_MASK;
+    borrow = 1 - (borrow >> BITS_PER_DIGIT);
+  }
+
+#ifdef DEBUG_SYSTEMC
+  assert(borrow == 0);
+#endif
+}
+
+// Compute w = |u - v|, where w and u have ulen digits, and v has vlen
+// digits. Return true if u < v. w may be u, or v if ulen == vlen.
+// - ulen >= vlen
+static bool
+vec_sub_abs(length_type ulen, const digit_type *u,
+            length_type vlen, const digit_type *v,
+            digit_type *w)
+{
+  length_type i;
+
+  for (i = ulen - 1; i >= vlen; --i) {
+    if (u[i]) {
+      vec_sub(ulen, u, vlen, v, w);
+      return false;
+    }
+    w[i] = 0;
+  }
+
+  // Skip the equal leading digits.
+  while ((i >= 0) && (u[i] == v[i]))
+    w[i--] = 0;
+
+  if (i < 0)
+    return false;
+
+  if (u[i] < v[i]) {
+    vec_sub_n(i + 1, v, u, w);
+    return true;
+  }
+
+  vec_sub_n(i + 1, u, v, w);
+  return false;
+}
+
+// Compute w = u + v, where w, u, and v have n digits and are given as
+// magnitudes and signs (true for negative). Return the sign of w. w
+// may be u or v.
+static bool
+vec_add_signed(length_type n, const digit_type *u, bool u_neg,
+               const digit_type *v, bool v_neg, digit_type *w)
+{
+  if (u_neg == v_neg) {
+    vec_add_n(n, u, v, w);
+    return u_neg;
+  }
+
+  return (vec_sub_abs(n, u, n, v, w) ? v_neg : u_neg);
+}
+
+// Compute w = u * v, where u and v have n digits, by Karatsuba's
+// method. With x = DIGIT_RADIX^h, u = u1 * x + u0, and v = v1 * x +
+// v0,
+//
+//   u * v = u1 v1 x^2 + (u1 v1 + u0 v0 - (u1 - u0)(v1 - v0)) x + u0 v0.
+//
+// The differences are kept as magnitudes and signs, so that no
+// operand of the recursive products grows beyond the k = n - h digits
+// of the upper halves.
+static void
+vec_mul_karatsuba(length_type n, const digit_type *u, const digit_type *v,
+                  digit_type *w, digit_type *scratch)
+{
+  length_type h = n / 2;
+  length_type k = n - h;
+
+  digit_type *du = scratch;       // |u1 - u0|, k digits
+  digit_type *dv = du + k;        // |v1 - v0|, k digits
+  digit_type *t = dv + k;         // du * dv, 2k digits
+  digit_type *mid = t + 2 * k;    // middle term, 2k + 1 digits
+  digit_type *rest = mid + 2 * k + 1;
+
+  bool du_neg = vec_sub_abs(k, u + h, h, u, du);
+  bool dv_neg = vec_sub_abs(k, v + h, h, v, dv);
+
+  vec_mul_n(h, u, v, w, rest);                  // u0 v0
+  vec_mul_n(k, u + h, v + h, w + 2 * h, rest);  // u1 v1
+  vec_mul_n(k, du, dv, t, rest);
+
+  vec_copy(2 * k, mid, w + 2 * h);
+  mid[2 * k] = 0;
+  vec_add_on(2 * k + 1, mid, 2 * h, w);
+
+  if (du_neg == dv_neg)
+    vec_sub_on(2 * k + 1, mid, 2 * k, t);
+  else
+    vec_add_on(2 * k + 1, mid, 2 * k, t);
+
+  vec_add_on(2 * n - h, w + h, 2 * k + 1, mid);
+}
+
+// Set p1, pm1, and pm2 to the values at 1, -1, and -2 of the
+// polynomial u2 x^2 + u1 x + u0, where u0 and u1 are the lower two k
+// digits of u, and u2 its upper n - 2k digits. The values have k + 1
+// digits; tmp holds k + 1 digits. The signs of the values at -1 and -2
+// are returned in pm1_neg and pm2_neg.
+static void
+vec_toom3_eval(length_type n, length_type k, const digit_type *u,
+               digit_type *p1, digit_type *pm1, bool &pm1_neg,
+               digit_type *pm2, bool &pm2_neg, digit_type *tmp)
+{
+  length_type m = k + 1;
+
+  // p1 = u0 + u2
+  vec_copy(k, p1, u);
+  p1[k] = 0;
+  vec_add_on(m, p1, n - 2 * k, u + 2 * k);
+
+  // pm1 = u0 + u2 - u1, p1 = u0 + u2 + u1
+  vec_copy(k, tmp, u + k);
+  tmp[k] = 0;
+  pm1_neg = vec_sub_abs(m, p1, m, tmp, pm1);
+  vec_add_n(m, p1, tmp, p1);
+
+  // pm2 = 2 (pm1 + u2) - u0
+  vec_copy(n - 2 * k, tmp, u + 2 * k);
+  vec_zero(n - 2 * k, m, tmp);
+  pm2_neg = vec_add_signed(m, pm1, pm1_neg, tmp, false, pm2);
+  vec_add_n(m, pm2, pm2, pm2);
+  vec_copy(k, tmp, u);
+  tmp[k] = 0;
+  pm2_neg = vec_add_signed(m, pm2, pm2_neg, tmp, true, pm2);
+}
+
+// Add u, of ulen digits, to w at digit offset off. w has wlen digits,
+// enough to hold the sum.
+static void
+vec_add_at(length_type wlen, digit_type *w, length_type off,
+           length_type ulen, const digit_type *u)
+{
+  ulen = vec_skip_leading_zeros(ulen, u);
+  if (ulen > 0)
+    vec_add_on(wlen - off, w + off, ulen, u);
+}
+
+// Compute w = u * v, where u and v have n digits, by Toom-3. The
+// product of the polynomials u(x) and v(x) of vec_toom3_eval(), with x
+// = DIGIT_RADIX^k, is computed from their values at 0, 1, -1, -2, and
+// infinity, and interpolated as in Bodrato's sequence:
+//
+//   r3 = (r(-2) - r(1)) / 3
+//   r1 = (r(1) - r(-1)) / 2
+//   r2 = r(-1) - r(0)
+//   r3 = (r2 - r3) / 2 + 2 r(inf)
+//   r2 = r2 + r1 - r(inf)
+//   r1 = r1 - r3
+//
+// Then u * v = r(inf) x^4 + r3 x^3 + r2 x^2 + r1 x + r(0).
+static void
+vec_mul_toom3(length_type n, const digit_type *u, const digit_type *v,
+              digit_type *w, digit_type *scratch)
+{
+  length_type k = (n + 2) / 3;    // digits of the lower thirds
+  length_type l = n - 2 * k;      // digits of the upper thirds
+  length_type m = k + 1;          // digits of the values
+  length_type r = 2 * m;          // digits of their products
+
+#ifdef DEBUG_SYSTEMC
+  assert(l > 0);
+#endif
+
+  digit_type *pu1 = scratch;
+  digit_type *pum1 = pu1 + m;
+  digit_type *pum2 = pum1 + m;
+  digit_type *pv1 = pum2 + m;
+  digit_type *pvm1 = pv1 + m;
+  digit_type *pvm2 = pvm1 + m;
+  digit_type *tmp = pvm2 + m;
+  digit_type *r0 = tmp + m;
+  digit_type *r1 = r0 + r;
+  digit_type *r2 = r1 + r;        // r(-1) at first
+  digit_type *r3 = r2 + r;        // r(-2) at first
+  digit_type *r4 = r3 + r;
+  digit_type *rest = r4 + r;
+
+  bool um1_neg, um2_neg, vm1_neg, vm2_neg;
+
+  vec_toom3_eval(n, k, u, pu1, pum1, um1_neg, pum2, um2_neg, tmp);
+  vec_toom3_eval(n, k, v, pv1, pvm1, vm1_neg, pvm2, vm2_neg, tmp);
+
+  vec_mul_n(k, u, v, r0, rest);
+  vec_zero(2 * k, r, r0);
+  vec_mul_n(l, u + 2 * k, v + 2 * k, r4, rest);
+  vec_zero(2 * l, r, r4);
+  vec_mul_n(m, pu1, pv1, r1, rest);
+  vec_mul_n(m, pum1, pvm1, r2, rest);
+  vec_mul_n(m, pum2, pvm2, r3, rest);
+
+  bool r1_neg = false;
+  bool r2_neg = (um1_neg != vm1_neg);
+  bool r3_neg = (um2_neg != vm2_neg);
+
+  // Each division below is exact.
+  r3_neg = vec_add_signed(r, r3, r3_neg, r1, true, r3);
+  vec_div_small(r, r3, 3, r3);
+
+  r1_neg = vec_add_signed(r, r1, r1_neg, r2, ! r2_neg, r1);
+  vec_shift_right(r, r1, 1);
+
+  r2_neg = vec_add_signed(r, r2, r2_neg, r0, true, r2);
+
+  r3_neg = vec_add_signed(r, r2, r2_neg, r3, ! r3_neg, r3);
+  vec_shift_right(r, r3, 1);
+  r3_neg = vec_add_signed(r, r3, r3_neg, r4, false, r3);
+  r3_neg = vec_add_signed(r, r3, r3_neg, r4, false, r3);
+
+  r2_neg = vec_add_signed(r, r2, r2_neg, r1, r1_neg, r2);
+  r2_neg = vec_add_signed(r, r2, r2_neg, r4, true, r2);
+
+  r1_neg = vec_add_signed(r, r1, r1_neg, r3, ! r3_neg, r1);
+
+#ifdef DEBUG_SYSTEMC
+  // The coefficients of the product are not negative.
+  assert(! r1_neg || (vec_skip_leading_zeros(r, r1) == 0));
+  assert(! r2_neg || (vec_skip_leading_zeros(r, r2) == 0));
+  assert(! r3_neg || (vec_skip_leading_zeros(r, r3) == 0));
+#endif
+
+  vec_copy(2 * k, w, r0);
+  vec_zero(2 * k, 4 * k, w);
+  vec_copy(2 * l, w + 4 * k, r4);
+  vec_add_at(2 * n, w, k, r, r1);
+  vec_add_at(2 * n, w, 2 * k, r, r2);
+  vec_add_at(2 * n, w, 3 * k, r, r3);
+}
+
+// Compute w = u * v, where u and v have n digits, and w has 2n
+// digits.
+static void
+vec_mul_n(length_type n, const digit_type *u, const digit_type *v,
+          digit_type *w, digit_type *scratch)
+{
+  if (n < VEC_MUL_KARATSUBA_THRESHOLD) {
+    vec_zero(2 * n, w);
+    vec_mul_basecase(n, u, n, v, w);
+  }
+  else if (n < VEC_MUL_TOOM3_THRESHOLD)
+    vec_mul_karatsuba(n, u, v, w, scratch);
+  else
+    vec_mul_toom3(n, u, v, w, scratch);
+}
+
+// Compute w = u * v, where w, u, and v are vectors.
+// - w has ulen + vlen digits, all zero.
+// - ulen >= vlen
+void
+vec_mul(length_type ulen, const digit_type *u,
+        length_type vlen, const digit_type *v,
+        digit_type *w)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert((ulen > 0) && (u != NULL));
+  assert((vlen > 0) && (v != NULL));
+  assert(w != NULL);
+  assert(ulen >= vlen);
+#endif
+
+  if (vlen < VEC_MUL_KARATSUBA_THRESHOLD) {
+    vec_mul_basecase(ulen, u, vlen, v, w);
+    return;
+  }
+
+  // Multiply v by the vlen-digit slices of u, and add the products
+  // into w. The last slice may be shorter.
+
+  // The temporary is allocated even if MAX_NBITS is defined: it
+  // grows faster than the operands and would not fit on the stack
+  // of a process, and its cost is small next to the product.
+  digit_type *t = vec_new(2 * vlen + vec_mul_scratch(vlen));
 
-      (*w++) = concat(low_half(prod_h), low_half(prod_l));
+  for (length_type i = 0; i < ulen; i += vlen) {
 
-      carry = u_h * v_h + high_half(prod_h);
+    length_type n = MINT(vlen, ulen - i);
 
+    if (n == vlen)
+      vec_mul_n(vlen, u + i, v, t, t + 2 * vlen);
+    else {
+      vec_zero(n + vlen, t);
+      vec_mul(vlen, v, n, u + i, t);
     }
 
-    (*w) = carry;
+    vec_add_on(ulen + vlen - i, w + i, n + vlen, t);
 
   }
 
-#undef prod_h
+  vec_delete(t);
 
 }
 
@@ -730,12 +1693,31 @@ vec_mul_small(length_type ulen, const digit_type *u,
   assert((0 < v) && (v < HALF_DIGIT_RADIX));
 #endif
 
-#define prod_h carry
-
   const digit_type *uend = (u + ulen);
 
   register digit_type carry = 0;
 
+#ifdef SC_DOUBLE_DIGIT
+
+  while (u < uend) {
+
+#ifdef DEBUG_SYSTEMC
+    // The overflow bits must be zero.
+    assert((*u) == ((*u) & DIGIT_MASK));
+#endif
+
+    double_digit_type prod = (double_digit_type) v * (*u++) + carry;
+
+    (*w++) = ((digit_type) prod) & DIGIT_MASK;
+
+    carry = (digit_type) (prod >> BITS_PER_DIGIT);
+
+  }
+
+#else
+
+#define prod_h carry
+
   while (u < uend) {
 
     digit_type u_AB = (*u++);
@@ -755,10 +1737,12 @@ vec_mul_small(length_type ulen, const digit_type *u,
 
   }
 
-  (*w) = carry;
-
 #undef prod_h
 
+#endif
+
+  (*w) = carry;
+
 }
 
 // Compute u = u * v, where u is a vector, and v is a scalar.
@@ -772,10 +1756,29 @@ vec_mul_small_on(length_type ulen, digit_type *u, digit_type v)
   assert((0 < v) && (v < HALF_DIGIT_RADIX));
 #endif
 
-#define prod_h carry
-
   register digit_type carry = 0;
 
+#ifdef SC_DOUBLE_DIGIT
+
+  for (register length_type i = 0; i < ulen; ++i) {
+
+#ifdef DEBUG_SYSTEMC
+    // The overflow bits must be zero.
+    assert(u[i] == (u[i] & DIGIT_MASK));
+#endif
+
+    double_digit_type prod = (double_digit_type) v * u[i] + carry;
+
+    u[i] = ((digit_type) prod) & DIGIT_MASK;
+
+    carry = (digit_type) (prod >> BITS_PER_DIGIT);
+
+  }
+
+#else
+
+#define prod_h carry
+
   for (register length_type i = 0; i < ulen; ++i) {
 
 #ifdef DEBUG_SYSTEMC
@@ -795,151 +1798,369 @@ vec_mul_small_on(length_type ulen, digit_type *u, digit_type v)
 
 #undef prod_h
 
+#endif
+
 #ifdef DEBUG_SYSTEMC
   warn(carry == 0, "Result of multiplication (in vec_mul_small_on) is wrapped around.");
 #endif
 
 }
 
-// Compute w = u / v, where w, u, and v are vectors. 
-// - u and v are assumed to have at least two digits as uchars.
+// Long division is Knuth's Algorithm D (TAOCP vol. 2, 4.3.1) on
+// whole digits. The divisor is shifted so that the top bit of its top
+// digit is one, and each digit of the quotient is estimated from two
+// digits of the dividend and the top digit of the divisor, by
+// multiplying by the reciprocal of that digit (Moller and Granlund,
+// "Improved division by invariant integers", 2011). The reciprocal is
+// computed once per division. Temporaries of up to DIV_SMALL_NDIGITS
+// digits are kept on the stack.
+#ifdef MAX_NBITS
+const length_type DIV_SMALL_NDIGITS = MAX_NDIGITS + 1;
+#else
+const length_type DIV_SMALL_NDIGITS = SMALL_TEMP_NDIGITS + 1;
+#endif
+
+// The number of bits by which a digit is shifted to fill a digit_type.
+const int DIGIT_TYPE_NSL = BITS_PER_DIGIT_TYPE - BITS_PER_DIGIT;
+
+// Compute hi * DIGIT_RADIX + lo = u * v, where u and v are digits.
+inline
 void
-vec_div_large(length_type ulen, const digit_type *u,
-              length_type vlen, const digit_type *v,
-              digit_type *w)
+digit_mul(digit_type u, digit_type v, digit_type &hi, digit_type &lo)
 {
 
-#ifdef DEBUG_SYSTEMC
-  assert((ulen > 0) && (u != NULL));
-  assert((vlen > 0) && (v != NULL));
-  assert(w != NULL);
-  assert(BITS_PER_DIGIT >= 3 * BITS_PER_BYTE);
+#ifdef SC_DOUBLE_DIGIT
+
+  double_digit_type prod = (double_digit_type) u * v;
+
+  lo = ((digit_type) prod) & DIGIT_MASK;
+  hi = (digit_type) (prod >> BITS_PER_DIGIT);
+
+#else
+
+  // As in vec_mul_basecase(), u = A|B and v = C|D.
+  digit_type mid = high_half(u) * low_half(v) + low_half(u) * high_half(v);
+
+  lo = low_half(u) * low_half(v) + (low_half(mid) << BITS_PER_HALF_DIGIT);
+  hi = high_half(u) * high_half(v) + high_half(mid) + (lo >> BITS_PER_DIGIT);
+  lo &= DIGIT_MASK;
+
 #endif
 
-  // We will compute q = x / y where x = u and y = v. The reason for
-  // using x and y is that x and y are BYTE_RADIX copies of u and v,
-  // respectively. The use of BYTE_RADIX radix greatly simplifies the
-  // complexity of the division operation. These copies are also
-  // needed even when we use DIGIT_RADIX representation.
+}
+
+// Compute hi * 2^BITS_PER_DIGIT_TYPE + lo = u * v, where u and v use
+// all the bits of a digit_type.
+inline
+void
+word_mul(digit_type u, digit_type v, digit_type &hi, digit_type &lo)
+{
 
-  length_type xlen = BYTES_PER_DIGIT * ulen + 1;
-  length_type ylen = BYTES_PER_DIGIT * vlen;
+#ifdef SC_DOUBLE_DIGIT
+
+  double_digit_type prod = (double_digit_type) u * v;
+
+  lo = (digit_type) prod;
+  hi = (digit_type) (prod >> BITS_PER_DIGIT_TYPE);
+
+#else
+
+  const int h = BITS_PER_DIGIT_TYPE / 2;
+  const digit_type m = one_and_ones(h);
+
+  digit_type BD = (u & m) * (v & m);
+  digit_type AD = (u >> h) * (v & m);
+  digit_type BC = (u & m) * (v >> h);
+  digit_type mid = (BD >> h) + (AD & m) + (BC & m);
+
+  lo = (mid << h) | (BD & m);
+  hi = (u >> h) * (v >> h) + (AD >> h) + (BC >> h) + (mid >> h);
+
+#endif
+
+}
+
+// Return the reciprocal of d, floor((2^(2 * W) - 1) / d) - 2^W,
+// where W = BITS_PER_DIGIT_TYPE.
+// - The top bit of d is one.
+static digit_type
+word_reciprocal(digit_type d)
+{
+
+#ifdef SC_DOUBLE_DIGIT
+
+  return (digit_type)
+    (((((double_digit_type) ~d) << BITS_PER_DIGIT_TYPE) | ~((digit_type) 0)) / d);
 
-#ifdef MAX_NBITS
-  uchar x[DIV_CEIL2(MAX_NBITS, BITS_PER_BYTE)];
-  uchar y[DIV_CEIL2(MAX_NBITS, BITS_PER_BYTE)];
-  uchar q[DIV_CEIL2(MAX_NBITS, BITS_PER_BYTE)];
 #else
-  uchar *x = new uchar[xlen];
-  uchar *y = new uchar[ylen];
-  uchar *q = new uchar[xlen - ylen + 1];
+
+  // Divide ~d|~0 by d a bit at a time.
+  digit_type r = ~d;
+  digit_type q = 0;
+
+  for (register int i = 0; i < (int) BITS_PER_DIGIT_TYPE; ++i) {
+
+    digit_type top = r >> (BITS_PER_DIGIT_TYPE - 1);
+
+    r = (r << 1) | 1;
+    q <<= 1;
+
+    if (top || (r >= d)) {
+      r -= d;
+      q |= 1;
+    }
+
+  }
+
+  return q;
+
+#endif
+
+}
+
+// Compute q = nh|nl / d and r = nh|nl % d, where nh and nl use all the
+// bits of a digit_type, and di is the reciprocal of d.
+// - nh < d, and the top bit of d is one.
+inline
+void
+word_div(digit_type nh, digit_type nl, digit_type d, digit_type di,
+         digit_type &q, digit_type &r)
+{
+
+  digit_type qh, ql;
+
+  word_mul(nh, di, qh, ql);
+
+  // qh|ql += (nh + 1)|nl
+  ql += nl;
+  qh += nh + 1 + (ql < nl);
+
+  r = nl - qh * d;
+
+  if (r > ql) {
+    --qh;
+    r += d;
+  }
+
+  if (r >= d) {
+    ++qh;
+    r -= d;
+  }
+
+  q = qh;
+
+}
+
+// Compute u -= q * v, where u has vlen + 1 digits, and return 1 if
+// the result is negative; it is then wrapped around.
+static digit_type
+vec_mul_sub_small(length_type vlen, const digit_type *v, digit_type q,
+                  digit_type *u)
+{
+
+  register digit_type carry = 0;
+  register digit_type borrow = 0;
+
+  for (register length_type i = 0; i < vlen; ++i) {
+
+    digit_type hi, lo;
+
+    digit_mul(q, v[i], hi, lo);
+
+    lo += carry;
+    carry = hi + (lo >> BITS_PER_DIGIT);
+
+    // The difference is negative iff its top bit is one.
+    digit_type diff = u[i] - (lo & DIGIT_MASK) - borrow;
+
+    u[i] = diff & DIGIT_MASK;
+    borrow = diff >> (BITS_PER_DIGIT_TYPE - 1);
+
+  }
+
+  digit_type diff = u[vlen] - carry - borrow;
+
+  u[vlen] = diff & DIGIT_MASK;
+
+  return (diff >> (BITS_PER_DIGIT_TYPE - 1));
+
+}
+
+// Set y = v shifted left by s bits, so that the top bit of its top
+// digit is one, and di = the reciprocal of that digit, and return s.
+// The y, s, and di of a v are all that vec_div_norm() needs to divide
+// by v.
+// - The leading digit of v is not zero, and y has vlen digits.
+int
+vec_div_normalize(length_type vlen, const digit_type *v, 
+                  digit_type *y, digit_type &di)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert((vlen > 0) && (v != NULL) && (v[vlen - 1] != 0));
+  assert(y != NULL);
 #endif
 
-  // q corresponds to w.
+  int s = 0;
+
+  for (digit_type t = v[vlen - 1]; t < (DIGIT_RADIX >> 1); t <<= 1)
+    ++s;
+
+  vec_copy(vlen, y, v);
+  vec_shift_left(vlen, y, s);
 
-  // Set (uchar) x = (digit_type) u.
-  xlen = vec_to_char(ulen, u, xlen, x);
+  di = word_reciprocal(y[vlen - 1] << DIGIT_TYPE_NSL);
 
-  // Skip all the leading zeros in x.
-  while ((--xlen >= 0) && (! x[xlen]));
-  xlen++;
+  return s;
 
-  // Set (uchar) y = (digit_type) v.
-  ylen = vec_to_char(vlen, v, ylen, y);
+}
 
-  // Skip all the leading zeros in y.
-  while ((--ylen >= 0) && (! y[ylen]));
-  ylen++;
+// Compute q = u / v and r = u % v, where y, s, and di are from
+// vec_div_normalize(v).
+// - ulen >= vlen, and the leading digit of u is not zero.
+// - q has ulen - vlen + 1 digits, and r has vlen digits; either can
+//   be NULL.
+void
+vec_div_norm(length_type ulen, const digit_type *u,
+             length_type vlen, const digit_type *y, int s, digit_type di,
+             digit_type *q, digit_type *r)
+{
 
 #ifdef DEBUG_SYSTEMC
-  assert(xlen > 1);
-  assert(ylen > 1);
+  assert((ulen >= vlen) && (vlen > 0));
+  assert((u != NULL) && (u[ulen - 1] != 0) && (y != NULL));
 #endif
 
-  // At this point, all the leading zeros are eliminated from x and y.
+  // Shift u as much as v, into x, which has one more digit.
+  digit_type small_x[DIV_SMALL_NDIGITS];
+  digit_type *x = (ulen + 1 <= DIV_SMALL_NDIGITS) ? small_x : vec_new(ulen + 1);
+
+  vec_copy(ulen, x, u);
+  x[ulen] = 0;
+  vec_shift_left(ulen + 1, x, s);
 
-  // Zero the last digit of x.
-  x[xlen] = 0;
+  const digit_type d = y[vlen - 1];
+  const digit_type d1 = (vlen > 1) ? y[vlen - 2] : 0;
+  const digit_type dw = d << DIGIT_TYPE_NSL;
 
-  // The first two digits of y.
-  register digit_type y2 = (y[ylen - 1] << BITS_PER_BYTE) + y[ylen - 2];
+  for (register length_type j = ulen - vlen; j >= 0; --j) {
 
-  const digit_type DOUBLE_BITS_PER_BYTE = 2 * BITS_PER_BYTE;
+    digit_type *xj = x + j;
+    digit_type x2 = xj[vlen];
+    digit_type x1 = xj[vlen - 1];
 
-  // Find each q[k].
-  for (register length_type k = xlen - ylen; k >= 0; --k) {
+    // Estimate qhat = x2|x1 / d, with remainder rhat.
+    digit_type qhat, rhat;
 
-    // qk is a guess for q[k] such that q[k] = qk or qk - 1.
-    register digit_type qk;
+    if (x2 >= d) {  // x2 == d
+      qhat = DIGIT_MASK;
+      rhat = x1 + d;
+    }
+    else {
+      word_div(x2, x1 << DIGIT_TYPE_NSL, dw, di, qhat, rhat);
+      rhat >>= DIGIT_TYPE_NSL;
+    }
+
+    // The next digit of x and y show whether qhat is too large, which
+    // it is by at most two.
+    if (vlen > 1) {
+
+      digit_type x0 = xj[vlen - 2];
+
+      while (rhat < DIGIT_RADIX) {
+
+        digit_type hi, lo;
+
+        digit_mul(qhat, d1, hi, lo);
 
-    // Find qk by just using 2 digits of y and 3 digits of x. The
-    // following code assumes that sizeof(digit_type) >= 3 BYTEs.
-    length_type k2 = k + ylen;
+        if ((hi < rhat) || ((hi == rhat) && (lo <= x0)))
+          break;
 
-    qk = ((x[k2] << DOUBLE_BITS_PER_BYTE) + 
-          (x[k2 - 1] << BITS_PER_BYTE) + x[k2 - 2]) / y2;
+        --qhat;
+        rhat += d;
 
-    if (qk >= BYTE_RADIX)     // qk cannot be larger than the largest
-      qk = BYTE_RADIX - 1;    // digit in BYTE_RADIX.
+      }
+
+    }
 
-    // q[k] = qk or qk - 1. The following if-statement determines which:
-    if (qk) {
+    // Rarely, qhat is still one too large.
+    if (vec_mul_sub_small(vlen, y, qhat, xj)) {
 
-      register uchar *xk = (x + k);  // A shortcut for x[k].
+      --qhat;
 
-      // x = x - y * qk :
       register digit_type carry = 0;
 
-      for (register length_type i = 0; i < ylen; ++i) {
-        carry += y[i] * qk;
-        digit_type diff = (xk[i] + BYTE_RADIX) - (carry & BYTE_MASK);
-        xk[i] = (uchar)(diff & BYTE_MASK);
-        carry = (carry >> BITS_PER_BYTE) + (1 - (diff >> BITS_PER_BYTE));
+      for (register length_type i = 0; i < vlen; ++i) {
+        carry += xj[i] + y[i];
+        xj[i] = carry & DIGIT_MASK;
+        carry >>= BITS_PER_DIGIT;
       }
 
-      // If carry, qk may be one too large.
-      if (carry) {
+      xj[vlen] = (xj[vlen] + carry) & DIGIT_MASK;
+
+    }
+
+    if (q)
+      q[j] = qhat;
+
+  }
+
+  // The remainder is in the vlen low digits of x.
+  if (r) {
+    vec_shift_right(vlen, x, s);
+    vec_copy(vlen, r, x);
+  }
 
-        // 2's complement the last digit.
-        carry = (xk[ylen] + BYTE_RADIX) - carry;
-        xk[ylen] = (uchar)(carry & BYTE_MASK);
-        carry = 1 - (carry >> BITS_PER_BYTE);
-        
-        if (carry) {
+  if (x != small_x)
+    vec_delete(x);
 
-          // qk was one too large, so decrement it.
-          --qk;
-        
-          // Since qk was decreased by one, y must be added to x:
-          // That is, x = x - y * (qk - 1) = x - y * qk + y = x_above + y.
-          carry = 0;
+}
 
-          for (register length_type i = 0; i < ylen; ++i) {
-            carry += xk[i] + y[i];
-            xk[i] = (uchar)(carry & BYTE_MASK);
-            carry >>= BITS_PER_BYTE;
-          }
+// Compute q = u / v and r = u % v, as vec_div_norm() does.
+static void
+vec_div_knuth(length_type ulen, const digit_type *u,
+              length_type vlen, const digit_type *v,
+              digit_type *q, digit_type *r)
+{
 
-          if (carry)
-            xk[ylen] = (uchar)((xk[ylen] + 1) & BYTE_MASK);
+  digit_type small_y[DIV_SMALL_NDIGITS];
+  digit_type *y = (vlen <= DIV_SMALL_NDIGITS) ? small_y : vec_new(vlen);
 
-        }  // second if carry
-      }  // first if carry
-    }  // if qk
+  digit_type di;
+  int s = vec_div_normalize(vlen, v, y, di);
 
-    q[k] = (uchar)qk;
+  vec_div_norm(ulen, u, vlen, y, s, di, q, r);
 
-  }  // for k
+  if (y != small_y)
+    vec_delete(y);
 
-  // Set (digit_type) w = (uchar) q.
-  vec_from_char(xlen - ylen + 1, q, ulen, w);
+}
 
-#ifndef MAX_NBITS
-  delete [] x;
-  delete [] y;
-  delete [] q;
+// Compute w = u / v, where w, u, and v are vectors. 
+// - v is not zero.
+// - w has ulen digits.
+void
+vec_div_large(length_type ulen, const digit_type *u,
+              length_type vlen, const digit_type *v,
+              digit_type *w)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert((ulen > 0) && (u != NULL));
+  assert((vlen > 0) && (v != NULL));
+  assert(w != NULL);
 #endif
 
+  length_type wlen = ulen;
+
+  ulen = vec_skip_leading_zeros(ulen, u);
+  vlen = vec_skip_leading_zeros(vlen, v);
+
+  vec_zero(wlen, w);
+
+  if (ulen >= vlen)
+    vec_div_knuth(ulen, u, vlen, v, w, NULL);
+
 }
 
 // Compute w = u / v, where u and w are vectors, and v is a scalar.
@@ -1009,7 +2230,8 @@ vec_div_small(length_type ulen, const digit_type *u,
 }
 
 // Compute w = u % v, where w, u, and v are vectors. 
-// - u and v are assumed to have at least two digits as uchars.
+// - v is not zero.
+// - w has ulen digits.
 void
 vec_rem_large(length_type ulen, const digit_type *u,
               length_type vlen, const digit_type *v,
@@ -1020,120 +2242,117 @@ vec_rem_large(length_type ulen, const digit_type *u,
   assert((ulen > 0) && (u != NULL));
   assert((vlen > 0) && (v != NULL));
   assert(w != NULL);
-  assert(BITS_PER_DIGIT >= 3 * BITS_PER_BYTE);
 #endif
 
-  // This function is adapted from vec_div_large.
+  length_type wlen = ulen;
 
-  length_type xlen = BYTES_PER_DIGIT * ulen + 1;
-  length_type ylen = BYTES_PER_DIGIT * vlen;
-
-#ifdef MAX_NBITS
-  uchar x[DIV_CEIL2(MAX_NBITS, BITS_PER_BYTE)];
-  uchar y[DIV_CEIL2(MAX_NBITS, BITS_PER_BYTE)];
-#else
-  uchar *x = new uchar[xlen];
-  uchar *y = new uchar[ylen];
-#endif
+  ulen = vec_skip_leading_zeros(ulen, u);
+  vlen = vec_skip_leading_zeros(vlen, v);
 
-  // r corresponds to w.
+  vec_zero(wlen, w);
 
-  // Set (uchar) x = (digit_type) u.
-  xlen = vec_to_char(ulen, u, xlen, x);
+  if (ulen < vlen) {
+    if (ulen)
+      vec_copy(ulen, w, u);
+  }
+  else
+    vec_div_knuth(ulen, u, vlen, v, NULL, w);
 
-  // Skip all the leading zeros in x.
-  while ((--xlen >= 0) && (! x[xlen]));
-  xlen++;
+}
 
-  // Set (uchar) y = (digit_type) v.
-  ylen = vec_to_char(vlen, v, ylen, y);
+// Barrett's method (HAC 14.42) divides by a v of vlen digits with two
+// multiplications, given inv = floor((DIGIT_RADIX^(2 * vlen) - 1) / v),
+// which is computed once. This pays when many numbers are divided by
+// the same v.
 
-  // Skip all the leading zeros in y.
-  while ((--ylen >= 0) && (! y[ylen]));
-  ylen++;
+// Compute inv for v; inv has vlen + 1 digits.
+// - v has no leading zero digits.
+void
+vec_barrett_inverse(length_type vlen, const digit_type *v, digit_type *inv)
+{
 
 #ifdef DEBUG_SYSTEMC
-  assert(xlen > 1);
-  assert(ylen > 1);
+  assert((vlen > 0) && (v != NULL) && (v[vlen - 1] != 0));
+  assert(inv != NULL);
 #endif
 
-  // At this point, all the leading zeros are eliminated from x and y.
+  length_type xlen = 2 * vlen;
 
-  // Zero the last digit of x.
-  x[xlen] = 0;
+  digit_type small_x[2 * DIV_SMALL_NDIGITS];
+  digit_type *x = (xlen <= 2 * DIV_SMALL_NDIGITS) ? small_x : vec_new(xlen);
 
-  // The first two digits of y.
-  register digit_type y2 = (y[ylen - 1] << BITS_PER_BYTE) + y[ylen - 2];
+  for (register length_type i = 0; i < xlen; ++i)
+    x[i] = DIGIT_MASK;
 
-  const digit_type DOUBLE_BITS_PER_BYTE = 2 * BITS_PER_BYTE;
+  vec_div_knuth(xlen, x, vlen, v, inv, NULL);
 
-  // Find each q[k].
-  for (register length_type k = xlen - ylen; k >= 0; --k) {
+  if (x != small_x)
+    vec_delete(x);
 
-    // qk is a guess for q[k] such that q[k] = qk or qk - 1.
-    register digit_type qk;
-
-    // Find qk by just using 2 digits of y and 3 digits of x. The
-    // following code assumes that sizeof(digit_type) >= 3 BYTEs.
-    length_type k2 = k + ylen;
+}
 
-    qk = ((x[k2] << DOUBLE_BITS_PER_BYTE) +
-      (x[k2 - 1] << BITS_PER_BYTE) + x[k2 - 2]) / y2;
+// Compute q = u / v and u = u % v, where inv is the inverse of v
+// from vec_barrett_inverse(), and return the number of digits in q,
+// without leading zeros.
+// - u < DIGIT_RADIX^(2 * vlen), and v has no leading zero digits.
+// - q has vlen + 1 digits, or is NULL.
+length_type
+vec_div_barrett(length_type ulen, digit_type *u,
+                length_type vlen, const digit_type *v,
+                const digit_type *inv, digit_type *q)
+{
 
-    if (qk >= BYTE_RADIX)     // qk cannot be larger than the largest
-      qk = BYTE_RADIX - 1;    // digit in BYTE_RADIX.
+#ifdef DEBUG_SYSTEMC
+  assert((ulen > 0) && (u != NULL));
+  assert((vlen > 0) && (v != NULL) && (inv != NULL));
+  assert(ulen <= 2 * vlen);
+#endif
 
-    // q[k] = qk or qk - 1. The following if-statement determines which.
-    if (qk) {
+  if (q)
+    vec_zero(vlen + 1, q);
 
-      register uchar *xk = (x + k);  // A shortcut for x[k].
+  ulen = vec_skip_leading_zeros(ulen, u);
 
-      // x = x - y * qk;
-      register digit_type carry = 0;
+  if (ulen < vlen)
+    return 0;
 
-      for (register length_type i = 0; i < ylen; ++i) {
-        carry += y[i] * qk;
-        digit_type diff = (xk[i] + BYTE_RADIX) - (carry & BYTE_MASK);
-        xk[i] = (uchar)(diff & BYTE_MASK);
-        carry = (carry >> BITS_PER_BYTE) + (1 - (diff >> BITS_PER_BYTE));
-      }
+  // The quotient is estimated from the digits of u above the vlen - 1
+  // lowest ones; the estimate is short by at most three.
+  length_type xlen = ulen - vlen + 1;
+  length_type ilen = vec_skip_leading_zeros(vlen + 1, inv);
+  length_type tlen = xlen + ilen + 2 * vlen + 1;
 
-      if (carry) {
+  digit_type small_t[4 * DIV_SMALL_NDIGITS];
+  digit_type *t = (tlen <= 4 * DIV_SMALL_NDIGITS) ? small_t : vec_new(tlen);
+  digit_type *t2 = t + xlen + ilen;
 
-        // 2's complement the last digit.
-        carry = (xk[ylen] + BYTE_RADIX) - carry;
-        xk[ylen] = (uchar)(carry & BYTE_MASK);
-        carry = 1 - (carry >> BITS_PER_BYTE);
-        
-        if (carry) {
+  vec_mul_any(xlen, u + vlen - 1, ilen, inv, t);
 
-          // qk was one too large, so decrement it.
-          // --qk;
-        
-          // x = x - y * (qk - 1) = x - y * qk + y = x_above + y.
-          carry = 0;
+  length_type qlen = xlen + ilen - (vlen + 1);
 
-          for (register length_type i = 0; i < ylen; ++i) {
-            carry += xk[i] + y[i];
-            xk[i] = (uchar)(carry & BYTE_MASK);
-            carry >>= BITS_PER_BYTE;
-          }
+  if (qlen > 0) {
+    qlen = vec_skip_leading_zeros(qlen, t + vlen + 1);
+    if (qlen > 0) {
+      if (q)
+        vec_copy(qlen, q, t + vlen + 1);
+      vec_mul_any(qlen, t + vlen + 1, vlen, v, t2);
+      vec_sub_on(ulen, u, vec_skip_leading_zeros(qlen + vlen, t2), t2);
+    }
+  }
 
-          if (carry)
-            xk[ylen] = (uchar)((xk[ylen] + 1) & BYTE_MASK);
+  if (t != small_t)
+    vec_delete(t);
 
-        }  // second if carry
-      } // first if carry
-    }  // if qk
-  }  // for k
+  ulen = vec_skip_leading_zeros(ulen, u);
 
-  // Set (digit_type) w = (uchar) x for the remainder.
-  vec_from_char(ylen, x, ulen, w);
+  while (vec_cmp(ulen, u, vlen, v) >= 0) {
+    vec_sub_on(ulen, u, vlen, v);
+    if (q)
+      vec_add_small_on(vlen + 1, q, 1);
+    ulen = vec_skip_leading_zeros(ulen, u);
+  }
 
-#ifndef MAX_NBITS
-  delete [] x;
-  delete [] y;
-#endif
+  return (q ? vec_skip_leading_zeros(vlen + 1, q) : 0);
 
 }
 
@@ -1301,6 +2520,137 @@ vec_from_char(length_type ulen, const uchar *u,
 
 }
 
+// Set v = the unb low bits of the 2's complement of the number with
+// sign us and magnitude u, packed into whole digit_types, least
+// significant first. The bits of the last digit_type above unb copy
+// the sign. v has room for DIV_CEIL2(unb, BITS_PER_DIGIT_TYPE)
+// digit_types.
+void
+vec_to_packed_2C(small_type us, length_type unb, length_type ulen,
+                 const digit_type *u, digit_type *v)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert((unb >= 0) && (unb <= ulen * (length_type) BITS_PER_DIGIT));
+  assert((u != NULL) && (v != NULL));
+#endif
+
+  const length_type vlen = DIV_CEIL2(unb, (length_type) BITS_PER_DIGIT_TYPE);
+
+  if (us == SC_ZERO) {
+    vec_zero(vlen, v);
+    return;
+  }
+
+  // Each digit is complemented as it is read, instead of complementing
+  // a copy of u first.
+  register digit_type carry = 1;
+  register digit_type acc = 0;
+  register length_type nacc = 0;  // Number of bits in acc.
+  register length_type j = 0;
+
+  for (register length_type i = 0; (i < ulen) && (j < vlen); ++i) {
+
+    register digit_type d = u[i];
+
+    if (us == SC_NEG) {
+      carry += (~d & DIGIT_MASK);
+      d = carry & DIGIT_MASK;
+      carry >>= BITS_PER_DIGIT;
+    }
+
+    acc |= d << nacc;
+    nacc += BITS_PER_DIGIT;
+
+    if (nacc >= (length_type) BITS_PER_DIGIT_TYPE) {
+      v[j++] = acc;
+      nacc -= BITS_PER_DIGIT_TYPE;
+      acc = d >> (BITS_PER_DIGIT - nacc);
+    }
+
+  }
+
+  while (j < vlen) {
+    v[j++] = acc;
+    acc = 0;
+  }
+
+  length_type r = unb % BITS_PER_DIGIT_TYPE;
+
+  if (r != 0) {
+    if (us == SC_NEG)
+      v[vlen - 1] |= ~one_and_ones(r);
+    else
+      v[vlen - 1] &= one_and_ones(r);
+  }
+
+}
+
+// The characters of each byte value, most significant bit first.
+static char bin_chars_of_byte[BYTE_RADIX][BITS_PER_BYTE];
+static bool bin_chars_of_byte_ready = false;
+
+static void
+make_bin_chars_of_byte()
+{
+  for (register int b = 0; b < (int) BYTE_RADIX; ++b)
+    for (register int k = 0; k < BITS_PER_BYTE; ++k)
+      bin_chars_of_byte[b][k] = 
+        ((b >> (BITS_PER_BYTE - 1 - k)) & 1) ? '1' : '0';
+  bin_chars_of_byte_ready = true;
+}
+
+// Set v = the unb low bits of the 2's complement of the number with
+// sign us and magnitude u, as the characters '0' and '1', most
+// significant bit first. v is not null-terminated. The digits are
+// formatted a byte at a time.
+void
+vec_to_bin_chars(small_type us, length_type unb,
+                 const digit_type *u, char *v)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert(unb >= 0);
+  assert((u != NULL) && (v != NULL));
+#endif
+
+  if (! bin_chars_of_byte_ready)
+    make_bin_chars_of_byte();
+
+  register char *p = v + unb;
+  register digit_type carry = 1;
+
+  for (register length_type i = 0; p > v; ++i) {
+
+    register digit_type d = u[i];
+
+    if (us == SC_ZERO)
+      d = 0;
+    else if (us == SC_NEG) {
+      carry += (~d & DIGIT_MASK);
+      d = carry & DIGIT_MASK;
+      carry >>= BITS_PER_DIGIT;
+    }
+
+    register length_type n = BITS_PER_DIGIT;
+    if (n > p - v)
+      n = p - v;
+
+    for ( ; n >= BITS_PER_BYTE; n -= BITS_PER_BYTE) {
+      p -= BITS_PER_BYTE;
+      memcpy(p, bin_chars_of_byte[d & BYTE_MASK], BITS_PER_BYTE);
+      d >>= BITS_PER_BYTE;
+    }
+
+    while (n-- > 0) {
+      *--p = (d & 1) ? '1' : '0';
+      d >>= 1;
+    }
+
+  }
+
+}
+
 // Set u <<= nsl.
 // If nsl is negative, it is ignored.
 void 
@@ -1455,7 +2805,7 @@ vec_reverse(length_type unb, length_type und, digit_type *ud,
 #ifdef MAX_NBITS
   digit_type d[MAX_NDIGITS];
 #else
-  digit_type *d = new digit_type[und];
+  digit_type *d = vec_new(und);
 #endif
 
   // d is a copy of ud.
@@ -1474,7 +2824,7 @@ vec_reverse(length_type unb, length_type und, digit_type *ud,
   }
 
 #ifndef MAX_NBITS
-  delete [] d;
+  vec_delete(d);
 #endif
     
 }
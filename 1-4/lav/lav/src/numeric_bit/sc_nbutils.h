@@ -91,6 +91,12 @@ small_type
 vec_from_str(length_type unb, length_type und, digit_type *u, 
              const char *v, sc_numrep base = SC_NOBASE) ;
 
+// Write the digits of u in base b into v.
+extern
+length_type
+vec_to_str(length_type ulen, digit_type *u, small_type b,
+           const char *xdigs, char *v);
+
 ///////////////////////////////////////////////////////////////////////////
 // Naming convention for the vec_ functions below:
 //   vec_OP(u, v, w)  : computes w = u OP v.
@@ -101,6 +107,24 @@ vec_from_str(length_type unb, length_type und, digit_type *u,
 //   Xlen             : the number of digits in X.
 ///////////////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////////////
+// Functions to allocate vectors.
+///////////////////////////////////////////////////////////////////////////
+
+// The digits of numbers wider than the inline digits, the temporaries
+// of the operators on them, and the scratch vectors of the
+// multiplication and division routines are allocated by vec_new() and
+// released by vec_delete(). Released vectors are kept for the next
+// vec_new() of the same size class, so that an expression on wide
+// numbers reuses the digits of its earlier temporaries instead of
+// going to the heap for each operator.
+
+extern
+digit_type *vec_new(length_type n);
+
+extern
+void vec_delete(digit_type *d);
+
 ///////////////////////////////////////////////////////////////////////////
 // Functions for vector addition: w = u + v or u += v.
 ///////////////////////////////////////////////////////////////////////////
@@ -161,11 +185,34 @@ vec_sub_small_on(length_type ulen, digit_type *u, digit_type v);
 // Functions for vector multiplication: w = u * v or u *= v.
 ///////////////////////////////////////////////////////////////////////////
 
+// Operands of at least VEC_MUL_KARATSUBA_THRESHOLD digits are
+// multiplied by Karatsuba's method, and those of at least
+// VEC_MUL_TOOM3_THRESHOLD digits by Toom-3; the thresholds were
+// measured for digits of 30 and 62 bits. Only 62-bit digits
+// multiplied by halves have a lower Karatsuba threshold.
+//
+// sc_signed and sc_unsigned operands have at most DIV_CEIL(MAX_NBITS)
+// digits, fewer than either threshold at the default MAX_NBITS of
+// 510, so their products go to vec_mul_basecase() unless MAX_NBITS is
+// undefined or raised. vec_mul() itself takes vectors of any length;
+// bench/vec_mul_bench.cpp checks it against vec_mul_basecase().
+#ifdef SC_DOUBLE_DIGIT
+const length_type VEC_MUL_KARATSUBA_THRESHOLD = 24;
+#else
+const length_type VEC_MUL_KARATSUBA_THRESHOLD = (BITS_PER_DIGIT < 32) ? 24 : 16;
+#endif
+const length_type VEC_MUL_TOOM3_THRESHOLD     = 128;
+
 extern 
 void 
 vec_mul(length_type ulen, const digit_type *u, 
         length_type vlen, const digit_type *v, digit_type *w);
 
+extern 
+void 
+vec_mul_basecase(length_type ulen, const digit_type *u, 
+                 length_type vlen, const digit_type *v, digit_type *w);
+
 extern 
 void 
 vec_mul_small(length_type ulen, const digit_type *u,
@@ -189,6 +236,17 @@ void
 vec_div_small(length_type ulen, const digit_type *u, 
               digit_type v, digit_type *w);
 
+extern
+int
+vec_div_normalize(length_type vlen, const digit_type *v, 
+                  digit_type *y, digit_type &di);
+
+extern
+void
+vec_div_norm(length_type ulen, const digit_type *u,
+             length_type vlen, const digit_type *y, int s, digit_type di,
+             digit_type *q, digit_type *r);
+
 ///////////////////////////////////////////////////////////////////////////
 // Functions for vector remainder: w = u % v or u %= v.
 ///////////////////////////////////////////////////////////////////////////
@@ -206,6 +264,25 @@ extern
 digit_type 
 vec_rem_on_small(length_type ulen, digit_type *u, digit_type v);
 
+///////////////////////////////////////////////////////////////////////////
+// Functions for repeated division by the same v (Barrett's method).
+///////////////////////////////////////////////////////////////////////////
+
+// Barrett's method pays over vec_div_norm() for divisors of at least
+// VEC_DIV_BARRETT_THRESHOLD digits, where the products are no longer
+// schoolbook ones.
+const length_type VEC_DIV_BARRETT_THRESHOLD = 80;
+
+extern
+void
+vec_barrett_inverse(length_type vlen, const digit_type *v, digit_type *inv);
+
+extern
+length_type
+vec_div_barrett(length_type ulen, digit_type *u,
+                length_type vlen, const digit_type *v,
+                const digit_type *inv, digit_type *q);
+
 ///////////////////////////////////////////////////////////////////////////
 // Functions to convert between vectors of char and digit_type.
 ///////////////////////////////////////////////////////////////////////////
@@ -220,6 +297,16 @@ void
 vec_from_char(length_type ulen, const uchar *u,
               length_type vlen, digit_type *v);
 
+extern
+void
+vec_to_packed_2C(small_type us, length_type unb, length_type ulen,
+                 const digit_type *u, digit_type *v);
+
+extern
+void
+vec_to_bin_chars(small_type us, length_type unb,
+                 const digit_type *u, char *v);
+
 ///////////////////////////////////////////////////////////////////////////
 // Functions to shift left or right, or to create a mirror image of vectors.
 ///////////////////////////////////////////////////////////////////////////
@@ -385,7 +472,8 @@ vec_cmp(length_type ulen, const digit_type *u,
   assert((u[ulen] & DIGIT_MASK) != (v[ulen] & DIGIT_MASK));
 #endif
 
-  return (length_type) (u[ulen] - v[ulen]);
+  // The difference of two digits may not fit into a length_type.
+  return ((u[ulen] > v[ulen]) ? 1 : -1);
 
 }
 
@@ -410,6 +498,30 @@ vec_find_first_nonzero(length_type ulen, const digit_type *u)
   
 }
 
+// Return true if any of the n least significant bits of u is one.
+inline
+bool
+vec_low_bits_nonzero(length_type ulen, const digit_type *u, length_type n)
+{
+
+#ifdef DEBUG_SYSTEMC
+  assert((ulen > 0) && (u != NULL));
+#endif
+
+  length_type nd = digit_ord(n);
+
+  if (nd >= ulen)
+    return (vec_find_first_nonzero(ulen, u) >= 0);
+
+  for (register length_type i = 0; i < nd; ++i) {
+    if (u[i])
+      return true;
+  }
+
+  return ((u[nd] & one_and_ones(bit_ord(n))) != 0);
+
+}
+
 // Skip all the leading zero digits.  
 // - ulen (before) = the number of digits in u.
 // - the returned value = the number of non-zero digits in u.
@@ -786,6 +898,12 @@ inline
 small_type 
 convert_signed_SM_to_2C_to_SM(small_type s, length_type nb, length_type nd, digit_type *d)
 {
+  // A magnitude below 2^(nb - 1) is in range for either sign, and the
+  // conversions would give it back unchanged. Then, only the sign of
+  // zero needs to be fixed, and the digits are not complemented.
+  if ((d[nd - 1] >> bit_ord(nb - 1)) == 0)
+    return check_for_zero((s == SC_NEG) ? SC_NEG : SC_POS, nd, d);
+
   convert_SM_to_2C(s, nd, d);
   return convert_signed_2C_to_SM(nb, nd, d);
 }
@@ -950,6 +1068,93 @@ is_bad_double(double v)
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////
+// Functions on vectors of N digits, where N is known at compile time,
+// as for sc_bigint<W> and sc_biguint<W>. Their loops have a constant
+// trip count, so the compiler can unroll them. The results are modulo
+// DIGIT_RADIX^N.
+///////////////////////////////////////////////////////////////////////////
+
+template< int N >
+struct vec_fixed {
+
+  // u = 0
+  static void zero(digit_type *u)
+  {
+    for (int i = 0; i < N; ++i)
+      u[i] = 0;
+  }
+
+  // u = v
+  static void copy(digit_type *u, const digit_type *v)
+  {
+    for (int i = 0; i < N; ++i)
+      u[i] = v[i];
+  }
+
+  // Is u == 0?
+  static bool is_zero(const digit_type *u)
+  {
+    digit_type x = 0;
+    for (int i = 0; i < N; ++i)
+      x |= u[i];
+    return (x == 0);
+  }
+
+  // u = u + v
+  static void add_on(digit_type *u, const digit_type *v)
+  {
+    digit_type carry = 0;
+    for (int i = 0; i < N; ++i) {
+      carry += u[i] + v[i];
+      u[i] = carry & DIGIT_MASK;
+      carry >>= BITS_PER_DIGIT;
+    }
+  }
+
+  // u = u - v
+  static void sub_on(digit_type *u, const digit_type *v)
+  {
+    digit_type borrow = 0;
+    for (int i = 0; i < N; ++i) {
+      digit_type x = u[i] - v[i] - borrow;
+      borrow = (x > DIGIT_MASK);
+      u[i] = x & DIGIT_MASK;
+    }
+  }
+
+  // u = -u, i.e., the 2's complement of u.
+  static void complement(digit_type *u)
+  {
+    digit_type carry = 1;
+    for (int i = 0; i < N; ++i) {
+      carry += (~u[i] & DIGIT_MASK);
+      u[i] = carry & DIGIT_MASK;
+      carry >>= BITS_PER_DIGIT;
+    }
+  }
+
+  // u = u & v, u | v, and u ^ v.
+  static void and_on(digit_type *u, const digit_type *v)
+  {
+    for (int i = 0; i < N; ++i)
+      u[i] &= v[i];
+  }
+
+  static void or_on(digit_type *u, const digit_type *v)
+  {
+    for (int i = 0; i < N; ++i)
+      u[i] |= v[i];
+  }
+
+  static void xor_on(digit_type *u, const digit_type *v)
+  {
+    for (int i = 0; i < N; ++i)
+      u[i] ^= v[i];
+  }
+
+};
+
 ///////////////////////////////////////////////////////////////////////////
 
 #endif
@@ -51,11 +51,8 @@
 #include "sc_nbdefs.h"
 
 #define LLSIZE 64
-#ifndef WIN32
-#define MASK(W) ( (1ULL<<W)-1 )
-#else
-#define MASK(W) ( (1i64<<W)-1 )
-#endif
+// The low W bits, 1 <= W <= LLWIDTH.
+#define MASK(W) ( ~((uint64) 0) >> (LLWIDTH - (W)) )
 
 // Forward declarations
 class sc_uint_bitref;
@@ -76,8 +73,6 @@ template<int W> class sc_lv;
 using sc_bv_ns::sc_bv;
 using sc_bv_ns::sc_lv;
 
-extern const uint64 mask64[LLWIDTH][LLWIDTH];
-
 //Base class for sc_uint. 
 
 class sc_uint_base {
@@ -91,10 +86,10 @@ public:
   
 
   /* Constructors */
-  sc_uint_base() : num(0),width(LLWIDTH) { } 
-  explicit sc_uint_base(int w) : num(0),width(w) { }
-  sc_uint_base(uint64 value, int w) : width(w) { num = value & MASK(w); }
-  sc_uint_base( const sc_uint_base& v ) { width = v.width; num = v.num; }
+  SC_CONSTEXPR sc_uint_base() : num(0),width(LLWIDTH) { } 
+  explicit SC_CONSTEXPR sc_uint_base(int w) : num(0),width(w) { }
+  SC_CONSTEXPR sc_uint_base(uint64 value, int w) : num(value & MASK(w)),width(w) { }
+  SC_CONSTEXPR sc_uint_base( const sc_uint_base& v ) : num(v.num),width(v.width) { }
   sc_uint_base( const sc_uint_subref& v );
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_uint_base( const sc_uint_concat<T1,T2>& v )
@@ -108,11 +103,11 @@ public:
   sc_uint_base( const sc_signed& v );
   sc_uint_base( const sc_unsigned& v );
 
-  // Destructor
-  ~sc_uint_base() { }
+  // No destructor, so that the implicit one is trivial and
+  // sc_uint_base is a literal type.
   
   // Assignment operators
-  sc_uint_base& operator=( uint64 v ) { num = v & MASK(width); return *this; }
+  SC_CONSTEXPR sc_uint_base& operator=( uint64 v ) { num = v & MASK(width); return *this; }
   sc_uint_base& operator=( const sc_uint_subref& v); 
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_uint_base& operator=( const sc_uint_concat<T1,T2>& v)
@@ -133,11 +128,11 @@ public:
   sc_uint_base& operator = ( const sc_fxnum_fast& );
 #endif
 
-  operator uint64() const { return num; }
+  SC_CONSTEXPR operator uint64() const { return num; }
   
-  unsigned int to_uint() const {return (unsigned int)num; }
-  int to_int() const {return (int)num; }
-  long long_low() const { 
+  SC_CONSTEXPR unsigned int to_uint() const {return (unsigned int)num; }
+  SC_CONSTEXPR int to_int() const {return (int)num; }
+  SC_CONSTEXPR long long_low() const { 
 #ifndef WIN32
       return (long)(num & 0x00000000ffffffffULL);
 #else
@@ -145,7 +140,7 @@ public:
 #endif
   }
 
-  long long_high() const {
+  SC_CONSTEXPR long long_high() const {
 #ifndef WIN32
       return (long)( (num >> 32)  & 0x00000000ffffffffULL );
 #else
@@ -154,7 +149,7 @@ public:
   }
 
   //Arithmetic operators
-  sc_uint_base& operator+=( uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator+=( uint64 v) 
   {
     uint64 val = num;
     val += v;
@@ -162,7 +157,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator-=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator-=(uint64 v) 
   {
     uint64 val = num;
     val -= v;
@@ -170,7 +165,7 @@ public:
     return *this;
   }
     
-  sc_uint_base& operator*=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator*=(uint64 v) 
   {
     uint64 val = num;
     val *= v;
@@ -178,7 +173,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator/=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator/=(uint64 v) 
  {
     uint64 val = num;
     val /= v;
@@ -186,7 +181,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator%=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator%=(uint64 v) 
   {
     uint64 val = num;
     val %= v;
@@ -195,7 +190,7 @@ public:
   }
   
   //Bitwise operators
-  sc_uint_base& operator&=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator&=(uint64 v) 
   {
     uint64 val = num;
     val &= v;
@@ -203,7 +198,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator|=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator|=(uint64 v) 
   {
     uint64 val = num;
     val |= v;
@@ -211,7 +206,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator^=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator^=(uint64 v) 
   {
     uint64 val = num;
     val ^= v;
@@ -219,7 +214,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator<<=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator<<=(uint64 v) 
   {
     
     uint64 val = num;
@@ -228,7 +223,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator>>=(uint64 v) 
+  SC_CONSTEXPR sc_uint_base& operator>>=(uint64 v) 
   {
     uint64 val = num;
     val >>= v;
@@ -237,7 +232,7 @@ public:
   }
   
   //postfix and prefix increment & decrement operators
-  sc_uint_base& operator++() // prefix
+  SC_CONSTEXPR sc_uint_base& operator++() // prefix
   {
     uint64 val = num;
     ++val;
@@ -246,7 +241,7 @@ public:
     return *this;
   }
 
-  const sc_uint_base operator++(int) // postfix
+  SC_CONSTEXPR const sc_uint_base operator++(int) // postfix
   {
     uint64 val = num;
     uint64 tmp = val;
@@ -256,7 +251,7 @@ public:
     return sc_uint_base(tmp, width);
   }
 
-  sc_uint_base& operator--() //prefix
+  SC_CONSTEXPR sc_uint_base& operator--() //prefix
   {
     uint64 val = num;
     --val;
@@ -265,7 +260,7 @@ public:
     return *this;
   }
   
-  const sc_uint_base operator--(int) //postfix 
+  SC_CONSTEXPR const sc_uint_base operator--(int) //postfix 
   {
     uint64 val = num;
     uint64 tmp = val;
@@ -279,11 +274,11 @@ public:
   // Bit-select and part-select operators
   
   sc_uint_bitref operator[] ( int i ); 
-  bit operator[] (int i) const { return test(i); }
+  SC_CONSTEXPR bit operator[] (int i) const { return test(i); }
   sc_uint_subref range(int left, int right ); 
-  uint64 range( int left, int right ) const;
+  SC_CONSTEXPR uint64 range( int left, int right ) const;
 
-  bit test(int i) const 
+  SC_CONSTEXPR bit test(int i) const 
   {
 #ifndef WIN32
       return (  0 != ( num & (1ULL << i) ) ); 
@@ -292,7 +287,7 @@ public:
 #endif
   }  
 
-  void set(int i) 
+  SC_CONSTEXPR void set(int i) 
   {
 #ifndef WIN32
       num |= (1ULL << i); 
@@ -300,7 +295,7 @@ public:
       num |= (1i64 << i);
 #endif
   }
-  void set(int i, bit v )
+  SC_CONSTEXPR void set(int i, bit v )
   {
 #ifndef WIN32
     uint64 val = num;  
@@ -315,19 +310,19 @@ public:
 #endif
   }
 
-  int bitwidth() const { return width; }
+  SC_CONSTEXPR int bitwidth() const { return width; }
 
-  friend bool operator == ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator == ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num == b.num; }
-  friend bool operator != ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator != ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num != b.num; }
-  friend bool operator < ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator < ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num < b.num; }
-  friend bool operator <= ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator <= ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num <= b.num; }
-  friend bool operator > ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator > ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num > b.num; }
-  friend bool operator >= ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator >= ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num >= b.num; }
 
 };
@@ -346,10 +341,10 @@ class sc_uint : public sc_uint_base {
 
 public:
   // Constructors
-  sc_uint() : sc_uint_base(W) { }
-  sc_uint( uint64 v) : sc_uint_base(W) { num = v & MASK(W); }
-  sc_uint( const sc_uint<W>& v) : sc_uint_base(W) { num = v.num ; }
-  sc_uint( const sc_uint_base& v ) : sc_uint_base(W) { num = v.num & MASK(W); }
+  SC_CONSTEXPR sc_uint() : sc_uint_base(W) { }
+  SC_CONSTEXPR sc_uint( uint64 v) : sc_uint_base(W) { num = v & MASK(W); }
+  SC_CONSTEXPR sc_uint( const sc_uint<W>& v) : sc_uint_base(W) { num = v.num ; }
+  SC_CONSTEXPR sc_uint( const sc_uint_base& v ) : sc_uint_base(W) { num = v.num & MASK(W); }
   sc_uint( const sc_uint_subref& v ) : sc_uint_base( v ) { }
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_uint( const sc_uint_concat<T1,T2>& v) : sc_uint_base(v) { }
@@ -368,10 +363,10 @@ public:
   sc_uint( const sc_lv<W>& v );
 
  //Assignment operators
- sc_uint& operator=(uint64 v) { num = v & MASK(W); return *this; }
- sc_uint& operator=( const sc_uint_base& v ) { num = v.num & MASK(W); return *this; }
+ SC_CONSTEXPR sc_uint& operator=(uint64 v) { num = v & MASK(W); return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint_base& v ) { num = v.num & MASK(W); return *this; }
  sc_uint& operator=( const sc_uint_subref& v ) { sc_uint_base::operator=(v); return *this; }
- sc_uint& operator=( const sc_uint<W>& v) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint<W>& v) { num = v.num; return *this; }
 #if !defined(__SUNPRO_CC)
  template<class T1, class T2> sc_uint& operator=( const sc_uint_concat<T1,T2>& v) 
    { sc_uint_base::operator=(v); return *this; }
@@ -392,7 +387,7 @@ public:
     // operator uint64() const { return num; }
  
  //Arithmetic operators
-  sc_uint& operator+=( uint64 v) 
+  SC_CONSTEXPR sc_uint& operator+=( uint64 v) 
   {
     uint64 val = num;
     val += v;
@@ -400,7 +395,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator-=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator-=(uint64 v) 
   {
     uint64 val = num;
     val -= v;
@@ -408,7 +403,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator*=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator*=(uint64 v) 
   {
     uint64 val = num;
     val *= v;
@@ -416,7 +411,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator/=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator/=(uint64 v) 
   {
     uint64 val = num;
     val /= v;
@@ -424,7 +419,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator%=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator%=(uint64 v) 
   {
     uint64 val = num;
     val %= v;
@@ -433,7 +428,7 @@ public:
   }
   
   //Bitwise operators
-  sc_uint& operator&=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator&=(uint64 v) 
   {
     uint64 val = num;
     val &= v;
@@ -441,7 +436,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator|=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator|=(uint64 v) 
   {
     uint64 val = num;
     val |= v;
@@ -449,7 +444,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator^=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator^=(uint64 v) 
   {
     uint64 val = num;
     val ^= v;
@@ -457,7 +452,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator<<=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator<<=(uint64 v) 
   {
     uint64 val = num;
     val <<= v;
@@ -465,10 +460,10 @@ public:
     return *this;
   }
 
-  sc_uint& operator>>=(uint64 v) { num >>= v; return *this; }
+  SC_CONSTEXPR sc_uint& operator>>=(uint64 v) { num >>= v; return *this; }
   
   //postfix and prefix increment & decrement operators
-  sc_uint& operator++() // prefix
+  SC_CONSTEXPR sc_uint& operator++() // prefix
   {
     uint64 val = num;
     ++val;
@@ -477,7 +472,7 @@ public:
     return *this;
   }
 
-  const sc_uint operator++(int) // postfix
+  SC_CONSTEXPR const sc_uint operator++(int) // postfix
   {
     uint64 val = num;   
     uint64 tmp = val;
@@ -487,7 +482,7 @@ public:
     return sc_uint<W>(tmp);
   }
 
-  sc_uint& operator--() //prefix
+  SC_CONSTEXPR sc_uint& operator--() //prefix
   {
     uint64 val = num;  
     --val;
@@ -496,7 +491,7 @@ public:
     return *this;
   }
   
-  const sc_uint operator--(int) //postfix 
+  SC_CONSTEXPR const sc_uint operator--(int) //postfix 
   {
     uint64 val = num;
     uint64 tmp = val;
@@ -522,10 +517,10 @@ class sc_uint<LLSIZE> : public sc_uint_base {
 
 public:
   // Constructors
-  sc_uint() : sc_uint_base(LLSIZE) { }
-  sc_uint( uint64 v) : sc_uint_base(v, LLSIZE) { }
-  sc_uint( const sc_uint<LLSIZE>& v) { num = v.num ; }
-  sc_uint( const sc_uint_base& v ) : sc_uint_base(LLSIZE) { num = v.num; }
+  SC_CONSTEXPR sc_uint() : sc_uint_base(LLSIZE) { }
+  SC_CONSTEXPR sc_uint( uint64 v) : sc_uint_base(v, LLSIZE) { }
+  SC_CONSTEXPR sc_uint( const sc_uint<LLSIZE>& v) { num = v.num ; }
+  SC_CONSTEXPR sc_uint( const sc_uint_base& v ) : sc_uint_base(LLSIZE) { num = v.num; }
   sc_uint( const sc_uint_subref& v ) : sc_uint_base( v ) { }
 #if !defined(__SUNPRO_CC)
   template<class T1,class T2> sc_uint( const sc_uint_concat<T1, T2>& v) : sc_uint_base(v){}
@@ -536,10 +531,10 @@ public:
   sc_uint( const sc_unsigned& v ) : sc_uint_base(v) { }
 
  //Assignment operators
- sc_uint& operator=(uint64 v) { num = v; return *this; }
- sc_uint& operator=( const sc_uint_base& v ) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_uint& operator=(uint64 v) { num = v; return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint_base& v ) { num = v.num; return *this; }
  sc_uint& operator=( const sc_uint_subref& v ) { sc_uint_base::operator=(v); return *this;}
- sc_uint& operator=( const sc_uint<LLSIZE>& v) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint<LLSIZE>& v) { num = v.num; return *this; }
 #if !defined(__SUNPRO_CC)
  template<class T1, class T2> sc_uint& operator=(const sc_uint_concat<T1,T2>& v) 
    { sc_uint_base::operator=(v); return *this; }
@@ -552,84 +547,84 @@ public:
     // operator uint64() const { return num; }
  
  //Arithmetic operators
-  sc_uint& operator+=( uint64 v) 
+  SC_CONSTEXPR sc_uint& operator+=( uint64 v) 
   {
     num += v;
     return *this;
   }
 
-  sc_uint& operator-=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator-=(uint64 v) 
   {
     num -= v;
     return *this;
   }
 
-  sc_uint& operator*=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator*=(uint64 v) 
   {
     num *= v;
     return *this;
   }
 
-  sc_uint& operator/=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator/=(uint64 v) 
   {
     num /= v;
     return *this;
   }
 
-  sc_uint& operator%=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator%=(uint64 v) 
   {
     num %= v;
     return *this;
   }
   
   //Bitwise operators
-  sc_uint& operator&=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator&=(uint64 v) 
   {
     num &= v;
     return *this;
   }
 
-  sc_uint& operator|=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator|=(uint64 v) 
   {
     num |= v;
     return *this;
   }
 
-  sc_uint& operator^=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator^=(uint64 v) 
   {
     num ^= v;
     return *this;
   }
 
-  sc_uint& operator<<=(uint64 v) 
+  SC_CONSTEXPR sc_uint& operator<<=(uint64 v) 
   {
     num <<= v;
     return *this;
   }
 
-  sc_uint& operator>>=(uint64 v) { num >>= v; return *this; }
+  SC_CONSTEXPR sc_uint& operator>>=(uint64 v) { num >>= v; return *this; }
   
   //postfix and prefix increment & decrement operators
-  sc_uint& operator++() // prefix
+  SC_CONSTEXPR sc_uint& operator++() // prefix
   {
     ++num;
     return *this;
   }
 
-  const sc_uint operator++(int) // postfix
+  SC_CONSTEXPR const sc_uint operator++(int) // postfix
   {
     uint64 tmp = num;
     num++;
     return sc_uint<LLSIZE>(tmp);
   }
 
-  sc_uint& operator--() //prefix
+  SC_CONSTEXPR sc_uint& operator--() //prefix
   {
     --num;
     return *this;
   }
   
-  const sc_uint operator--(int) //postfix 
+  SC_CONSTEXPR const sc_uint operator--(int) //postfix 
   {
     uint64 tmp = num;
     num--;
@@ -664,7 +659,7 @@ public:
   
   sc_uint_bitref& operator&=( bit b )
   {
-    obj->num &= ~ ( ( !b ) << index );
+    obj->num &= ~ ( (uint64) ( !b ) << index );
     return *this;
   }
   sc_uint_bitref& operator|=( bit b )
@@ -717,60 +712,38 @@ public:
   
   sc_uint_subref& operator=( const sc_uint_base& v)
   { 
-    uint64 val = obj->num;
-    // Mask the bits out that are part-selected
-
-    val &= mask64[left][right];
-
-    // set the part-selected bits
-    val |= (v.num << right) & ~mask64[left][right]; 
-
-    // Normalize the value 
-    val &= MASK(obj->width);
-
-    obj->num = val;
-    
-    return *this;
+    return operator=( v.num );
   }
     
   sc_uint_subref& operator=( const sc_uint_subref& v)
   {
     if( this == &v )
       return *this;
-    return operator=(v.operator uint64() );
+    return operator=( v.operator uint64() );
   }
   
   sc_uint_subref& operator=( uint64 v )
   {
-   uint64 val = obj->num;
-   
-   // Mask the bits out that are part-selected
-     val &= mask64[left][right];
-   
-    // set the part-selected bits
-      val |= (v << right) & ~mask64[left][right]; 
-    
-   // Normalize the value
-    val &= MASK(obj->width);
+    // Replace the part-selected bits. If left < right, the range is
+    // reversed: bit i of v goes to bit right - i. set_field64() leaves
+    // a reversed range alone, so only the reversed fix-up is conditional.
+    uint64 val = set_field64(obj->num, v, left, right);
+    if( left < right )
+      val = set_reversed_field64(val, v, left, right);
 
-    obj->num = val;
+    // Normalize the value
+    obj->num = val & MASK(obj->width);
     return *this;
   }
   
   operator uint64() const 
   { 
-    uint64 val = obj->num;  
-    if( left == obj->width - 1 )
-      return val >> right;
-    else
-#ifndef WIN32
-     return ( ( val & ( (1ULL << (left + 1)) - 1 ) ) >> right ); 
-#else
-     return ( ( val & ( (1i64 << (left + 1)) - 1 ) ) >> right );
-#endif
+    if( left >= right )
+      return get_field64(obj->num, left, right);
+    return get_reversed_field64(obj->num, left, right);
   }
-  
-  int bitwidth() const { return (left - right + 1); }
+
+  int bitwidth() const { return (left >= right) ? left - right + 1 : right - left + 1; }
   
 private:
   sc_uint_base* obj;
@@ -49,7 +49,8 @@
 #include "sc_nbdefs.h"
 
 #define INTSIZE 32
-#define MASK(W) ( (1U<<W)-1 )
+// The low W bits, 1 <= W <= INTWIDTH.
+#define MASK(W) ( ~0U >> (INTWIDTH - (W)) )
 
 // Forward declarations
 class sc_uint_bitref;
@@ -70,8 +71,6 @@ template<int W> class sc_lv;
 using sc_bv_ns::sc_bv;
 using sc_bv_ns::sc_lv;
 
-extern const unsigned int mask32[INTWIDTH][INTWIDTH];
-
 //Base class for sc_uint. 
 
 class sc_uint_base {
@@ -85,10 +84,10 @@ public:
   
 
   /* Constructors */
-  sc_uint_base() : num(0),width(INTWIDTH) { } 
-  explicit sc_uint_base(int w) : num(0),width(w) { }
-  sc_uint_base(unsigned int value, int w) : width(w) { num = value & MASK(w); }
-  sc_uint_base( const sc_uint_base& v ) { width = v.width; num = v.num; }
+  SC_CONSTEXPR sc_uint_base() : num(0),width(INTWIDTH) { } 
+  explicit SC_CONSTEXPR sc_uint_base(int w) : num(0),width(w) { }
+  SC_CONSTEXPR sc_uint_base(unsigned int value, int w) : num(value & MASK(w)),width(w) { }
+  SC_CONSTEXPR sc_uint_base( const sc_uint_base& v ) : num(v.num),width(v.width) { }
   sc_uint_base( const sc_uint_subref& v );
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_uint_base( const sc_uint_concat<T1,T2>& v )
@@ -102,11 +101,11 @@ public:
   sc_uint_base( const sc_signed& v );
   sc_uint_base( const sc_unsigned& v );
 
-  // Destructor
-  ~sc_uint_base() { }
+  // No destructor, so that the implicit one is trivial and
+  // sc_uint_base is a literal type.
   
   // Assignment operators
-  sc_uint_base& operator=( unsigned int v ) { num = v & MASK(width); return *this; }
+  SC_CONSTEXPR sc_uint_base& operator=( unsigned int v ) { num = v & MASK(width); return *this; }
   sc_uint_base& operator=( const sc_uint_subref& v); 
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_uint_base& operator=( const sc_uint_concat<T1,T2>& v)
@@ -127,13 +126,13 @@ public:
   sc_uint_base& operator = ( const sc_fxnum_fast& );
 #endif
 
-  operator unsigned int() const { return num; }
+  SC_CONSTEXPR operator unsigned int() const { return num; }
   
-  unsigned int to_uint() const {return (unsigned int)num; }
-  int to_int() const {return (int)num; }
+  SC_CONSTEXPR unsigned int to_uint() const {return (unsigned int)num; }
+  SC_CONSTEXPR int to_int() const {return (int)num; }
 
   //Arithmetic operators
-  sc_uint_base& operator+=( unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator+=( unsigned int v) 
   {
     unsigned int val = num;
     val += v;
@@ -141,7 +140,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator-=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator-=(unsigned int v) 
   {
     unsigned int val = num;
     val -= v;
@@ -149,7 +148,7 @@ public:
     return *this;
   }
     
-  sc_uint_base& operator*=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator*=(unsigned int v) 
   {
     unsigned int val = num;
     val *= v;
@@ -157,7 +156,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator/=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator/=(unsigned int v) 
  {
     unsigned int val = num;
     val /= v;
@@ -165,7 +164,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator%=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator%=(unsigned int v) 
   {
     unsigned int val = num;
     val %= v;
@@ -174,7 +173,7 @@ public:
   }
   
   //Bitwise operators
-  sc_uint_base& operator&=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator&=(unsigned int v) 
   {
     unsigned int val = num;
     val &= v;
@@ -182,7 +181,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator|=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator|=(unsigned int v) 
   {
     unsigned int val = num;
     val |= v;
@@ -190,7 +189,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator^=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator^=(unsigned int v) 
   {
     unsigned int val = num;
     val ^= v;
@@ -198,7 +197,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator<<=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator<<=(unsigned int v) 
   {
     
     unsigned int val = num;
@@ -207,7 +206,7 @@ public:
     return *this;
   }
 
-  sc_uint_base& operator>>=(unsigned int v) 
+  SC_CONSTEXPR sc_uint_base& operator>>=(unsigned int v) 
   {
     unsigned int val = num;
     val >>= v;
@@ -216,7 +215,7 @@ public:
   }
   
   //postfix and prefix increment & decrement operators
-  sc_uint_base& operator++() // prefix
+  SC_CONSTEXPR sc_uint_base& operator++() // prefix
   {
     unsigned int val = num;
     ++val;
@@ -225,7 +224,7 @@ public:
     return *this;
   }
 
-  const sc_uint_base operator++(int) // postfix
+  SC_CONSTEXPR const sc_uint_base operator++(int) // postfix
   {
     unsigned int val = num;
     unsigned int tmp = val;
@@ -235,7 +234,7 @@ public:
     return sc_uint_base(tmp, width);
   }
 
-  sc_uint_base& operator--() //prefix
+  SC_CONSTEXPR sc_uint_base& operator--() //prefix
   {
     unsigned int val = num;
     --val;
@@ -244,7 +243,7 @@ public:
     return *this;
   }
   
-  const sc_uint_base operator--(int) //postfix 
+  SC_CONSTEXPR const sc_uint_base operator--(int) //postfix 
   {
     unsigned int val = num;
     unsigned int tmp = val;
@@ -258,21 +257,21 @@ public:
   // Bit-select and part-select operators
   
   sc_uint_bitref operator[] ( int i ); 
-  bit operator[] (int i) const { return test(i); }
+  SC_CONSTEXPR bit operator[] (int i) const { return test(i); }
   sc_uint_subref range(int left, int right ); 
-  unsigned int range( int left, int right ) const;
+  SC_CONSTEXPR unsigned int range( int left, int right ) const;
 
-  bit test(int i) const 
+  SC_CONSTEXPR bit test(int i) const 
   {
       return (  0 != ( num & (1U << i) ) ); 
 
   }  
 
-  void set(int i) 
+  SC_CONSTEXPR void set(int i) 
   {
       num |= (1U << i); 
   }
-  void set(int i, bit v )
+  SC_CONSTEXPR void set(int i, bit v )
   {
       unsigned int val = num;  
       val &= ~ (1U << i );
@@ -280,19 +279,19 @@ public:
       num = val;
   }
 
-  int bitwidth() const { return width; }
+  SC_CONSTEXPR int bitwidth() const { return width; }
 
-  friend bool operator == ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator == ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num == b.num; }
-  friend bool operator != ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator != ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num != b.num; }
-  friend bool operator < ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator < ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num < b.num; }
-  friend bool operator <= ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator <= ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num <= b.num; }
-  friend bool operator > ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator > ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num > b.num; }
-  friend bool operator >= ( const sc_uint_base& a, const sc_uint_base& b )
+  friend SC_CONSTEXPR bool operator >= ( const sc_uint_base& a, const sc_uint_base& b )
     { return a.num >= b.num; }
 
 };
@@ -311,10 +310,10 @@ class sc_uint : public sc_uint_base {
 
 public:
   // Constructors
-  sc_uint() : sc_uint_base(W) { }
-  sc_uint( unsigned int v) : sc_uint_base(W) { num = v & MASK(W); }
-  sc_uint( const sc_uint<W>& v) : sc_uint_base(W) { num = v.num ; }
-  sc_uint( const sc_uint_base& v ) : sc_uint_base(W) { num = v.num & MASK(W); }
+  SC_CONSTEXPR sc_uint() : sc_uint_base(W) { }
+  SC_CONSTEXPR sc_uint( unsigned int v) : sc_uint_base(W) { num = v & MASK(W); }
+  SC_CONSTEXPR sc_uint( const sc_uint<W>& v) : sc_uint_base(W) { num = v.num ; }
+  SC_CONSTEXPR sc_uint( const sc_uint_base& v ) : sc_uint_base(W) { num = v.num & MASK(W); }
   sc_uint( const sc_uint_subref& v ) : sc_uint_base( v ) { }
 #if !defined(__SUNPRO_CC)
   template<class T1, class T2> sc_uint( const sc_uint_concat<T1,T2>& v) : sc_uint_base(v) { }
@@ -333,10 +332,10 @@ public:
   sc_uint( const sc_lv<W>& v );
 
  //Assignment operators
- sc_uint& operator=(unsigned int v) { num = v & MASK(W); return *this; }
- sc_uint& operator=( const sc_uint_base& v ) { num = v.num & MASK(W); return *this; }
+ SC_CONSTEXPR sc_uint& operator=(unsigned int v) { num = v & MASK(W); return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint_base& v ) { num = v.num & MASK(W); return *this; }
  sc_uint& operator=( const sc_uint_subref& v ) { sc_uint_base::operator=(v); return *this; }
- sc_uint& operator=( const sc_uint<W>& v) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint<W>& v) { num = v.num; return *this; }
 #if !defined(__SUNPRO_CC)
  template<class T1, class T2> sc_uint& operator=( const sc_uint_concat<T1,T2>& v) 
    { sc_uint_base::operator=(v); return *this; }
@@ -357,7 +356,7 @@ public:
     // operator unsigned int() const { return num; }
  
  //Arithmetic operators
-  sc_uint& operator+=( unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator+=( unsigned int v) 
   {
     unsigned int val = num;
     val += v;
@@ -365,7 +364,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator-=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator-=(unsigned int v) 
   {
     unsigned int val = num;
     val -= v;
@@ -373,7 +372,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator*=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator*=(unsigned int v) 
   {
     unsigned int val = num;
     val *= v;
@@ -381,7 +380,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator/=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator/=(unsigned int v) 
   {
     unsigned int val = num;
     val /= v;
@@ -389,7 +388,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator%=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator%=(unsigned int v) 
   {
     unsigned int val = num;
     val %= v;
@@ -398,7 +397,7 @@ public:
   }
   
   //Bitwise operators
-  sc_uint& operator&=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator&=(unsigned int v) 
   {
     unsigned int val = num;
     val &= v;
@@ -406,7 +405,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator|=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator|=(unsigned int v) 
   {
     unsigned int val = num;
     val |= v;
@@ -414,7 +413,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator^=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator^=(unsigned int v) 
   {
     unsigned int val = num;
     val ^= v;
@@ -422,7 +421,7 @@ public:
     return *this;
   }
 
-  sc_uint& operator<<=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator<<=(unsigned int v) 
   {
     unsigned int val = num;
     val <<= v;
@@ -430,10 +429,10 @@ public:
     return *this;
   }
 
-  sc_uint& operator>>=(unsigned int v) { num >>= v; return *this; }
+  SC_CONSTEXPR sc_uint& operator>>=(unsigned int v) { num >>= v; return *this; }
   
   //postfix and prefix increment & decrement operators
-  sc_uint& operator++() // prefix
+  SC_CONSTEXPR sc_uint& operator++() // prefix
   {
     unsigned int val = num;
     ++val;
@@ -442,7 +441,7 @@ public:
     return *this;
   }
 
-  const sc_uint operator++(int) // postfix
+  SC_CONSTEXPR const sc_uint operator++(int) // postfix
   {
     unsigned int val = num;   
     unsigned int tmp = val;
@@ -452,7 +451,7 @@ public:
     return sc_uint(tmp);
   }
 
-  sc_uint& operator--() //prefix
+  SC_CONSTEXPR sc_uint& operator--() //prefix
   {
     unsigned int val = num;  
     --val;
@@ -461,7 +460,7 @@ public:
     return *this;
   }
   
-  const sc_uint operator--(int) //postfix 
+  SC_CONSTEXPR const sc_uint operator--(int) //postfix 
   {
     unsigned int val = num;
     unsigned int tmp = val;
@@ -487,10 +486,10 @@ class sc_uint<INTSIZE> : public sc_uint_base {
 
 public:
   // Constructors
-  sc_uint() : sc_uint_base(INTSIZE) { }
-  sc_uint( unsigned int v) : sc_uint_base(v, INTSIZE) { }
-  sc_uint( const sc_uint<INTSIZE>& v) { num = v.num ; }
-  sc_uint( const sc_uint_base& v ) : sc_uint_base(INTSIZE) { num = v.num; }
+  SC_CONSTEXPR sc_uint() : sc_uint_base(INTSIZE) { }
+  SC_CONSTEXPR sc_uint( unsigned int v) : sc_uint_base(v, INTSIZE) { }
+  SC_CONSTEXPR sc_uint( const sc_uint<INTSIZE>& v) { num = v.num ; }
+  SC_CONSTEXPR sc_uint( const sc_uint_base& v ) : sc_uint_base(INTSIZE) { num = v.num; }
   sc_uint( const sc_uint_subref& v ) : sc_uint_base( v ) { }
 #if !defined(__SUNPRO_CC)
   template<class T1,class T2> sc_uint( const sc_uint_concat<T1, T2>& v) : sc_uint_base(v){}
@@ -501,10 +500,10 @@ public:
   sc_uint( const sc_unsigned& v ) : sc_uint_base(v) { }
 
  //Assignment operators
- sc_uint& operator=(unsigned int v) { num = v; return *this; }
- sc_uint& operator=( const sc_uint_base& v ) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_uint& operator=(unsigned int v) { num = v; return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint_base& v ) { num = v.num; return *this; }
  sc_uint& operator=( const sc_uint_subref& v ) { sc_uint_base::operator=(v); return *this;}
- sc_uint& operator=( const sc_uint<INTSIZE>& v) { num = v.num; return *this; }
+ SC_CONSTEXPR sc_uint& operator=( const sc_uint<INTSIZE>& v) { num = v.num; return *this; }
 #if !defined(__SUNPRO_CC)
  template<class T1, class T2> sc_uint& operator=(const sc_uint_concat<T1,T2>& v) 
    { sc_uint_base::operator=(v); return *this; }
@@ -517,84 +516,84 @@ public:
     // operator unsigned int() const { return num; }
  
  //Arithmetic operators
-  sc_uint& operator+=( unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator+=( unsigned int v) 
   {
     num += v;
     return *this;
   }
 
-  sc_uint& operator-=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator-=(unsigned int v) 
   {
     num -= v;
     return *this;
   }
 
-  sc_uint& operator*=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator*=(unsigned int v) 
   {
     num *= v;
     return *this;
   }
 
-  sc_uint& operator/=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator/=(unsigned int v) 
   {
     num /= v;
     return *this;
   }
 
-  sc_uint& operator%=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator%=(unsigned int v) 
   {
     num %= v;
     return *this;
   }
   
   //Bitwise operators
-  sc_uint& operator&=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator&=(unsigned int v) 
   {
     num &= v;
     return *this;
   }
 
-  sc_uint& operator|=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator|=(unsigned int v) 
   {
     num |= v;
     return *this;
   }
 
-  sc_uint& operator^=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator^=(unsigned int v) 
   {
     num ^= v;
     return *this;
   }
 
-  sc_uint& operator<<=(unsigned int v) 
+  SC_CONSTEXPR sc_uint& operator<<=(unsigned int v) 
   {
     num <<= v;
     return *this;
   }
 
-  sc_uint& operator>>=(unsigned int v) { num >>= v; return *this; }
+  SC_CONSTEXPR sc_uint& operator>>=(unsigned int v) { num >>= v; return *this; }
   
   //postfix and prefix increment & decrement operators
-  sc_uint& operator++() // prefix
+  SC_CONSTEXPR sc_uint& operator++() // prefix
   {
     ++num;
     return *this;
   }
 
-  const sc_uint operator++(int) // postfix
+  SC_CONSTEXPR const sc_uint operator++(int) // postfix
   {
     unsigned int tmp = num;
     num++;
     return sc_uint<INTSIZE>(tmp);
   }
 
-  sc_uint& operator--() //prefix
+  SC_CONSTEXPR sc_uint& operator--() //prefix
   {
     --num;
     return *this;
   }
   
-  const sc_uint operator--(int) //postfix 
+  SC_CONSTEXPR const sc_uint operator--(int) //postfix 
   {
     unsigned int tmp = num;
     num--;
@@ -629,7 +628,7 @@ public:
   
   sc_uint_bitref& operator&=( bit b )
   {
-    obj->num &= ~ ( ( !b ) << index );
+    obj->num &= ~ ( (unsigned int) ( !b ) << index );
     return *this;
   }
   sc_uint_bitref& operator|=( bit b )
@@ -674,56 +673,38 @@ public:
   
   sc_uint_subref& operator=( const sc_uint_base& v)
   { 
-    unsigned int val = obj->num;
-    // Mask the bits out that are part-selected
-
-    val &= mask32[left][right];
-
-    // set the part-selected bits
-    val |= (v.num << right) & ~mask32[left][right]; 
-
-    // Normalize the value 
-    val &= MASK(obj->width);
-
-    obj->num = val;
-    
-    return *this;
+    return operator=( v.num );
   }
     
   sc_uint_subref& operator=( const sc_uint_subref& v)
   {
     if( this == &v )
       return *this;
-    return operator=(v.operator unsigned int() );
+    return operator=( v.operator unsigned int() );
   }
   
   sc_uint_subref& operator=( unsigned int v )
   {
-   unsigned int val = obj->num;
-   
-   // Mask the bits out that are part-selected
-     val &= mask32[left][right];
-   
-    // set the part-selected bits
-      val |= (v << right) & ~mask32[left][right]; 
-    
-   // Normalize the value
-    val &= MASK(obj->width);
+    // Replace the part-selected bits. If left < right, the range is
+    // reversed: bit i of v goes to bit right - i. set_field32() leaves
+    // a reversed range alone, so only the reversed fix-up is conditional.
+    unsigned int val = set_field32(obj->num, v, left, right);
+    if( left < right )
+      val = set_reversed_field32(val, v, left, right);
 
-    obj->num = val;
+    // Normalize the value
+    obj->num = val & MASK(obj->width);
     return *this;
   }
   
   operator unsigned int() const 
   { 
-    unsigned int val = obj->num;  
-    if( left == obj->width - 1 )
-      return val >> right;
-    else
-     return ( ( val & ( (1U << (left + 1)) - 1 ) ) >> right ); 
+    if( left >= right )
+      return get_field32(obj->num, left, right);
+    return get_reversed_field32(obj->num, left, right);
   }
-  
-  int bitwidth() const { return (left - right + 1); }
+
+  int bitwidth() const { return (left >= right) ? left - right + 1 : right - left + 1; }
   
 private:
   sc_uint_base* obj;
@@ -96,7 +96,7 @@ inline sc_uint<W>& sc_uint<W>::operator=( const sc_lv<W>& v )
 
 inline sc_uint_base::sc_uint_base(const sc_uint_subref& v)
 {
-  width = v.left - v.right + 1; num = v.operator unsigned int();
+  width = v.bitwidth(); num = v.operator unsigned int();
 }
 
 inline sc_uint_base::sc_uint_base( const sc_bool_vector& v )
@@ -135,7 +135,7 @@ inline sc_uint_base::sc_uint_base( const sc_unsigned& v )
 
 inline sc_uint_base& sc_uint_base::operator=( const sc_uint_subref& v )
 {
-  width = v.left - v.right + 1; 
+  width = v.bitwidth(); 
   num = v.operator unsigned int(); 
   return *this; 
 }
@@ -212,12 +212,14 @@ inline sc_uint_subref sc_uint_base::range( int left, int right )
   return sc_uint_subref( this, left, right );
 }
 
-inline unsigned int sc_uint_base::range( int left, int right ) const
+// If left < right, the range is reversed: bit i of the result is bit
+// right - i of the number.
+inline SC_CONSTEXPR unsigned int sc_uint_base::range( int left, int right ) const
 {
-  if( left < width - 1 )
-    return ( (num & ((1U << (left + 1)) - 1)) >> right ); 
+  if( left >= right )
+    return (num >> right) & MASK(left - right + 1);
   else
-    return num >> right; 
+    return (reverse_bits32(num) << left) >> (INTWIDTH - 1 - right + left);
 }
 
 // here we define concatenation operators taking args of all possible combinations.
@@ -99,7 +99,7 @@ inline sc_uint<W>& sc_uint<W>::operator=( const sc_lv<W>& v )
 
 inline sc_uint_base::sc_uint_base(const sc_uint_subref& v)
 {
-  width = v.left - v.right + 1; num = v.operator uint64();
+  width = v.bitwidth(); num = v.operator uint64();
 }
 
 inline sc_uint_base::sc_uint_base( const sc_bool_vector& v )
@@ -138,7 +138,7 @@ inline sc_uint_base::sc_uint_base( const sc_unsigned& v )
 
 inline sc_uint_base& sc_uint_base::operator=( const sc_uint_subref& v )
 {
-  width = v.left - v.right + 1; 
+  width = v.bitwidth(); 
   num = v.operator uint64(); 
   return *this; 
 }
@@ -215,16 +215,14 @@ inline sc_uint_subref sc_uint_base::range( int left, int right )
   return sc_uint_subref( this, left, right );
 }
 
-inline uint64 sc_uint_base::range( int left, int right ) const
+// If left < right, the range is reversed: bit i of the result is bit
+// right - i of the number.
+inline SC_CONSTEXPR uint64 sc_uint_base::range( int left, int right ) const
 {
-  if( left < width - 1 )
-#ifndef WIN32
-    return ( (num & ((1ULL << (left + 1)) - 1)) >> right ); 
-#else
-    return ( (num & ((1i64 << (left + 1)) - 1)) >> right ); 
-#endif 
+  if( left >= right )
+    return (num >> right) & MASK(left - right + 1);
   else
-    return num >> right; 
+    return (reverse_bits64(num) << left) >> (LLWIDTH - 1 - right + left);
 }
 
 // here we define concatenation operators taking args of all possible combinations.
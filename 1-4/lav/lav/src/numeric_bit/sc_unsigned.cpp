@@ -3279,7 +3279,8 @@ compare_unsigned(small_type us,
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[nd];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 #endif
 
     if (us == SC_NEG) {
@@ -3300,7 +3301,8 @@ compare_unsigned(small_type us,
     }
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
     return cmp_res;
@@ -3329,7 +3331,8 @@ sc_unsigned::iszero() const
 #ifdef MAX_NBITS
     digit_type d[MAX_NDIGITS];
 #else
-    digit_type *d = new digit_type[ndigits];
+    digit_type small_d[SMALL_TEMP_NDIGITS];
+    digit_type *d = (ndigits <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(ndigits);
 #endif
 
     vec_copy(ndigits, d, digit);
@@ -3339,7 +3342,8 @@ sc_unsigned::iszero() const
     bool res = check_for_zero(ndigits, d);
 
 #ifndef MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      vec_delete(d);
 #endif
 
     return res;
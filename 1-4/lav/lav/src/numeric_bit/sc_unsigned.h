@@ -95,6 +95,7 @@ class sc_fxval;
 class sc_fxval_fast;
 class sc_fxnum;
 class sc_fxnum_fast;
+class sc_modulus;
 #endif
 
 /////////////////////////////////////////////////////////////////////////////
@@ -182,6 +183,7 @@ class sc_unsigned {
   friend class sc_signed;
   friend class sc_signed_subref;
   friend class sc_2d<sc_unsigned>;
+  friend class sc_modulus;
 
   friend istream& operator >> (istream& is, sc_unsigned&       u);
   friend ostream& operator << (ostream& os, const sc_unsigned& u);
@@ -227,7 +229,7 @@ public:
   ~sc_unsigned()
     {
 #ifndef MAX_NBITS
-      delete [] digit;
+      free_digits();
 #endif
     }
 
@@ -318,6 +320,10 @@ public:
   void get_packed_rep(digit_type *buf) const;
   void set_packed_rep(digit_type *buf);
 
+  // Get the bits of the number as length() '0' and '1' characters,
+  // most significant bit first.
+  void get_bin_chars(char *buf) const;
+
   /*
     The comparison of the old and new semantics are as follows:
 
@@ -1247,7 +1253,7 @@ public:
                                          length_type vnd,
                                          const digit_type *vd);
   
-private:
+protected:
 
   small_type  sgn;         // Shortened as s.
   length_type nbits;       // Shortened as nb.
@@ -1257,8 +1263,18 @@ private:
   digit_type digit[DIV_CEIL(MAX_NBITS)];   // Shortened as d.
 #else
   digit_type *digit;                       // Shortened as d.
+  // Narrow numbers keep their digits here, pointed to by digit.
+  digit_type small_digit[SMALL_NDIGITS];
 #endif
 
+  // Create an unsigned number with nb bits whose digits are in d, which
+  // belongs to a derived class. With MAX_NBITS, d is not used.
+  // Otherwise, the destructor of the derived class must point digit
+  // to small_digit, so that ~sc_unsigned() does not free d.
+  sc_unsigned(length_type nb, digit_type *d);
+
+private:
+
   // Private constructors:
 
   // Create zero.
@@ -1284,6 +1300,15 @@ private:
 
   bool check_if_outside(length_type bit_num) const;
 
+#ifndef MAX_NBITS
+  // Point digit to storage for ndigits digits, and release it.
+  void alloc_digits()
+    { digit = (ndigits <= SMALL_NDIGITS) ? small_digit : vec_new(ndigits); }
+
+  void free_digits()
+    { if (digit != small_digit) vec_delete(digit); }
+#endif
+
   void copy_digits(length_type nb, length_type nd, const digit_type *d)
     { copy_digits_unsigned(sgn, nbits, ndigits, digit, nb, nd, d); }
   
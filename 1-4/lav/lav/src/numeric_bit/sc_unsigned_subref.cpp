@@ -103,7 +103,8 @@ sc_unsigned_subref::operator=(const char* v)
 
 #else
 
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 
 #endif
 
@@ -131,7 +132,8 @@ sc_unsigned_subref::operator=(const char* v)
 
 #ifndef MAX_NBITS
 
-  delete [] d;
+  if (d != small_d)
+    vec_delete(d);
 
 #endif
 
@@ -215,7 +217,8 @@ sc_unsigned_subref::operator=(double v)
 
 #else
 
-  digit_type *d = new digit_type[nd];
+  digit_type small_d[SMALL_TEMP_NDIGITS];
+  digit_type *d = (nd <= SMALL_TEMP_NDIGITS) ? small_d : vec_new(nd);
 
 #endif
 
@@ -257,7 +260,8 @@ sc_unsigned_subref::operator=(double v)
 
 #ifndef MAX_NBITS
 
-  delete [] d;
+  if (d != small_d)
+    vec_delete(d);
 
 #endif
 
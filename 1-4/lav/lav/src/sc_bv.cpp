@@ -137,12 +137,12 @@ sc_bv_base::sc_bv_base(const sc_bv_base& b):N(0)
 }
 sc_bv_base::sc_bv_base(const char* ss):N(0)
 { // slow
-   const sc_string s = convert_to_bin(ss);
+   sc_string buf;
+   const sc_string_view s = convert_to_bin(ss, buf);
    const unsigned s_length = s.length();
    if(s_length==0)
      throw sc_edata(2001);
-   sc_string fs = convert_to_bin(s);
-   assign_(fs.c_str());
+   assign_(s.data());
    clean_tail();
 }
 
@@ -181,34 +181,50 @@ void sc_bv_base::resize(unsigned long new_size)
 // non-template non-member functions
 // string conversions
 // there is time and memory penalty if one uses formated strings
-sc_string convert_to_bin(const sc_string& s)
+// the views returned refer either to s, which is then 0-ended
+// whenever the caller's string is, or to buf
+sc_string_view convert_to_bin(const sc_string_view& s, sc_string& buf)
 {
 #if defined(FORMATTED_STRING_CONVERSION)
   if(s.length()>2 && s[0]=='0' &&
      (s[1]=='b' || s[1]=='B' || s[1]=='d' || s[1]=='D' || s[1]=='o' || s[1]=='O'
       || s[1]=='x' || s[1]=='X')) // formated string
   {
-    sc_unsigned u(s.c_str());
-    return u.to_string(SC_BIN_BASE, false); // no prefix
+    sc_unsigned u(sc_string(s).c_str());
+    buf = u.to_string(SC_BIN_BASE, false); // no prefix
+    return buf;
   }
   else // must be bin by default
 #endif
     return s;
 }
-sc_string convert_to_logic(const sc_string& s)
+sc_string_view convert_to_logic(const sc_string_view& s, sc_string& buf)
 {
 #if defined(FORMATTED_STRING_CONVERSION)
   if(s.length()>2 && s[0]=='0' &&
      (s[1]=='b' || s[1]=='B' || s[1]=='d' || s[1]=='D' || s[1]=='o' || s[1]=='O'
       )) // formated string, notice X is a valid logic value
   {
-    sc_unsigned u(s.c_str());
-    return u.to_string(SC_BIN_BASE, false); // no prefix
+    sc_unsigned u(sc_string(s).c_str());
+    buf = u.to_string(SC_BIN_BASE, false); // no prefix
+    return buf;
   }
   else // must be logic by default
 #endif
     return s;
 }
+sc_string convert_to_bin(const sc_string& s)
+{
+  sc_string buf;
+  sc_string_view v = convert_to_bin(sc_string_view(s), buf);
+  return (v.data() == s.c_str()) ? s : buf;
+}
+sc_string convert_to_logic(const sc_string& s)
+{
+  sc_string buf;
+  sc_string_view v = convert_to_logic(sc_string_view(s), buf);
+  return (v.data() == s.c_str()) ? s : buf;
+}
 
 //-----------------------------
 // testing zone
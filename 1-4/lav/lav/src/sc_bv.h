@@ -94,7 +94,10 @@ namespace sc_bv_ns
 	const unsigned ul_size = byte_size*sizeof(unsigned long);
 	// utility function
 	char* long_to_char(unsigned long l);
-	// conversion from typed string
+	// conversion from typed string; the result refers to s unless s
+	// is a formatted string, in which case it is converted into buf
+	sc_string_view convert_to_bin(const sc_string_view& s, sc_string& buf);
+	sc_string_view convert_to_logic(const sc_string_view& s, sc_string& buf);
 	sc_string convert_to_bin(const sc_string& s);
 	sc_string convert_to_logic(const sc_string& s);
 
@@ -1336,9 +1339,7 @@ sc_string t_base<T>::to_string()const
 {
    unsigned N = back_cast().length();
    sc_string buff(N+1);
-   for(unsigned i=0; i<N; i++)
-     buff.set(i, logic_to_char[back_cast()[N-i-1]&3]);
-   buff.set(N,0);
+   to_string(buff.buffer(N+1));
    return buff;
 }
 template<class T>
@@ -1582,7 +1583,8 @@ void assign_(t_base<X>& x, const t_base<Y>& y)
 }
 template<class X> X& t_base<X>::assign_(const char* bb)
 { // ATTN: only common bits are assigned
-  const sc_string b = convert_to_logic(bb);
+  sc_string buf;
+  const sc_string_view b = convert_to_logic(bb, buf);
 #ifndef _MSC_VER
   int len = sc_bv_ns::min(back_cast().length(),b.length());
 #else
@@ -2392,13 +2394,14 @@ inline void sc_bv_base::set_cword(unsigned i, unsigned long w)
 template<int W>
 sc_bv<W>::sc_bv(const char* ss)
 { // slow
-   const sc_string s = convert_to_bin(ss);
+   sc_string buf;
+   const sc_string_view s = convert_to_bin(ss, buf);
    const unsigned s_length = s.length();
    if(s_length==0)
      throw sc_edata(2001);
    data = new unsigned long[(W-1)/ul_size +1]; // can throw
    N=W;
-   assign_(s);
+   assign_(s.data());
    clean_tail();
 }
 template<int W>
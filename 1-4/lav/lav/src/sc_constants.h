@@ -41,6 +41,9 @@
 // arithmetic becomes slower and the precision becomes infinite.  It
 // is a good idea to define this constant as a multiple of
 // BITS_PER_DIGIT, which is defined in numeric_bit/sc_nbdefs.h.
+// Multiplication switches from schoolbook to Karatsuba at 24 digits
+// (see numeric_bit/sc_nbutils.h), so models of wider numbers should
+// leave it undefined.
 #define MAX_NBITS    510    // 17 * BITS_PER_DIGIT
 
 const int SYSTEMC_DEFAULT_STACK_SIZE = 0x10000;
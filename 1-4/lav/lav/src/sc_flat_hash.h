@@ -0,0 +1,301 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_flat_hash.h -- A typed open-addressing hash table with keys and
+                      contents stored inline (linear probing).
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#ifndef SC_FLAT_HASH_H
+#define SC_FLAT_HASH_H
+
+#include <stddef.h>
+#include <string.h>
+
+//
+// Hash traits.  The default traits hash and compare keys by value
+// (pointers and integers); sc_flat_str_hash_traits hashes and
+// compares the characters of C strings.  The hash functions are
+// inline, so that no call through a function pointer is made on a
+// lookup.
+//
+
+template< class K >
+struct sc_flat_hash_traits {
+    static unsigned hash( K k )
+    {
+        size_t v = (size_t) k;
+        return ((unsigned) (v >> 2) ^ (unsigned) (v >> 18)) * 2654435789U;
+    }
+    static bool equal( K a, K b ) { return a == b; }
+};
+
+struct sc_flat_str_hash_traits {
+    static unsigned hash( const char* x )
+    {
+        unsigned h = 0;
+        unsigned g;
+        while (*x != 0) {
+            h = (h << 4) + *x++;
+            if ((g = h & 0xf0000000) != 0)
+                h = (h ^ (g >> 24)) ^ g;
+        }
+        return h * 2654435789U;
+    }
+    static bool equal( const char* a, const char* b ) { return strcmp(a, b) == 0; }
+};
+
+template< class K, class C, class H >
+class sc_flat_hash_iter;
+
+const int SC_FLAT_HASH_DEFAULT_INIT_TABLE_SIZE = 16;
+
+//
+// sc_flat_hash<K,C,H> maps keys of type K to contents of type C.  Both
+// must be cheap to copy (pointers or integers).  Entries live in a
+// single power-of-two sized array of slots; each slot caches the full
+// hash value of its key, so that probing compares keys only when the
+// hash values match, and rehashing never calls the hash function.  A
+// hash value of 0 marks an empty slot.  Removal shifts the following
+// entries of the probe sequence back, so there are no tombstones.
+// Keys are not copied; for string keys the caller keeps the
+// characters alive while the entry is in the table.
+//
+
+template< class K, class C, class H = sc_flat_hash_traits<K> >
+class sc_flat_hash {
+    friend class sc_flat_hash_iter<K,C,H>;
+
+public:
+    typedef sc_flat_hash_iter<K,C,H> iterator;
+
+    sc_flat_hash( C def = (C) 0, int size = SC_FLAT_HASH_DEFAULT_INIT_TABLE_SIZE )
+    {
+        default_value = def;
+        num_entries = 0;
+        num_slots = 4;
+        while (num_slots < size)
+            num_slots <<= 1;
+        slots = new slot[num_slots];
+        memset( slots, 0, sizeof(slot) * num_slots );
+    }
+    ~sc_flat_hash()
+    {
+        delete[] slots;
+    }
+
+    bool empty() const { return (num_entries == 0); }
+    unsigned count() const { return num_entries; }
+
+    void erase()
+    {
+        memset( slots, 0, sizeof(slot) * num_slots );
+        num_entries = 0;
+    }
+
+    /* Returns 1 if the key was already present (its contents are
+       replaced), 0 otherwise. */
+    int insert( K k, C c )
+    {
+        unsigned hv = hash_value(k);
+        int i = find_slot(hv, k);
+        if (slots[i].hv != 0) {
+            slots[i].contents = c;
+            return 1;
+        }
+        if ((num_entries + 1) * 4 > num_slots * 3) {
+            rehash();
+            i = find_slot(hv, k);
+        }
+        slots[i].hv = hv;
+        slots[i].key = k;
+        slots[i].contents = c;
+        ++num_entries;
+        return 0;
+    }
+    int insert( K k ) { return insert(k, default_value); }
+
+    int insert_if_not_exists( K k, C c )
+    {
+        if (contains(k))
+            return 1;
+        return insert(k, c);
+    }
+    int insert_if_not_exists( K k ) { return insert_if_not_exists(k, default_value); }
+
+    int remove( K k ) { return remove(k, (K*) 0, (C*) 0); }
+    int remove( K k, K* pk, C* pc )
+    {
+        unsigned hv = hash_value(k);
+        int i = find_slot(hv, k);
+        if (slots[i].hv == 0)
+            return 0;
+        if (pk) *pk = slots[i].key;
+        if (pc) *pc = slots[i].contents;
+        remove_slot(i);
+        return 1;
+    }
+
+    int lookup( K k, C* pc ) const
+    {
+        const slot& s = slots[find_slot(hash_value(k), k)];
+        if (s.hv == 0)
+            return 0;
+        if (pc) *pc = s.contents;
+        return 1;
+    }
+    bool contains( K k ) const { return (lookup(k, 0) != 0); }
+    C operator[]( K k ) const
+    {
+        const slot& s = slots[find_slot(hash_value(k), k)];
+        return (s.hv == 0) ? default_value : s.contents;
+    }
+
+private:
+    struct slot {
+        unsigned hv;
+        K        key;
+        C        contents;
+    };
+
+    static unsigned hash_value( K k )
+    {
+        unsigned h = H::hash(k);
+        h ^= (h >> 16);
+        return (h == 0) ? 1 : h;
+    }
+
+    /* Returns the slot holding k, or the empty slot that ends its
+       probe sequence.  The table is never full. */
+    int find_slot( unsigned hv, K k ) const
+    {
+        const int mask = num_slots - 1;
+        int i = hv & mask;
+        while (slots[i].hv != 0) {
+            if (slots[i].hv == hv && H::equal(slots[i].key, k))
+                return i;
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    void remove_slot( int i )
+    {
+        const int mask = num_slots - 1;
+        int j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (slots[j].hv == 0)
+                break;
+            /* Move slots[j] into the hole at i unless its home slot
+               lies cyclically in (i, j]. */
+            int home = slots[j].hv & mask;
+            if ((i <= j) ? (i < home && home <= j) : (i < home || home <= j))
+                continue;
+            slots[i] = slots[j];
+            i = j;
+        }
+        slots[i].hv = 0;
+        --num_entries;
+    }
+
+    void rehash()
+    {
+        slot* old_slots = slots;
+        int old_num_slots = num_slots;
+
+        num_slots <<= 1;
+        slots = new slot[num_slots];
+        memset( slots, 0, sizeof(slot) * num_slots );
+
+        const int mask = num_slots - 1;
+        for (int k = 0; k < old_num_slots; ++k) {
+            if (old_slots[k].hv == 0)
+                continue;
+            int i = old_slots[k].hv & mask;
+            while (slots[i].hv != 0)
+                i = (i + 1) & mask;
+            slots[i] = old_slots[k];
+        }
+        delete[] old_slots;
+    }
+
+    C     default_value;
+    int   num_slots;
+    int   num_entries;
+    slot* slots;
+
+private:
+    // Disabled
+    sc_flat_hash( const sc_flat_hash<K,C,H>& );
+    void operator=( const sc_flat_hash<K,C,H>& );
+};
+
+//
+// Iterates over the entries of an sc_flat_hash in slot order.  The
+// table must not be modified while it is being iterated over.
+//
+
+template< class K, class C, class H >
+class sc_flat_hash_iter {
+public:
+    sc_flat_hash_iter( sc_flat_hash<K,C,H>* t ) { reset(t); }
+    sc_flat_hash_iter( sc_flat_hash<K,C,H>& t ) { reset(&t); }
+    ~sc_flat_hash_iter() { }
+
+    void reset( sc_flat_hash<K,C,H>* t )
+    {
+        table = t;
+        index = -1;
+        step();
+    }
+    void reset( sc_flat_hash<K,C,H>& t ) { reset(&t); }
+
+    bool empty() const { return (index >= table->num_slots); }
+    void step()
+    {
+        do {
+            ++index;
+        } while (index < table->num_slots && table->slots[index].hv == 0);
+    }
+    void operator++(int) { step(); }
+
+    K key()      const { return table->slots[index].key;      }
+    C contents() const { return table->slots[index].contents; }
+    C set_contents( C c )
+    {
+        return (table->slots[index].contents = c);
+    }
+
+private:
+    sc_flat_hash<K,C,H>* table;
+    int                  index;
+};
+
+#endif
@@ -46,6 +46,7 @@
 #include "sc_isdb_trace.h"
 #include "sc_ver.h"
 #include "sc_simcontext.h"
+#include "sc_trace_registry.h"
 #include "numeric_bit/numeric_bit.h"
 #include "sc_resolved.h"
 #include "sc_dump.h"
@@ -85,1176 +86,245 @@ public:
 
     void compose_data_line(char* rawdata, char* compdata);
 
-    virtual ~isdb_trace();
-
-    const sc_string name;
-    const sc_string isdb_name;
-    const char* isdb_var_typ_name;
-    int bit_width; 
-    ISDB_Signal isdb_id;
-};
-
-
-isdb_trace::isdb_trace(const sc_string& _name, const sc_string& _isdb_name)
-       : name(_name), isdb_name(_isdb_name), bit_width(0)
-{
-    /* Intentionally blank */
-}
-        
-void isdb_trace::compose_data_line(char* rawdata, char* compdata)
-{
-    assert(rawdata != compdata);
-
-    if(bit_width == 0) {
-      compdata[0] = '\0'; 
-    } else {
-        if(bit_width == 1){
-            compdata[0] = rawdata[0];
-            strcpy(&(compdata[1]), isdb_name);
-        }
-        else{
-            char* effective_begin = rawdata;
-            sprintf(compdata, "b%s %s", effective_begin, (const char *) isdb_name);
-        }
-    }
-}
-
-void isdb_trace::declare_variable (ISDB_Conn database)
-{
-  /* Intentionally Blank, should be defined for each type separately */
-}
-
-void isdb_trace::set_width()
-{
-  /* Intentionally Blank, should be defined for each type separately */
-}
-
-isdb_trace::~isdb_trace()
-{
-  /* Intentionally Blank */
-}
-
-
-/**********************************************************************************************/
-
-
-class isdb_bool_trace : public isdb_trace {
-public:
-    isdb_bool_trace(const bool& object, const sc_string& _name, const sc_string& _isdb_name);
-    void write(ISDB_Conn database);
-    bool changed();
-    void declare_variable(ISDB_Conn database);
-
-protected:    
-    const bool& object;
-    bool old_value;
-};
-
-isdb_bool_trace::isdb_bool_trace(const bool& _object, const sc_string& _name, const sc_string& _isdb_name)
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    isdb_var_typ_name = "wire";
-    bit_width = 1;
-    old_value = object;
-}
-
-void isdb_bool_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Binary, (const char*)name);
-  write(database);
-}
-
-bool isdb_bool_trace::changed()
-{
-  return object != old_value;
-}
-
-void isdb_bool_trace::write(ISDB_Conn database)
-{
-  int val = object==true ? ISDB_HIGH : ISDB_LOW;
-  ISDB_SetValue (database, isdb_id, val);
-
-  old_value = object;
-}
-
-/*******************************************************************************************/
-
-class isdb_sc_logic_trace : public isdb_trace {
-public:
-    isdb_sc_logic_trace(const sc_logic& object, const sc_string& _name, const sc_string& _isdb_name);
-    void write(ISDB_Conn database);
-    bool changed();
-    void declare_variable(ISDB_Conn database);
-
-protected:    
-    const sc_logic& object;
-    sc_logic old_value;
-};
-
-
-isdb_sc_logic_trace::isdb_sc_logic_trace(const sc_logic& _object, const sc_string& _name, const sc_string& _isdb_name) 
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    isdb_var_typ_name = "wire";
-    bit_width = 1;
-    old_value = object;
-}
-
-void isdb_sc_logic_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Binary, name);
-  write(database);
-}
-
-bool isdb_sc_logic_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void isdb_sc_logic_trace::write(ISDB_Conn database)
-{
-  int val = map_sc_logic_state_to_isdb_binval(object.to_char());
-  ISDB_SetValue (database, isdb_id, val);
-
-  old_value = object;
-}
-/******************************************************************************************/
-
-class isdb_bool_vector_trace : public isdb_trace {
-public:
-    isdb_bool_vector_trace(const sc_bool_vector& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_bool_vector& object;
-    sc_bool_vector old_value;
-};
-
-
-isdb_bool_vector_trace::isdb_bool_vector_trace(const sc_bool_vector& _object, const sc_string& _name, const sc_string& _isdb_name) 
-  : isdb_trace(_name, _isdb_name), object(_object), old_value(_object.length()) // The last may look strange, but is correct
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_bool_vector_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Array, name,
-			       ISDB_Binary, 0, bit_width-1);
-  write(database);
-}
-
-bool isdb_bool_vector_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_bool_vector_trace::write(ISDB_Conn database)
-{
-  // TBD: make val a member function ==> less malloc calls
-
-  unsigned int *val = (unsigned int*) malloc(sizeof(unsigned int)*bit_width);
-  int bitindex;
-  unsigned int isdb_val;
-
-  for (bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-    isdb_val = object[bitindex] ? ISDB_HIGH : ISDB_LOW;
-    val[bitindex] = isdb_val;
-  }
-  ISDB_SetValue (database, isdb_id, sizeof(val[0]), val);
-  free(val);
-
-  old_value = object;
-}
-
-void isdb_bool_vector_trace::set_width()
-{
-    bit_width = object.length();
-}
-/********************************************************************************/
-
-class isdb_sc_logic_vector_trace : public isdb_trace {
-public:
-    isdb_sc_logic_vector_trace(const sc_logic_vector& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_logic_vector& object;
-    sc_logic_vector old_value;
-};
-
-isdb_sc_logic_vector_trace::isdb_sc_logic_vector_trace(const sc_logic_vector& _object, const sc_string& _name, const sc_string& _isdb_name) 
-  : isdb_trace(_name, _isdb_name), object(_object), old_value(_object.length()) // The last may look strange, but is correct
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_sc_logic_vector_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Array, name,
-			       ISDB_Binary, 0, bit_width-1);
-  write(database);
-}
-
-bool isdb_sc_logic_vector_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_sc_logic_vector_trace::write(ISDB_Conn database)
-{
-  // TBD: make val a member function ==> less malloc calls
-
-  unsigned int *val = (unsigned int*) malloc(sizeof(unsigned int)*bit_width);
-  int bitindex;
-
-  for(bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-    val[bitindex] = map_sc_logic_state_to_isdb_binval(object[bitindex].to_char());
-  }
-  ISDB_SetValue (database, isdb_id, sizeof(val[0]), val);
-
-  free(val);
-
-  old_value = object;
-}
-
-
-void isdb_sc_logic_vector_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-
-/******************************************************************************************/
-
-class isdb_sc_unsigned_trace : public isdb_trace {
-public:
-    isdb_sc_unsigned_trace(const sc_unsigned& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_unsigned& object;
-    sc_unsigned old_value;
-};
-
-
-isdb_sc_unsigned_trace::isdb_sc_unsigned_trace(const sc_unsigned& _object, const sc_string& _name, const sc_string& _isdb_name) 
-  : isdb_trace(_name, _isdb_name), object(_object), old_value(_object.length()) // The last may look strange, but is correct
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_sc_unsigned_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
-}
-
-bool isdb_sc_unsigned_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_sc_unsigned_trace::write(ISDB_Conn database)
-{
-  ISDB_SetValue (database, isdb_id, object.to_uint());
-
-  old_value = object;
-}
-
-void isdb_sc_unsigned_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-
-/******************************************************************************************/
-
-class isdb_sc_signed_trace : public isdb_trace {
-public:
-    isdb_sc_signed_trace(const sc_signed& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_signed& object;
-    sc_signed old_value;
-};
-
-
-isdb_sc_signed_trace::isdb_sc_signed_trace(const sc_signed& _object, const sc_string& _name, const sc_string& _isdb_name) 
-  : isdb_trace(_name, _isdb_name), object(_object), old_value(_object.length())
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_sc_signed_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
-}
-
-bool isdb_sc_signed_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_sc_signed_trace::write(ISDB_Conn database)
-{
-  ISDB_SetValue (database, isdb_id, object.to_int());
-
-  old_value = object;
-}
-
-void isdb_sc_signed_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-
-/******************************************************************************************/
-
-class isdb_sc_uint_base_trace : public isdb_trace {
-public:
-    isdb_sc_uint_base_trace(const sc_uint_base& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_uint_base& object;
-    sc_uint_base old_value;
-};
-
-
-isdb_sc_uint_base_trace::isdb_sc_uint_base_trace(const sc_uint_base& _object, const sc_string& _name, const sc_string& _isdb_name) 
-  : isdb_trace(_name, _isdb_name), object(_object), old_value(_object.width) // The last may look strange, but is correct
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_sc_uint_base_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
-}
-
-bool isdb_sc_uint_base_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_sc_uint_base_trace::write(ISDB_Conn database)
-{
-  ISDB_SetValue (database, isdb_id, uint64(object));
-
-  old_value = object;
-}
-
-void isdb_sc_uint_base_trace::set_width()
-{
-    bit_width = object.width;
-}
-
-
-/******************************************************************************************/
-
-class isdb_sc_int_base_trace : public isdb_trace {
-public:
-    isdb_sc_int_base_trace(const sc_int_base& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_int_base& object;
-    sc_int_base old_value;
-};
-
-
-isdb_sc_int_base_trace::isdb_sc_int_base_trace(const sc_int_base& _object, const sc_string& _name, const sc_string& _isdb_name) 
-  : isdb_trace(_name, _isdb_name), object(_object), old_value(_object.width)
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_sc_int_base_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
-}
-
-bool isdb_sc_int_base_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_sc_int_base_trace::write(ISDB_Conn database)
-{
-  ISDB_SetValue (database, isdb_id, int64(object));
-
-  old_value = object;
-}
-
-void isdb_sc_int_base_trace::set_width()
-{
-    bit_width = object.width;
-}
-
-
-#ifdef SC_INCLUDE_FX
-
-/*****************************************************************************/
-
-class isdb_sc_fxval_trace : public isdb_trace
-{
-public:
-
-    isdb_sc_fxval_trace( const sc_fxval& object,
-			 const sc_string& _name,
-			 const sc_string& _isdb_name );
-    void declare_variable( ISDB_Conn database );
-    void write( ISDB_Conn database );
-    bool changed();
-
-protected:    
-
-    const sc_fxval& object;
-    sc_fxval old_value;
-
-};
-
-isdb_sc_fxval_trace::isdb_sc_fxval_trace( const sc_fxval& _object,
-					  const sc_string& _name,
-					  const sc_string& _isdb_name )
-: isdb_trace( _name, _isdb_name ),
-  object( _object )
-{
-    isdb_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
-}
-
-void
-isdb_sc_fxval_trace::declare_variable ( ISDB_Conn database )
-{
-    isdb_id = ISDB_DefineSignal( database, ISDB_Float, name );
-    write( database );
-}
-
-bool
-isdb_sc_fxval_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-isdb_sc_fxval_trace::write( ISDB_Conn database )
-{
-    ISDB_SetValue( database, isdb_id, object.to_double() );
-
-    old_value = object;
-}
-
-/*****************************************************************************/
-
-class isdb_sc_fxval_fast_trace : public isdb_trace
-{
-public:
-
-    isdb_sc_fxval_fast_trace( const sc_fxval_fast& object,
-			      const sc_string& _name,
-			      const sc_string& _isdb_name );
-    void declare_variable( ISDB_Conn database );
-    void write( ISDB_Conn database );
-    bool changed();
-
-protected:    
-
-    const sc_fxval_fast& object;
-    sc_fxval_fast old_value;
-
-};
-
-isdb_sc_fxval_fast_trace::isdb_sc_fxval_fast_trace( const sc_fxval_fast& _object,
-						    const sc_string& _name,
-						    const sc_string& _isdb_name )
-: isdb_trace( _name, _isdb_name ),
-  object( _object )
-{
-    isdb_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
-}
-
-void
-isdb_sc_fxval_fast_trace::declare_variable ( ISDB_Conn database )
-{
-    isdb_id = ISDB_DefineSignal( database, ISDB_Float, name );
-    write( database );
-}
-
-bool
-isdb_sc_fxval_fast_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-isdb_sc_fxval_fast_trace::write( ISDB_Conn database )
-{
-    ISDB_SetValue( database, isdb_id, object.to_double() );
-
-    old_value = object;
-}
-
-/*****************************************************************************/
-
-class isdb_sc_fxnum_trace : public isdb_trace
-{
-public:
-
-    isdb_sc_fxnum_trace( const sc_fxnum& object,
-			 const sc_string& _name,
-			 const sc_string& _isdb_name );
-    void declare_variable( ISDB_Conn database );
-    void write( ISDB_Conn database );
-    bool changed();
-    void set_width();
-
-protected:
-
-    const sc_fxnum& object;
-    sc_fxnum old_value;
-
-};
-
-isdb_sc_fxnum_trace::isdb_sc_fxnum_trace( const sc_fxnum& _object,
-					  const sc_string& _name,
-					  const sc_string& _isdb_name )
-: isdb_trace( _name, _isdb_name ),
-  object( _object ),
-  old_value( _object._params.type_params(),
-	     _object._params.enc(),
-	     _object._params.cast_switch(),
-	     0 )
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void
-isdb_sc_fxnum_trace::declare_variable ( ISDB_Conn database )
-{
-    isdb_id = ISDB_DefineSignal( database, ISDB_Array, name,
-				 ISDB_Binary, 0, bit_width - 1 );
-    write( database );
-}
-
-bool
-isdb_sc_fxnum_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-isdb_sc_fxnum_trace::write( ISDB_Conn database )
-{
-    // TBD: make val a member function ==> less malloc calls
-
-    unsigned int* val = (unsigned int*) malloc( sizeof(unsigned int) *
-						bit_width );
-    int bitindex;
-    unsigned int isdb_val;
-
-    for( bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
-    {
-	isdb_val = object[bitindex] ? ISDB_HIGH : ISDB_LOW;
-	val[bitindex] = isdb_val;
-    }
-    ISDB_SetValue( database, isdb_id, sizeof(val[0]), val );
-    free( val );
-
-    old_value = object;
-}
-
-void
-isdb_sc_fxnum_trace::set_width()
-{
-    bit_width = object.wl();
-}
-
-/*****************************************************************************/
-
-class isdb_sc_fxnum_fast_trace : public isdb_trace
-{
-public:
-
-    isdb_sc_fxnum_fast_trace( const sc_fxnum_fast& object,
-			      const sc_string& _name,
-			      const sc_string& _isdb_name );
-    void declare_variable( ISDB_Conn database );
-    void write( ISDB_Conn database );
-    bool changed();
-    void set_width();
-
-protected:
-
-    const sc_fxnum_fast& object;
-    sc_fxnum_fast old_value;
-
-};
-
-isdb_sc_fxnum_fast_trace::isdb_sc_fxnum_fast_trace( const sc_fxnum_fast& _object,
-						    const sc_string& _name,
-						    const sc_string& _isdb_name )
-: isdb_trace( _name, _isdb_name ),
-  object( _object ),
-  old_value( _object._params.type_params(),
-	     _object._params.enc(),
-	     _object._params.cast_switch(),
-	     0 )
-{
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void
-isdb_sc_fxnum_fast_trace::declare_variable ( ISDB_Conn database )
-{
-    isdb_id = ISDB_DefineSignal( database, ISDB_Array, name,
-				 ISDB_Binary, 0, bit_width - 1 );
-    write( database );
-}
-
-bool
-isdb_sc_fxnum_fast_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-isdb_sc_fxnum_fast_trace::write( ISDB_Conn database )
-{
-    // TBD: make val a member function ==> less malloc calls
-
-    unsigned int* val = (unsigned int*) malloc( sizeof(unsigned int) *
-						bit_width );
-    int bitindex;
-    unsigned int isdb_val;
-
-    for( bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
-    {
-	isdb_val = object[bitindex] ? ISDB_HIGH : ISDB_LOW;
-	val[bitindex] = isdb_val;
-    }
-    ISDB_SetValue( database, isdb_id, sizeof(val[0]), val );
-    free( val );
-
-    old_value = object;
-}
-
-void
-isdb_sc_fxnum_fast_trace::set_width()
-{
-    bit_width = object.wl();
-}
-
-#endif
-
-
-/**************************************************************************************/
-
-class isdb_unsigned_int_trace : public isdb_trace {
-public:
-    isdb_unsigned_int_trace(const unsigned& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:
-    const unsigned& object;
-    unsigned old_value;
-    unsigned mask; 
-};
-
-
-isdb_unsigned_int_trace::isdb_unsigned_int_trace(const unsigned& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_unsigned_int_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
-}
-
-bool isdb_unsigned_int_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_unsigned_int_trace::write(ISDB_Conn database)
-{
-  ISDB_SetValue (database, isdb_id, object);
+    // Room for the bit_width values of an array
+    unsigned int* values_buffer();
 
-  old_value = object;
-}
-
-/**************************************************************************************/
+    virtual ~isdb_trace();
 
-class isdb_unsigned_short_trace : public isdb_trace {
-public:
-    isdb_unsigned_short_trace(const unsigned short& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
+    const sc_string name;
+    const sc_string isdb_name;
+    const char* isdb_var_typ_name;
+    int bit_width; 
+    ISDB_Signal isdb_id;
 
-protected:
-    const unsigned short& object;
-    unsigned short old_value;
-    unsigned short mask; 
+private:
+    unsigned int* values;     // Allocated by values_buffer()
 };
 
 
-isdb_unsigned_short_trace::isdb_unsigned_short_trace(const unsigned short& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 16) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffff;
-    }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
-
-void isdb_unsigned_short_trace::declare_variable (ISDB_Conn database)
+isdb_trace::isdb_trace(const sc_string& _name, const sc_string& _isdb_name)
+       : name(_name), isdb_name(_isdb_name), bit_width(0), values(0)
 {
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
+    /* Intentionally blank */
 }
 
-bool isdb_unsigned_short_trace::changed()
+unsigned int* isdb_trace::values_buffer()
 {
-    return object != old_value;
+    if (values == 0)
+        values = new unsigned int[bit_width];
+    return values;
 }
-
-void isdb_unsigned_short_trace::write(ISDB_Conn database)
+        
+void isdb_trace::compose_data_line(char* rawdata, char* compdata)
 {
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
-}
-
-/**************************************************************************************/
-
-class isdb_unsigned_char_trace : public isdb_trace {
-public:
-    isdb_unsigned_char_trace(const unsigned char& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:
-    const unsigned char& object;
-    unsigned char old_value;
-    unsigned char mask; 
-};
-
+    assert(rawdata != compdata);
 
-isdb_unsigned_char_trace::isdb_unsigned_char_trace(const unsigned char& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 8) {
-        mask = ~(-1 << bit_width);
+    if(bit_width == 0) {
+      compdata[0] = '\0'; 
     } else {
-        mask = 0xff;
+        if(bit_width == 1){
+            compdata[0] = rawdata[0];
+            strcpy(&(compdata[1]), isdb_name);
+        }
+        else{
+            char* effective_begin = rawdata;
+            sprintf(compdata, "b%s %s", effective_begin, (const char *) isdb_name);
+        }
     }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
 }
 
-void isdb_unsigned_char_trace::declare_variable (ISDB_Conn database)
+void isdb_trace::declare_variable (ISDB_Conn database)
 {
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
+  /* Intentionally Blank, should be defined for each type separately */
 }
 
-bool isdb_unsigned_char_trace::changed()
+void isdb_trace::set_width()
 {
-    return object != old_value;
+  /* Intentionally Blank, should be defined for each type separately */
 }
 
-void isdb_unsigned_char_trace::write(ISDB_Conn database)
+isdb_trace::~isdb_trace()
 {
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
+    delete[] values;
 }
 
-/**************************************************************************************/
-
-class isdb_unsigned_long_trace : public isdb_trace {
-public:
-    isdb_unsigned_long_trace(const unsigned long& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:
-    const unsigned long& object;
-    unsigned long old_value;
-    unsigned long mask; 
-};
 
+/**********************************************************************************************/
 
-isdb_unsigned_long_trace::isdb_unsigned_long_trace(const unsigned long& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
-}
+// Declarations and encoders of the kinds of values (see
+// sc_trace_value.h).  The integer types of SystemC are recorded as
+// integers, not as arrays.
 
-void isdb_unsigned_long_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
-}
+static inline const char* isdb_var_type(sc_trace_real) { return "real"; }
+template< class K >
+inline const char* isdb_var_type(K) { return "wire"; }
 
-bool isdb_unsigned_long_trace::changed()
+template< class T >
+inline void
+isdb_declare(isdb_trace& t, ISDB_Conn database, const T&, sc_trace_bit)
 {
-    return object != old_value;
+  t.isdb_id = ISDB_DefineSignal (database, ISDB_Binary, (const char*) t.name);
 }
 
-void isdb_unsigned_long_trace::write(ISDB_Conn database)
+template< class T >
+inline void
+isdb_declare(isdb_trace& t, ISDB_Conn database, const T&, sc_trace_logic)
 {
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
+  t.isdb_id = ISDB_DefineSignal (database, ISDB_Binary, (const char*) t.name);
 }
 
-/**************************************************************************************/
-
-class isdb_signed_int_trace : public isdb_trace {
-public:
-    isdb_signed_int_trace(const int& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:
-    const int& object;
-    int old_value;
-    unsigned mask; 
-};
-
-
-isdb_signed_int_trace::isdb_signed_int_trace(const signed& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
+template< class T >
+inline void
+isdb_declare(isdb_trace& t, ISDB_Conn database, const T&, sc_trace_bits)
 {
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
+  t.isdb_id = ISDB_DefineSignal (database, ISDB_Array, (const char*) t.name,
+			         ISDB_Binary, 0, t.bit_width-1);
 }
 
-void isdb_signed_int_trace::declare_variable (ISDB_Conn database)
+template< class T >
+inline void
+isdb_declare(isdb_trace& t, ISDB_Conn database, const T&, sc_trace_logics)
 {
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
+  t.isdb_id = ISDB_DefineSignal (database, ISDB_Array, (const char*) t.name,
+			         ISDB_Binary, 0, t.bit_width-1);
 }
 
-bool isdb_signed_int_trace::changed()
+template< class T >
+inline void
+isdb_declare(isdb_trace& t, ISDB_Conn database, const T&, sc_trace_integer)
 {
-    return object != old_value;
+  t.isdb_id = ISDB_DefineSignal (database, ISDB_Integer, (const char*) t.name);
 }
 
-void isdb_signed_int_trace::write(ISDB_Conn database)
+template< class T >
+inline void
+isdb_declare(isdb_trace& t, ISDB_Conn database, const T&, sc_trace_real)
 {
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
+  t.isdb_id = ISDB_DefineSignal (database, ISDB_Float, (const char*) t.name);
 }
 
-/**************************************************************************************/
-
-class isdb_signed_short_trace : public isdb_trace {
-public:
-    isdb_signed_short_trace(const short& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:
-    const short& object;
-    short old_value;
-    unsigned short mask; 
-};
-
-
-isdb_signed_short_trace::isdb_signed_short_trace(const short& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 16) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffff;
-    }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
+#define DEFN_ISDB_DECLARE_INTEGER(tp)                                         \
+static inline void                                                            \
+isdb_declare(isdb_trace& t, ISDB_Conn database, const tp&, sc_trace_bits)     \
+{                                                                             \
+  t.isdb_id = ISDB_DefineSignal (database, ISDB_Integer, (const char*) t.name); \
 }
 
-void isdb_signed_short_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
-}
+DEFN_ISDB_DECLARE_INTEGER(sc_unsigned)
+DEFN_ISDB_DECLARE_INTEGER(sc_signed)
+DEFN_ISDB_DECLARE_INTEGER(sc_uint_base)
+DEFN_ISDB_DECLARE_INTEGER(sc_int_base)
 
+#undef DEFN_ISDB_DECLARE_INTEGER
 
-bool isdb_signed_short_trace::changed()
+template< class T >
+inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const T& object, sc_trace_bit)
 {
-    return object != old_value;
+  int val = object==true ? ISDB_HIGH : ISDB_LOW;
+  ISDB_SetValue (database, t.isdb_id, val);
 }
 
-
-void isdb_signed_short_trace::write(ISDB_Conn database)
+template< class T >
+inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const T& object, sc_trace_logic)
 {
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
+  int val = map_sc_logic_state_to_isdb_binval(object.to_char());
+  ISDB_SetValue (database, t.isdb_id, val);
 }
 
-/**************************************************************************************/
-
-class isdb_signed_char_trace : public isdb_trace {
-public:
-    isdb_signed_char_trace(const char& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:
-    const char& object;
-    char old_value;
-    unsigned char mask; 
-};
-
-
-isdb_signed_char_trace::isdb_signed_char_trace(const char& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
+template< class T >
+inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const T& object, sc_trace_bits)
 {
-    bit_width = _width;
-    if (bit_width < 8) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xff;
-    }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
+  unsigned int *val = t.values_buffer();
+  for (int bitindex = t.bit_width - 1; bitindex >= 0; --bitindex)
+    val[bitindex] = object[bitindex] ? ISDB_HIGH : ISDB_LOW;
+  ISDB_SetValue (database, t.isdb_id, sizeof(val[0]), val);
 }
 
-void isdb_signed_char_trace::declare_variable (ISDB_Conn database)
+template< class T >
+inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const T& object, sc_trace_logics)
 {
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
+  unsigned int *val = t.values_buffer();
+  for (int bitindex = t.bit_width - 1; bitindex >= 0; --bitindex)
+    val[bitindex] = map_sc_logic_state_to_isdb_binval(object[bitindex].to_char());
+  ISDB_SetValue (database, t.isdb_id, sizeof(val[0]), val);
 }
 
-
-bool isdb_signed_char_trace::changed()
+template< class T >
+inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const T& object, sc_trace_integer)
 {
-    return object != old_value;
+  ISDB_SetValue (database, t.isdb_id, object);
 }
 
-
-void isdb_signed_char_trace::write(ISDB_Conn database)
+template< class T >
+inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const T& object, sc_trace_real)
 {
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
+  ISDB_SetValue (database, t.isdb_id, sc_trace_to_double(object));
 }
 
-/**************************************************************************************/
-
-class isdb_signed_long_trace : public isdb_trace {
-public:
-    isdb_signed_long_trace(const long& object, const sc_string& _name, const sc_string& _isdb_name, int _width);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:
-    const long& object;
-    long old_value;
-    unsigned long mask; 
-};
-
-
-isdb_signed_long_trace::isdb_signed_long_trace(const long& _object, const sc_string& _name, const sc_string& _isdb_name, int _width) 
-  : isdb_trace(_name, _isdb_name), object(_object)
+static inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const sc_unsigned& object, sc_trace_bits)
 {
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    isdb_var_typ_name = "wire";
-    old_value = object;
+  ISDB_SetValue (database, t.isdb_id, object.to_uint());
 }
 
-void isdb_signed_long_trace::declare_variable (ISDB_Conn database)
+static inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const sc_signed& object, sc_trace_bits)
 {
-  isdb_id = ISDB_DefineSignal (database, ISDB_Integer, name);
-  write(database);
+  ISDB_SetValue (database, t.isdb_id, object.to_int());
 }
 
-
-bool isdb_signed_long_trace::changed()
+static inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const sc_uint_base& object, sc_trace_bits)
 {
-    return object != old_value;
+  ISDB_SetValue (database, t.isdb_id, uint64(object));
 }
 
-
-void isdb_signed_long_trace::write(ISDB_Conn database)
+static inline void
+isdb_put_value(isdb_trace& t, ISDB_Conn database, const sc_int_base& object, sc_trace_bits)
 {
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
+  ISDB_SetValue (database, t.isdb_id, int64(object));
 }
 
-
-/**********************************************************************************************/
-
-class isdb_float_trace : public isdb_trace {
+// The trace of an object of any traced type but enumerations
+template< class T >
+class isdb_typed_trace : public isdb_trace {
 public:
-    isdb_float_trace(const float& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
-
-protected:    
-    const float& object;
-    float old_value;
-};
-
-isdb_float_trace::isdb_float_trace(const float& _object, const sc_string& _name, const sc_string& _isdb_name)
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    isdb_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
-}
-
-void isdb_float_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Float, name);
-  write(database);
-}
+    typedef typename sc_trace_traits<T>::kind kind;
 
-bool isdb_float_trace::changed()
-{
-    return object != old_value;
-}
+    isdb_typed_trace(const T& _object, const sc_string& _name, const sc_string& _isdb_name, int _width = 1)
+      : isdb_trace(_name, _isdb_name), value(_object)
+    {
+        isdb_var_typ_name = isdb_var_type(kind());
+        bit_width = sc_trace_width(_object, _width);
+    }
 
-void isdb_float_trace::write(ISDB_Conn database)
-{
-  ISDB_SetValue (database, isdb_id, object);
+    void declare_variable(ISDB_Conn database)
+    {
+        isdb_declare(*this, database, value.object, kind());
+        write(database);
+    }
 
-  old_value = object;
-}
+    void write(ISDB_Conn database)
+    {
+        isdb_put_value(*this, database, value.object, kind());
+        value.update_old();
+    }
 
-/**********************************************************************************************/
+    bool changed() { return value.changed(); }
 
-class isdb_double_trace : public isdb_trace {
-public:
-    isdb_double_trace(const double& object, const sc_string& _name, const sc_string& _isdb_name);
-    void declare_variable(ISDB_Conn database);
-    void write(ISDB_Conn database);
-    bool changed();
+    // Vectors may have been resized since they were traced
+    void set_width() { bit_width = sc_trace_width(value.object, bit_width); }
 
-protected:    
-    const double& object;
-    double old_value;
+protected:
+    sc_trace_value<T> value;
 };
 
-isdb_double_trace::isdb_double_trace(const double& _object, const sc_string& _name, const sc_string& _isdb_name)
-  : isdb_trace(_name, _isdb_name), object(_object)
-{
-    isdb_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
-}
-
-void isdb_double_trace::declare_variable (ISDB_Conn database)
-{
-  isdb_id = ISDB_DefineSignal (database, ISDB_Float, name);
-  write(database);
-}
-
-bool isdb_double_trace::changed()
-{
-    return object != old_value;
-}
-
-void isdb_double_trace::write(ISDB_Conn database)
-{
-  ISDB_SetValue (database, isdb_id, object);
-
-  old_value = object;
-}
-
-
 /********************************************************************************************/
 
 class isdb_enum_trace : public isdb_trace {
@@ -1435,6 +505,8 @@ void isdb_trace_file::initialize()
     t->declare_variable(database);
   }
 
+  init_change_detection(traces.size());
+
 }
 
 
@@ -1491,7 +563,8 @@ void isdb_trace_file::trace(const bool& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_bool_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<bool>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 
@@ -1503,7 +576,8 @@ void isdb_trace_file::trace(const sc_bool_vector& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_bool_vector_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<sc_bool_vector>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 
@@ -1515,7 +589,8 @@ void isdb_trace_file::trace(const sc_logic& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_sc_logic_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<sc_logic>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 
@@ -1527,7 +602,8 @@ void isdb_trace_file::trace(const sc_logic_vector& object, const sc_string& name
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_sc_logic_vector_trace(object,name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<sc_logic_vector>(object,name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const unsigned& object, const sc_string& name, int _width)
@@ -1538,7 +614,8 @@ void isdb_trace_file::trace(const unsigned& object, const sc_string& name, int _
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_unsigned_int_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<unsigned>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const unsigned char& object, const sc_string& name, int _width)
@@ -1549,7 +626,8 @@ void isdb_trace_file::trace(const unsigned char& object, const sc_string& name,
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_unsigned_char_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<unsigned char>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const unsigned short& object, const sc_string& name, int _width)
@@ -1560,7 +638,8 @@ void isdb_trace_file::trace(const unsigned short& object, const sc_string& name,
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_unsigned_short_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<unsigned short>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const unsigned long& object, const sc_string& name, int _width)
@@ -1571,7 +650,8 @@ void isdb_trace_file::trace(const unsigned long& object, const sc_string& name,
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_unsigned_long_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<unsigned long>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const int& object, const sc_string& name, int _width)
@@ -1582,7 +662,8 @@ void isdb_trace_file::trace(const int& object, const sc_string& name, int _width
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_signed_int_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<int>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const char& object, const sc_string& name, int _width)
@@ -1593,7 +674,8 @@ void isdb_trace_file::trace(const char& object, const sc_string& name, int _widt
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_signed_char_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<char>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const short& object, const sc_string& name, int _width)
@@ -1604,7 +686,8 @@ void isdb_trace_file::trace(const short& object, const sc_string& name, int _wid
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_signed_short_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<short>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const long& object, const sc_string& name, int _width)
@@ -1615,7 +698,8 @@ void isdb_trace_file::trace(const long& object, const sc_string& name, int _widt
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_signed_long_trace(object, name, temp_isdb_name, _width));
+  traces.push_back(new isdb_typed_trace<long>(object, name, temp_isdb_name, _width));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const float& object, const sc_string& name)
@@ -1626,7 +710,8 @@ void isdb_trace_file::trace(const float& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_float_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<float>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const double& object, const sc_string& name)
@@ -1637,7 +722,8 @@ void isdb_trace_file::trace(const double& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_double_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<double>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const sc_unsigned& object, const sc_string& name)
@@ -1648,7 +734,8 @@ void isdb_trace_file::trace(const sc_unsigned& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_sc_unsigned_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<sc_unsigned>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const sc_signed& object, const sc_string& name)
@@ -1659,7 +746,8 @@ void isdb_trace_file::trace(const sc_signed& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_sc_signed_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<sc_signed>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 
@@ -1671,7 +759,8 @@ void isdb_trace_file::trace(const sc_int_base& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_sc_int_base_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<sc_int_base>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const sc_uint_base& object, const sc_string& name)
@@ -1682,7 +771,8 @@ void isdb_trace_file::trace(const sc_uint_base& object, const sc_string& name)
   
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
-  traces.push_back(new isdb_sc_uint_base_trace(object, name, temp_isdb_name));
+  traces.push_back(new isdb_typed_trace<sc_uint_base>(object, name, temp_isdb_name));
+  sc_share_trace(this, object);
 }
 
 
@@ -1699,9 +789,9 @@ isdb_trace_file::trace( const tp& object, const sc_string& name )             \
                                                                               \
     sc_string temp_isdb_name;                                                 \
     create_isdb_name( &temp_isdb_name );                                      \
-    traces.push_back( new isdb_ ## tp ## _trace( object,                      \
-						 name,                        \
-						 temp_isdb_name ) );          \
+    traces.push_back( new isdb_typed_trace<tp>( object,                       \
+						name,                         \
+						temp_isdb_name ) );           \
 }
 
 DEFN_TRACE_METHOD(sc_fxval)
@@ -1723,6 +813,7 @@ void isdb_trace_file::trace(const unsigned& object, const sc_string& name, const
   sc_string temp_isdb_name;
   create_isdb_name(&temp_isdb_name);
   traces.push_back(new isdb_enum_trace(object, name, temp_isdb_name, enum_literals));
+  sc_share_trace(this, object);
 }
 
 void isdb_trace_file::trace(const sc_signal_bool_vector& object, const sc_string& name)
@@ -1733,7 +824,8 @@ void isdb_trace_file::trace(const sc_signal_bool_vector& object, const sc_string
 
     sc_string temp_isdb_name;
     create_isdb_name(&temp_isdb_name);
-    traces.push_back(new isdb_bool_vector_trace((const sc_bool_vector&) object, name, temp_isdb_name));
+    traces.push_back(new isdb_typed_trace<sc_bool_vector>((const sc_bool_vector&) object, name, temp_isdb_name));
+    sc_share_trace(this, (const sc_bool_vector&) object);
 }
 
 
@@ -1745,7 +837,8 @@ void isdb_trace_file::trace(const sc_signal_logic_vector& object, const sc_strin
 
     sc_string temp_isdb_name;
     create_isdb_name(&temp_isdb_name);
-    traces.push_back(new isdb_sc_logic_vector_trace((const sc_logic_vector&) object, name, temp_isdb_name));
+    traces.push_back(new isdb_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name, temp_isdb_name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
 }
 
 void isdb_trace_file::trace(const sc_signal_resolved& object, const sc_string& name)
@@ -1756,7 +849,8 @@ void isdb_trace_file::trace(const sc_signal_resolved& object, const sc_string& n
 
     sc_string temp_isdb_name;
     create_isdb_name(&temp_isdb_name);
-    traces.push_back(new isdb_sc_logic_trace((const sc_logic&) *(object.get_data_ptr()), name, temp_isdb_name));
+    traces.push_back(new isdb_typed_trace<sc_logic>((const sc_logic&) *(object.get_data_ptr()), name, temp_isdb_name));
+    sc_share_trace(this, (const sc_logic&) *(object.get_data_ptr()));
 }
 
 void isdb_trace_file::trace(const sc_signal_resolved_vector& object, const sc_string& name)
@@ -1767,7 +861,8 @@ void isdb_trace_file::trace(const sc_signal_resolved_vector& object, const sc_st
 
     sc_string temp_isdb_name;
     create_isdb_name(&temp_isdb_name);
-    traces.push_back(new isdb_sc_logic_vector_trace((const sc_logic_vector&) object, name, temp_isdb_name));
+    traces.push_back(new isdb_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name, temp_isdb_name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
 }
 
 void isdb_trace_file::write_comment(const sc_string& comment)
@@ -1781,6 +876,16 @@ void isdb_trace_file::delta_cycles(bool flag)
     trace_delta_cycles = flag;
 }
 
+int isdb_trace_file::num_traces() const
+{
+    return traces.size();
+}
+
+const char* isdb_trace_file::trace_name(int i) const
+{
+    return (const char *) traces[i]->name;
+}
+
 void isdb_trace_file::cycle(bool this_is_a_delta_cycle)
 {
   char message[4000];
@@ -1887,8 +992,10 @@ void isdb_trace_file::cycle(bool this_is_a_delta_cycle)
   //
   bool time_printed = false;
   isdb_trace* const* const l_traces = traces.raw_data();
-  for (int i = 0; i < traces.size(); i++) {
-    isdb_trace* t = l_traces[i];
+  const int* const l_candidates = candidates();
+  const int n_candidates = num_candidates();
+  for (int k = 0; k < n_candidates; k++) {
+    isdb_trace* t = l_traces[l_candidates[k]];
     if(t->changed()){
 
       // Set time stamp on the fly
@@ -1905,6 +1012,20 @@ void isdb_trace_file::cycle(bool this_is_a_delta_cycle)
       t->write(database);
     }
   }
+  // Traces just enabled again
+  const int* const l_forced = forced();
+  const int n_forced = num_forced();
+  for (int k = 0; k < n_forced; k++) {
+    if(time_printed == false){
+      ISDB_Time time;
+      time.low  = this_time_units_low;
+      time.high = this_time_units_high;
+      ISDB_SetTime (database, time);
+      time_printed = true;
+    }
+    l_traces[l_forced[k]]->write(database);
+  }
+  clear_dirty();
 
   if(time_printed){
     // We update previous_time_units only when we print time because
@@ -0,0 +1,174 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_lz.cpp -- A small LZ77 block compressor, used for the blocks of
+                 binary waveform files.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#include <string.h>
+
+#include "sc_lz.h"
+
+const int SC_LZ_HASH_BITS  = 13;
+const int SC_LZ_MIN_MATCH  = 4;
+const int SC_LZ_MAX_OFFSET = 65535;
+
+static inline unsigned
+sc_lz_hash( const unsigned char* p )
+{
+    unsigned v = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned) p[3] << 24);
+    return (v * 2654435761U) >> (32 - SC_LZ_HASH_BITS);
+}
+
+static inline unsigned char*
+sc_lz_put_length( unsigned char* op, int n )
+{
+    while (n >= 255) {
+        *op++ = 255;
+        n -= 255;
+    }
+    *op++ = (unsigned char) n;
+    return op;
+}
+
+static unsigned char*
+sc_lz_put_sequence( unsigned char* op, const unsigned char* lit, int n_lit,
+                    int offset, int match_len )
+{
+    int ml = match_len - SC_LZ_MIN_MATCH;
+    unsigned char* token = op++;
+    *token = (unsigned char) (((n_lit < 15) ? n_lit : 15) << 4);
+    if (n_lit >= 15)
+        op = sc_lz_put_length(op, n_lit - 15);
+    memcpy(op, lit, n_lit);
+    op += n_lit;
+    if (match_len == 0)
+        return op;                      // the last sequence
+
+    *op++ = (unsigned char) offset;
+    *op++ = (unsigned char) (offset >> 8);
+    *token |= (unsigned char) ((ml < 15) ? ml : 15);
+    if (ml >= 15)
+        op = sc_lz_put_length(op, ml - 15);
+    return op;
+}
+
+int
+sc_lz_compress( const unsigned char* src, int n, unsigned char* dst )
+{
+    int table[1 << SC_LZ_HASH_BITS];
+    for (int i = 0; i < (1 << SC_LZ_HASH_BITS); ++i)
+        table[i] = -SC_LZ_MAX_OFFSET - 1;
+
+    const unsigned char* const end = src + n;
+    const unsigned char* ip = src;
+    const unsigned char* anchor = src;
+    unsigned char* op = dst;
+    int misses = 0;
+
+    while (end - ip >= SC_LZ_MIN_MATCH) {
+        unsigned h = sc_lz_hash(ip);
+        int pos = ip - src;
+        int ref = table[h];
+        table[h] = pos;
+        if (pos - ref > SC_LZ_MAX_OFFSET || memcmp(src + ref, ip, SC_LZ_MIN_MATCH) != 0) {
+            // Skip faster through data that does not compress
+            ip += 1 + (misses++ >> 6);
+            continue;
+        }
+        misses = 0;
+
+        const unsigned char* m = src + ref;
+        int len = SC_LZ_MIN_MATCH;
+        while (ip + len < end && m[len] == ip[len])
+            ++len;
+        op = sc_lz_put_sequence(op, anchor, ip - anchor, ip - m, len);
+        ip += len;
+        anchor = ip;
+    }
+    op = sc_lz_put_sequence(op, anchor, end - anchor, 0, 0);
+    return op - dst;
+}
+
+int
+sc_lz_decompress( const unsigned char* src, int n,
+                  unsigned char* dst, int dst_size )
+{
+    const unsigned char* ip = src;
+    const unsigned char* const iend = src + n;
+    unsigned char* op = dst;
+    unsigned char* const oend = dst + dst_size;
+
+    while (ip < iend) {
+        int token = *ip++;
+        int n_lit = token >> 4;
+        if (n_lit == 15) {
+            int b;
+            do {
+                if (ip == iend)
+                    return -1;
+                b = *ip++;
+                n_lit += b;
+            } while (b == 255);
+        }
+        if (n_lit > iend - ip || n_lit > oend - op)
+            return -1;
+        memcpy(op, ip, n_lit);
+        op += n_lit;
+        ip += n_lit;
+        if (ip == iend)
+            break;                      // the last sequence
+
+        if (iend - ip < 2)
+            return -1;
+        int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op - dst)
+            return -1;
+        int len = token & 15;
+        if (len == 15) {
+            int b;
+            do {
+                if (ip == iend)
+                    return -1;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += SC_LZ_MIN_MATCH;
+        if (len > oend - op)
+            return -1;
+        // The match may overlap the bytes it produces
+        const unsigned char* m = op - offset;
+        while (len-- > 0)
+            *op++ = *m++;
+    }
+    return op - dst;
+}
@@ -0,0 +1,71 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_lz.h -- A small LZ77 block compressor, used for the blocks of
+               binary waveform files.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#ifndef SC_LZ_H
+#define SC_LZ_H
+
+//
+// The compressed form of a block is a sequence of
+//
+//     token, [literal length], literals, offset, [match length]
+//
+// The high 4 bits of the token are the number of literals, the low 4
+// bits the length of the match minus 4; 15 means that more bytes
+// follow, each added to the length, up to the first one below 255.
+// The offset is 2 bytes, least significant first, and counts back from
+// the current output position.  The last sequence has literals only.
+// The format needs no other state than the block itself, and
+// decompression only copies bytes, so it is fast enough to be used
+// for every block written.
+//
+
+// The most bytes n bytes may take when compressed
+inline int
+sc_lz_bound( int n )
+{
+    return n + n / 255 + 16;
+}
+
+// Compresses the n bytes at src into dst, which must have room for
+// sc_lz_bound(n) bytes; returns the compressed size.
+extern int sc_lz_compress( const unsigned char* src, int n,
+                           unsigned char* dst );
+
+// Decompresses the n bytes at src into dst, which has room for
+// dst_size bytes; returns the decompressed size, or -1 if src is not
+// a valid compressed block or does not fit into dst.
+extern int sc_lz_decompress( const unsigned char* src, int n,
+                             unsigned char* dst, int dst_size );
+
+#endif
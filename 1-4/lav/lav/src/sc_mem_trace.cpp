@@ -0,0 +1,695 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_mem_trace.cpp -- Tracing into a bounded in-memory ring of value
+                        changes.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __BCPLUSPLUS__
+#pragma hdrstop
+#endif
+#include "sc_string.h"
+#include "sc_logic.h"
+#include "sc_logic_vector.h"
+
+#include "sc_bool_vector.h"
+#include "sc_mem_trace.h"
+#include "sc_simcontext.h"
+#include "sc_trace_registry.h"
+#include "numeric_bit/numeric_bit.h"
+#include "sc_resolved.h"
+
+static void
+mem_put_error_message(const char* msg, bool just_warning)
+{
+    if(just_warning){
+        fprintf(stderr, "Memory Trace Warning:\n%s\n\n", msg);
+    }
+    else{
+        fprintf(stderr, "Memory Trace ERROR:\n%s\n\n", msg);
+    }
+}
+
+// Character of an sc_logic value, mapped as for VCD
+static inline char
+mem_logic_char(char c)
+{
+    switch(c){
+        case '0':
+        case 'L':
+            return '0';
+        case '1':
+        case 'H':
+            return '1';
+        case 'Z':
+            return 'z';
+        default:
+            return 'x';
+    }
+}
+
+// Writes the low width bits of v to buf; returns width
+static int
+mem_put_uint64(char* buf, uint64 v, int width)
+{
+    for (int i = width - 1; i >= 0; --i)
+        *buf++ = ((v >> i) & 1) ? '1' : '0';
+    *buf = '\0';
+    return width;
+}
+
+
+/*****************************************************************************/
+
+// Base class for the traces
+class mem_trace {
+public:
+    mem_trace(const sc_string& _name)
+        : name(_name), width(0)
+    { }
+    virtual ~mem_trace();
+
+    // Vectors may only know their width when tracing begins
+    virtual void set_width();
+
+    // Maximum number of characters of a value, without the null
+    virtual int value_length() const;
+
+    virtual bool changed() = 0;
+
+    // Writes the current value, null-terminated, to buf and
+    // remembers it for changed(); returns the number of characters
+    virtual int write(char* buf) = 0;
+
+    const sc_string name;
+    int width;
+};
+
+mem_trace::~mem_trace()
+{
+}
+
+void mem_trace::set_width()
+{
+  /* Intentionally Blank, should be defined for each type separately */
+}
+
+int mem_trace::value_length() const
+{
+    return width;
+}
+
+
+/*****************************************************************************/
+
+// Encoders of the kinds of values (see sc_trace_value.h).  Each
+// writes the value, null-terminated, to buf and returns the number
+// of characters.
+
+// Integer values are at most as wide as their type, however wide
+// they are traced
+template< class T >
+inline int
+mem_width(const T&, int width, sc_trace_integer)
+{
+    const int max_width = 8 * sizeof(typename sc_trace_traits<T>::unsigned_type);
+    return (width < max_width) ? width : max_width;
+}
+
+template< class T, class K >
+inline int
+mem_width(const T&, int width, K) { return width; }
+
+static inline int mem_value_length(int, sc_trace_real) { return 31; }
+template< class K >
+inline int mem_value_length(int width, K) { return width; }
+
+template< class T >
+inline int
+mem_put_value(char* buf, const T& object, int, sc_trace_bit)
+{
+    buf[0] = object ? '1' : '0';
+    buf[1] = '\0';
+    return 1;
+}
+
+template< class T >
+inline int
+mem_put_value(char* buf, const T& object, int, sc_trace_logic)
+{
+    buf[0] = mem_logic_char(object.to_char());
+    buf[1] = '\0';
+    return 1;
+}
+
+template< class T >
+inline int
+mem_put_value(char* buf, const T& object, int width, sc_trace_bits)
+{
+    sc_trace_get_bits(object, width, buf);
+    buf[width] = '\0';
+    return width;
+}
+
+template< class T >
+inline int
+mem_put_value(char* buf, const T& object, int width, sc_trace_logics)
+{
+    sc_trace_get_bits(object, width, buf);
+    for (int i = 0; i < width; ++i)
+        buf[i] = mem_logic_char(buf[i]);
+    buf[width] = '\0';
+    return width;
+}
+
+// Values that do not fit into the width are written as x
+template< class T >
+inline int
+mem_put_value(char* buf, const T& object, int width, sc_trace_integer)
+{
+    unsigned long v;
+    if (! sc_trace_get_integer(object, width, v)) {
+        memset(buf, 'x', width);
+        buf[width] = '\0';
+        return width;
+    }
+    return mem_put_uint64(buf, (uint64) v, width);
+}
+
+template< class T >
+inline int
+mem_put_value(char* buf, const T& object, int, sc_trace_real)
+{
+    return sprintf(buf, "%.16g", sc_trace_to_double(object));
+}
+
+// The trace of an object of any traced type but enumerations
+template< class T >
+class mem_typed_trace : public mem_trace {
+public:
+    typedef typename sc_trace_traits<T>::kind kind;
+
+    mem_typed_trace(const T& _object, const sc_string& _name, int _width = 1)
+        : mem_trace(_name), value(_object)
+    {
+        width = mem_width(_object, sc_trace_width(_object, _width), kind());
+    }
+
+    int value_length() const { return mem_value_length(width, kind()); }
+
+    bool changed() { return value.changed(); }
+
+    int write(char* buf)
+    {
+        value.update_old();
+        return mem_put_value(buf, value.object, width, kind());
+    }
+
+    // Vectors may have been resized since they were traced
+    void set_width() { width = mem_width(value.object, sc_trace_width(value.object, width), kind()); }
+
+protected:
+    sc_trace_value<T> value;
+};
+
+// Enumerated objects show their literals, or their numbers if out of
+// range
+class mem_enum_trace : public mem_trace {
+public:
+    mem_enum_trace(const unsigned& _object, const sc_string& _name,
+                   const char** _enum_literals)
+        : mem_trace(_name), object(_object), literals(_enum_literals)
+    {
+        max_length = 10;        // the digits of an unsigned
+        for (nliterals = 0; literals[nliterals]; nliterals++) {
+            int len = strlen(literals[nliterals]);
+            if (len > max_length)
+                max_length = len;
+        }
+        width = 1;
+        old_value = object;
+    }
+    int value_length() const { return max_length; }
+    bool changed() { return object != old_value; }
+    int write(char* buf)
+    {
+        old_value = object;
+        if (object < (unsigned) nliterals) {
+            strcpy(buf, literals[object]);
+            return strlen(buf);
+        }
+        return sprintf(buf, "%u", object);
+    }
+
+protected:
+    const unsigned& object;
+    unsigned old_value;
+    const char** literals;
+    int nliterals;
+    int max_length;
+};
+
+/**************************************************************************************************
+           mem_trace_file functions
+***************************************************************************************************/
+
+
+mem_trace_file::mem_trace_file(int _max_changes, int _value_bytes)
+{
+    max_changes = (_max_changes > 0) ? _max_changes : 1;
+    ring = new sc_mem_trace_change[max_changes];
+    first_change = 0;
+    n_changes = 0;
+    n_dropped = 0;
+
+    value_bytes = (_value_bytes > 0) ? _value_bytes : 1;
+    values = new char[value_bytes];
+    value_head = 0;
+
+    callbacks = 0;
+    n_callbacks = 0;
+    n_alloc_callbacks = 0;
+
+    trace_delta_cycles = false; // Make this the default
+    initialized = false;
+}
+
+mem_trace_file::~mem_trace_file()
+{
+    for (int i = 0; i < traces.size(); i++)
+        delete traces[i];
+    delete[] ring;
+    delete[] values;
+    delete[] callbacks;
+}
+
+void mem_trace_file::add_callback(sc_mem_trace_callback fn, void* arg)
+{
+    if (n_callbacks == n_alloc_callbacks) {
+        n_alloc_callbacks += 4;
+        callback_entry* new_callbacks = new callback_entry[n_alloc_callbacks];
+        for (int i = 0; i < n_callbacks; i++)
+            new_callbacks[i] = callbacks[i];
+        delete[] callbacks;
+        callbacks = new_callbacks;
+    }
+    callbacks[n_callbacks].fn = fn;
+    callbacks[n_callbacks].arg = arg;
+    n_callbacks++;
+}
+
+void mem_trace_file::remove_callback(sc_mem_trace_callback fn, void* arg)
+{
+    for (int i = 0; i < n_callbacks; i++) {
+        if (callbacks[i].fn == fn && callbacks[i].arg == arg) {
+            for (--n_callbacks; i < n_callbacks; i++)
+                callbacks[i] = callbacks[i + 1];
+            return;
+        }
+    }
+}
+
+void mem_trace_file::clear()
+{
+    first_change = 0;
+    n_changes = 0;
+    value_head = 0;
+}
+
+void mem_trace_file::add_trace(mem_trace* t)
+{
+    if(initialized){
+        mem_put_error_message("No traces can be added once simulation has started.\n"
+                              "To add traces, create a new memory trace file.", false);
+        delete t;
+        return;
+    }
+    traces.push_back(t);
+}
+
+void mem_trace_file::trace(const bool& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<bool>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const sc_logic& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_logic>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const sc_bool_vector& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_bool_vector>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const sc_logic_vector& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_logic_vector>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const unsigned char& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<unsigned char>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const unsigned short& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<unsigned short>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const unsigned int& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<unsigned int>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const unsigned long& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<unsigned long>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const char& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<char>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const short& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<short>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const int& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<int>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const long& object, const sc_string& name, int width)
+{
+    add_trace(new mem_typed_trace<long>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const float& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<float>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const double& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<double>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const sc_signal_bool_vector& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_bool_vector>((const sc_bool_vector&) object, name));
+    sc_share_trace(this, (const sc_bool_vector&) object);
+}
+
+void mem_trace_file::trace(const sc_signal_logic_vector& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
+}
+
+void mem_trace_file::trace(const sc_uint_base& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_uint_base>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const sc_int_base& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_int_base>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const sc_unsigned& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_unsigned>(object, name));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::trace(const sc_signed& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_signed>(object, name));
+    sc_share_trace(this, object);
+}
+
+#ifdef SC_INCLUDE_FX
+
+void mem_trace_file::trace(const sc_fxval& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_fxval>(object, name));
+}
+
+void mem_trace_file::trace(const sc_fxval_fast& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_fxval_fast>(object, name));
+}
+
+void mem_trace_file::trace(const sc_fxnum& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_fxnum>(object, name));
+}
+
+void mem_trace_file::trace(const sc_fxnum_fast& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_fxnum_fast>(object, name));
+}
+
+#endif
+
+void mem_trace_file::trace(const sc_signal_resolved& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_logic>((const sc_logic&) *(object.get_data_ptr()), name));
+    sc_share_trace(this, (const sc_logic&) *(object.get_data_ptr()));
+}
+
+void mem_trace_file::trace(const sc_signal_resolved_vector& object, const sc_string& name)
+{
+    add_trace(new mem_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
+}
+
+void mem_trace_file::trace(const unsigned& object, const sc_string& name, const char** enum_literals)
+{
+    add_trace(new mem_enum_trace(object, name, enum_literals));
+    sc_share_trace(this, object);
+}
+
+void mem_trace_file::write_comment(const sc_string&)
+{
+    /* Intentionally blank */
+}
+
+void mem_trace_file::delta_cycles(bool flag)
+{
+    trace_delta_cycles = flag;
+}
+
+int mem_trace_file::num_traces() const
+{
+    return traces.size();
+}
+
+const char* mem_trace_file::trace_name(int i) const
+{
+    return (const char *) traces[i]->name;
+}
+
+void mem_trace_file::drop_oldest()
+{
+    if (++first_change == max_changes)
+        first_change = 0;
+    n_changes--;
+    n_dropped++;
+}
+
+// The values are kept in the order of the changes, so the values in
+// the way of a new one always belong to the oldest changes.
+char* mem_trace_file::reserve_value(int n)
+{
+    int start = value_head;
+    if (start + n > value_bytes) {
+        // Wrap around; the values between the head and the end of the
+        // buffer are the oldest ones
+        while (n_changes > 0 && ring[first_change].value - values >= start)
+            drop_oldest();
+        start = 0;
+    }
+    while (n_changes > 0) {
+        int offset = ring[first_change].value - values;
+        if (offset < start || offset >= start + n)
+            break;
+        drop_oldest();
+    }
+    return values + start;
+}
+
+void mem_trace_file::record(int i, double now)
+{
+    mem_trace* t = traces[i];
+    if (n_changes == max_changes)
+        drop_oldest();
+    char* value = reserve_value(t->value_length() + 1);
+    int length = t->write(value);
+    value_head = (value - values) + length + 1;
+
+    sc_mem_trace_change& c = ring[ring_index(n_changes)];
+    n_changes++;
+    c.time = now;
+    c.trace = i;
+    c.name = (const char *) t->name;
+    c.value = value;
+    c.length = length;
+
+    for (int k = 0; k < n_callbacks; k++)
+        (*callbacks[k].fn)(c, callbacks[k].arg);
+}
+
+int mem_trace_file::first_of_last(int n_times) const
+{
+    if (n_times <= 0 || n_changes == 0)
+        return 0;
+    int i = n_changes - 1;
+    double t = ring[ring_index(i)].time;
+    for ( ; i > 0; i--) {
+        double previous = ring[ring_index(i - 1)].time;
+        if (previous != t) {
+            if (--n_times == 0)
+                break;
+            t = previous;
+        }
+    }
+    return i;
+}
+
+void mem_trace_file::dump(FILE* f, int n_times) const
+{
+    bool first = true;
+    double t = 0;
+    for (sc_mem_trace_iter it(this, n_times); !it.empty(); it++) {
+        const sc_mem_trace_change& c = it.get();
+        if (first || c.time != t) {
+            fprintf(f, "@%.16g\n", c.time);
+            t = c.time;
+            first = false;
+        }
+        fprintf(f, "    %s %s\n", c.name, c.value);
+    }
+    if (n_dropped > 0)
+        fprintf(f, "(%d older changes dropped)\n", n_dropped);
+}
+
+void mem_trace_file::initialize()
+{
+    // Room for at least two values of each trace
+    int max_length = 0;
+    int i;
+    for (i = 0; i < traces.size(); i++) {
+        mem_trace* t = traces[i];
+        t->set_width(); // needed for all vectors
+        if (t->value_length() > max_length)
+            max_length = t->value_length();
+    }
+    if (value_bytes < 2 * (max_length + 1)) {
+        delete[] values;
+        value_bytes = 2 * (max_length + 1);
+        values = new char[value_bytes];
+        clear();
+    }
+
+    init_change_detection(traces.size());
+
+    // All initial values
+    double now = sc_simulation_time();
+    for (i = 0; i < traces.size(); i++)
+        record(i, now);
+}
+
+void mem_trace_file::cycle(bool this_is_a_delta_cycle)
+{
+    // Trace delta cycles only when enabled
+    if (!trace_delta_cycles && this_is_a_delta_cycle) return;
+
+    // Check for initialization
+    if (!initialized) {
+        initialize();
+        initialized = true;
+        return;
+    };
+
+    double now = sc_simulation_time();
+    mem_trace* const* const l_traces = traces.raw_data();
+    const int* const l_candidates = candidates();
+    const int n_candidates = num_candidates();
+    for (int k = 0; k < n_candidates; k++) {
+        const int i = l_candidates[k];
+        if (l_traces[i]->changed())
+            record(i, now);
+    }
+    // Traces just enabled again
+    const int* const l_forced = forced();
+    const int n_forced = num_forced();
+    for (int k = 0; k < n_forced; k++)
+        record(l_forced[k], now);
+    clear_dirty();
+}
+
+
+sc_trace_file *sc_create_mem_trace_file(int max_changes, int value_bytes)
+{
+    sc_trace_file *tf;
+
+    tf = new mem_trace_file(max_changes, value_bytes);
+    sc_get_curr_simcontext()->add_trace_file(tf);
+    return tf;
+}
+
+void sc_close_mem_trace_file( sc_trace_file* tf )
+{
+    mem_trace_file* mem_tf = (mem_trace_file*)tf;
+    delete mem_tf;
+}
@@ -0,0 +1,303 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_mem_trace.h -- Tracing into a bounded in-memory ring of value
+                      changes.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+/********************************************************************
+
+  A memory trace file writes nothing to disk.  The value changes of
+  the traced objects are kept in memory, for checkers that consume
+  them while the simulation runs, and for dumping the recent history
+  of the traced objects when a check fails.
+
+  Memory is bounded: only the last max_changes changes are kept, and
+  their values share a circular buffer of value_bytes characters.
+  The oldest changes are dropped to make room for new ones.
+
+  Values are kept as text, most significant bit first: '0' and '1'
+  for bits, 'x' and 'z' for sc_logic values (mapped as for VCD), and
+  "%.16g" for reals.  Integers that do not fit into their width are
+  all 'x'.  Enumerated objects show their literals.
+
+  Callbacks added with add_callback() are called for each change as
+  it is recorded; sc_mem_trace_iter goes through the changes kept,
+  oldest first.  Which objects are recorded is controlled with
+  enable() and disable(), as for the other trace files.
+
+********************************************************************/
+
+#ifndef SC_MEM_TRACE_H
+#define SC_MEM_TRACE_H
+
+#include <stdio.h>
+#include "sc_trace.h"
+#include "sc_vector.h"
+
+class mem_trace;  // defined in sc_mem_trace.cpp
+class sc_mem_trace_iter;
+
+// A value change, valid until it is dropped from the ring
+struct sc_mem_trace_change {
+    double time;                // sc_simulation_time() of the cycle
+    int trace;                  // index of the trace
+    const char* name;           // name of the trace
+    const char* value;          // null-terminated
+    int length;                 // strlen(value)
+};
+
+typedef void (*sc_mem_trace_callback)(const sc_mem_trace_change& change, void* arg);
+
+
+class mem_trace_file : public sc_trace_file {
+    friend class sc_mem_trace_iter;
+
+public:
+    enum { default_max_changes = 1 << 16,
+           default_value_bytes = 1 << 20 };
+
+    // Create a memory trace file keeping at most max_changes
+    // changes, whose values take at most value_bytes characters.
+    // The value buffer is enlarged at initialization to hold at least
+    // two values of the widest trace.
+    mem_trace_file(int max_changes = default_max_changes,
+                   int value_bytes = default_value_bytes);
+
+    ~mem_trace_file();
+
+    // fn(change, arg) is called for each change as it is recorded,
+    // in the order in which callbacks were added.
+    void add_callback(sc_mem_trace_callback fn, void* arg);
+    void remove_callback(sc_mem_trace_callback fn, void* arg);
+
+    // Number of changes kept, and number of changes dropped so far
+    // to make room for new ones
+    int num_changes() const { return n_changes; }
+    int num_dropped() const { return n_dropped; }
+
+    // Drops all the changes kept
+    void clear();
+
+    // Prints the changes of the last n_times distinct times to f;
+    // all the changes kept if n_times is 0.
+    void dump(FILE* f, int n_times = 0) const;
+
+    // Number of traces, for dirty-list change detection
+    int num_traces() const;
+
+    // Name of trace i, for enable() and disable()
+    const char* trace_name(int i) const;
+
+protected:
+    // These are all virtual functions in sc_trace_file and
+    // they need to be defined here.
+
+    // Trace a boolean object (single bit)
+     void trace(const bool& object, const sc_string& name);
+
+    // Trace a sc_logic object (single bit)
+     void trace(const sc_logic& object, const sc_string& name);
+
+    // Trace a sc_bool_vector
+     void trace(const sc_bool_vector& object, const sc_string& name);
+
+    // Trace a sc_logic_vector
+     void trace(const sc_logic_vector& object, const sc_string& name);
+
+    // Trace an unsigned char with the given width
+     void trace(const unsigned char& object, const sc_string& name, int width);
+
+    // Trace an unsigned short with the given width
+     void trace(const unsigned short& object, const sc_string& name, int width);
+
+    // Trace an unsigned int with the given width
+     void trace(const unsigned int& object, const sc_string& name, int width);
+
+    // Trace an unsigned long with the given width
+     void trace(const unsigned long& object, const sc_string& name, int width);
+
+    // Trace a signed char with the given width
+     void trace(const char& object, const sc_string& name, int width);
+
+    // Trace a signed short with the given width
+     void trace(const short& object, const sc_string& name, int width);
+
+    // Trace a signed int with the given width
+     void trace(const int& object, const sc_string& name, int width);
+
+    // Trace a signed long with the given width
+     void trace(const long& object, const sc_string& name, int width);
+
+    // Trace a float
+     void trace(const float& object, const sc_string& name);
+
+    // Trace a double
+     void trace(const double& object, const sc_string& name);
+
+    // Trace sc_signal<sc_bool_vector>
+     void trace(const sc_signal_bool_vector& object, const sc_string& name);
+
+    // Trace sc_signal<sc_logic_vector>
+     void trace(const sc_signal_logic_vector& object, const sc_string& name);
+
+    // Trace sc_uint_base
+     void trace (const sc_uint_base& object, const sc_string& name);
+
+    // Trace sc_int_base
+     void trace (const sc_int_base& object, const sc_string& name);
+
+    // Trace sc_unsigned
+     void trace (const sc_unsigned& object, const sc_string& name);
+
+    // Trace sc_signed
+     void trace (const sc_signed& object, const sc_string& name);
+
+#ifdef SC_INCLUDE_FX
+    // Trace sc_fxval
+    void trace( const sc_fxval& object, const sc_string& name );
+
+    // Trace sc_fxval_fast
+    void trace( const sc_fxval_fast& object, const sc_string& name );
+
+    // Trace sc_fxnum
+    void trace( const sc_fxnum& object, const sc_string& name );
+
+    // Trace sc_fxnum_fast
+    void trace( const sc_fxnum_fast& object, const sc_string& name );
+#endif
+
+    // Trace resolved signal
+     void trace (const sc_signal_resolved& object, const sc_string& name);
+
+    // Trace resolved signal vector
+     void trace (const sc_signal_resolved_vector& object, const sc_string& name);
+
+    // Trace an enumerated object; its literals are recorded.
+     void trace(const unsigned& object, const sc_string& name, const char** enum_literals);
+
+    // Comments are not stored
+     void write_comment(const sc_string& comment);
+
+    // Also trace transitions between delta cycles if flag is true.
+     void delta_cycles(bool flag);
+
+    // Record the changes of the cycle.
+     void cycle(bool delta_cycle);
+
+private:
+    struct callback_entry {
+        sc_mem_trace_callback fn;
+        void* arg;
+    };
+
+    // Initialize the tracing
+    void initialize();
+    // Add a trace, if tracing has not begun
+    void add_trace(mem_trace* t);
+    // Record the current value of trace i
+    void record(int i, double now);
+    // Space for a value of n characters, including the null; drops
+    // the changes whose values are in the way
+    char* reserve_value(int n);
+    void drop_oldest();
+    // Index in the ring of the i-th change kept, oldest first
+    int ring_index(int i) const
+    {
+        int k = first_change + i;
+        return (k < max_changes) ? k : k - max_changes;
+    }
+    // Index, oldest first, of the first change of the last n_times
+    // distinct times
+    int first_of_last(int n_times) const;
+
+    // Array to store the variables traced
+    sc_pvector<mem_trace*> traces;
+
+    sc_mem_trace_change* ring;  // max_changes changes
+    int max_changes;
+    int first_change;           // oldest change in the ring
+    int n_changes;
+    int n_dropped;
+
+    char* values;               // circular buffer of value_bytes
+    int value_bytes;
+    int value_head;             // where the next value goes
+
+    callback_entry* callbacks;
+    int n_callbacks;
+    int n_alloc_callbacks;
+
+    bool trace_delta_cycles;    // = 1 means trace the delta cycles
+    bool initialized;           // = 1 means initialized
+};
+
+//
+// Iterates over the changes kept by a memory trace file, oldest
+// first.  No changes may be recorded while it is in use; in
+// particular, it may be used by callbacks, but not kept from one
+// cycle to the next.
+//
+
+class sc_mem_trace_iter {
+public:
+    // Starts at the first change of the last n_times distinct times;
+    // at the oldest change kept if n_times is 0.
+    sc_mem_trace_iter( const mem_trace_file* tf, int n_times = 0 ) { reset(tf, n_times); }
+    sc_mem_trace_iter( const mem_trace_file& tf, int n_times = 0 ) { reset(&tf, n_times); }
+    ~sc_mem_trace_iter() { }
+
+    void reset( const mem_trace_file* tf, int n_times = 0 )
+    {
+        file = tf;
+        index = tf->first_of_last(n_times);
+    }
+    void reset( const mem_trace_file& tf, int n_times = 0 ) { reset(&tf, n_times); }
+
+    bool empty() const { return (index >= file->n_changes); }
+    void step() { ++index; }
+    void operator++(int) { step(); }
+
+    const sc_mem_trace_change& get() const
+    {
+        return file->ring[file->ring_index(index)];
+    }
+    const sc_mem_trace_change* operator->() const { return &get(); }
+
+private:
+    const mem_trace_file* file;
+    int                   index;
+};
+
+// Create memory trace file
+extern sc_trace_file *sc_create_mem_trace_file(int max_changes = mem_trace_file::default_max_changes,
+                                               int value_bytes = mem_trace_file::default_value_bytes);
+extern void sc_close_mem_trace_file( sc_trace_file* tf );
+
+#endif
@@ -33,18 +33,28 @@
 ******************************************************************************/
 
 
+
 //  <sc_mempool> is a class that manages the memory for small objects,
-//  of sizes <increment>, 2 * <increment>, ..., <num_pools> *
-//  <increment>.  When a memory request of <k> bytes is made through
-//  the memory pool, the smallest pool <j> such that <j> * <increment>
-//  >= <k> is used.  The default values of <increment> and <num_pools>
-//  are 8 and 8, respectively.  Each pool has an allocator, that
-//  simply keeps a free list of cells, and allocate new blocks
-//  whenever necessary.  We are relying on malloc() to return a
-//  properly aligned memory blocks.  Note that the memory blocks
-//  allocated by the mempool are never freed.  Thus, if purify is
-//  used, we may get MIU (memory-in-use) warnings.  To disable this,
-//  set the environment variable SYSTEMC_MEMPOOL_DONT_USE to 1.
+//  of sizes up to <max_size> bytes, in the size classes listed in
+//  <cell_sizes>.  When a memory request of <k> bytes is made through
+//  the memory pool, the smallest class that holds <k> bytes is used.
+//  Each class has an allocator, that simply keeps a free list of
+//  cells, and allocate new blocks whenever necessary.  We are relying
+//  on malloc() to return a properly aligned memory blocks.
+//
+//  Each thread keeps a small cache of cells (a "magazine") per size
+//  class, so that most requests are served without taking the lock
+//  that protects the shared allocators.  A magazine is refilled from,
+//  or drained back into, its allocator half a magazine at a time.
+//  When a thread exits, its magazines are drained and its cache is
+//  freed.
+//
+//  The memory blocks allocated by the mempool are freed only by
+//  sc_mempool::reset(), which must be called only when no object
+//  allocated through the pool is alive anymore (typically at the end
+//  of a simulation run).  Thus, if purify is used, we may get MIU
+//  (memory-in-use) warnings.  To disable the pool, set the
+//  environment variable SYSTEMC_MEMPOOL_DONT_USE to 1.
 
 
 static const char* dont_use_envstring = "SYSTEMC_MEMPOOL_DONT_USE";
@@ -53,8 +63,70 @@ static bool use_default_new = false;
 
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef WIN32
+#include "sc_cmnhdr.h"
+#include <Windows.h>
+#endif
 #include "sc_mempool.h"
 
+#if defined(_MSC_VER)
+#define SC_MEMPOOL_TLS __declspec(thread)
+#else
+#define SC_MEMPOOL_TLS __thread
+#include <pthread.h>
+#endif
+
+
+//  A spin lock protecting the shared allocators.  It is held only
+//  while a magazine is refilled or drained, so contention is low.  It
+//  needs no initialization, which matters since the pool may be used
+//  by constructors of global objects.
+
+class sc_mempool_lock {
+public:
+    static void acquire()
+    {
+#ifdef WIN32
+        while (InterlockedExchange(&locked, 1) != 0)
+            Sleep(0);
+#else
+        while (__sync_lock_test_and_set(&locked, 1) != 0)
+            ;
+#endif
+    }
+    static void release()
+    {
+#ifdef WIN32
+        InterlockedExchange(&locked, 0);
+#else
+        __sync_lock_release(&locked);
+#endif
+    }
+
+private:
+#ifdef WIN32
+    static volatile LONG locked;
+#else
+    static volatile int locked;
+#endif
+};
+
+#ifdef WIN32
+volatile LONG sc_mempool_lock::locked = 0;
+#else
+volatile int sc_mempool_lock::locked = 0;
+#endif
+
+
+//  A magazine is a per-thread stack of free cells of one size class.
+
+const int SC_MAGAZINE_SIZE = 32;
+
+struct sc_magazine {
+    int   count;
+    void* cells[SC_MAGAZINE_SIZE];
+};
+
 
 //  An allocator is one that handles a particular size.  It keeps a
 //  <free_list> from which a cell may be allocated quickly if there
@@ -66,18 +138,24 @@ static bool use_default_new = false;
 //  the current block, then it's reset to 0.  On the other hand,
 //  if <next_avail> was 0 when a request to the block is made, then
 //  a new block is allocated by calling system malloc(), and the new
-//  block becomes the head of <block_list>.
+//  block becomes the head of <block_list>.  The allocator is only
+//  accessed with the sc_mempool_lock held.
 
 
 class sc_allocator {
     friend class sc_mempool;
+    friend class sc_mempool_int;
 
 public:
     sc_allocator( int blksz, int cellsz );
     ~sc_allocator();
     void* allocate();
     void release(void* p);
-    
+
+    void refill(sc_magazine* mag, int n);
+    void drain(sc_magazine* mag, int n);
+    void reset();
+
     void display_statistics();
 
 private:
@@ -94,9 +172,12 @@ private:
     link* free_list;
     char* next_avail;
 
-    int total_alloc;
-    int total_freed;
-    int free_list_alloc;
+    int total_alloc;           // cells handed out to magazines
+    int free_list_alloc;       // ... of which came from the free list
+
+    int requests;              // counts of the thread caches, added
+    int mag_hits;              // in while the lock is held
+    int freed;
 };
 
 sc_allocator::sc_allocator( int blksz, int cellsz )
@@ -108,8 +189,11 @@ sc_allocator::sc_allocator( int blksz, int cellsz )
     next_avail = 0;
 
     total_alloc = 0;
-    total_freed = 0;
     free_list_alloc = 0;
+
+    requests = 0;
+    mag_hits = 0;
+    freed = 0;
 }
 
 sc_allocator::~sc_allocator()
@@ -153,55 +237,112 @@ sc_allocator::allocate()
 void
 sc_allocator::release(void* p)
 {
-    total_freed++;
     ((link*) p)->next = free_list;
     free_list = (link*) p;
 }
 
+/* Moves n cells into the magazine, which is assumed to be empty. */
+void
+sc_allocator::refill(sc_magazine* mag, int n)
+{
+    for (int i = 0; i < n; ++i)
+        mag->cells[i] = allocate();
+    mag->count = n;
+}
+
+/* Moves the n topmost cells of the magazine back to the free list. */
+void
+sc_allocator::drain(sc_magazine* mag, int n)
+{
+    while (n-- > 0)
+        release(mag->cells[--mag->count]);
+}
+
+/* Returns all blocks to the system. */
+void
+sc_allocator::reset()
+{
+    link* b = (link*) block_list;
+    while (b != 0) {
+        link* next = b->next;
+        free(b);
+        b = next;
+    }
+    block_list = 0;
+    free_list = 0;
+    next_avail = 0;
+}
+
 void
 sc_allocator::display_statistics()
 {
     int nblocks = 0;
     for (link* b = (link*) block_list; b != 0; b = b->next)
         nblocks++;
-    printf("size %3d: %2d block(s), %3d requests (%3d from free list), %3d freed.\n",
-           cell_size, nblocks, total_alloc, free_list_alloc, total_freed);
+
+    /* A request hits if it's served from the thread's magazine,
+       i.e., without taking the lock. */
+    double hit_rate = requests ? (100.0 * mag_hits) / requests : 0.0;
+
+    /* Fragmentation is the part of the reserved blocks not occupied
+       by live cells. */
+    double reserved = (double) nblocks * (block_size - sizeof(link));
+    double live = (double) (requests - freed) * cell_size;
+    double frag = reserved > 0.0 ? 100.0 * (1.0 - live / reserved) : 0.0;
+
+    printf("size %3d: %2d block(s), %3d requests (%3d from magazine), "
+           "%3d cells to magazines (%3d from free list), %3d freed, "
+           "hit rate %5.1f%%, fragmentation %5.1f%%.\n",
+           cell_size, nblocks, requests, mag_hits, total_alloc,
+           free_list_alloc, freed, hit_rate, frag);
 }
 
 
 static const int cell_sizes[] = {
-/* 0 */   0,
-/* 1 */   8,
-/* 2 */  16,
-/* 3 */  24,
-/* 4 */  32,
-/* 5 */  48,
-/* 6 */  64,
-/* 7 */  80,
-/* 8 */  96,
-/* 9 */ 128
+/*  0 */   0,
+/*  1 */   8,
+/*  2 */  16,
+/*  3 */  24,
+/*  4 */  32,
+/*  5 */  48,
+/*  6 */  64,
+/*  7 */  80,
+/*  8 */  96,
+/*  9 */ 128,
+/* 10 */ 160,
+/* 11 */ 192,
+/* 12 */ 256,
+/* 13 */ 320,
+/* 14 */ 384,
+/* 15 */ 512
 };
 
-static const int cell_size_to_allocator[] = {
-/*  0 */    0,
-/*  1 */    1,
-/*  2 */    2,
-/*  3 */    3,
-/*  4 */    4,
-/*  5 */    5,
-/*  6 */    5,
-/*  7 */    6,
-/*  8 */    6,
-/*  9 */    7,
-/* 10 */    7,
-/* 11 */    8,
-/* 12 */    8,
-/* 13 */    9,
-/* 14 */    9,
-/* 15 */    9,
-/* 16 */    9
+const int SC_MEMPOOL_NUM_POOLS = sizeof(cell_sizes)/sizeof(cell_sizes[0]) - 1;
+
+
+//  The per-thread part of the pool.  A cache whose <epoch> is older
+//  than the pool's has been invalidated by sc_mempool::reset() and is
+//  emptied on its next use.  Its counts are only written by its
+//  thread, and are added to those of the allocators whenever the
+//  thread holds the lock, so statistics see the counts of the other
+//  threads up to their last refill or drain.
+
+struct sc_thread_cache {
+    unsigned epoch;
+    sc_magazine mags[SC_MEMPOOL_NUM_POOLS + 1];
+
+    int requests[SC_MEMPOOL_NUM_POOLS + 1];
+    int mag_hits[SC_MEMPOOL_NUM_POOLS + 1];
+    int freed[SC_MEMPOOL_NUM_POOLS + 1];
 };
 
+static SC_MEMPOOL_TLS sc_thread_cache* this_thread_cache = 0;
+
+//  True once the cache of this thread has been released at its exit.
+//  Later requests of the thread, e.g. from destructors that run after
+//  that, go to the allocators under the lock.
+static SC_MEMPOOL_TLS bool this_thread_cache_released = false;
+
 
 class sc_mempool_int {
     friend class sc_mempool;
@@ -211,14 +352,28 @@ public:
     ~sc_mempool_int();
     void* do_allocate(size_t);
     void  do_release(void*, size_t);
+    void  do_reset();
 
     void display_statistics();
-    
+
+    void release_thread_cache();
+
 private:
+    sc_thread_cache* get_thread_cache();
+    void add_counts(sc_thread_cache* tc, int i);
+    int which_allocator(size_t sz) const
+    {
+        return size_to_allocator[(sz - 1) / increment + 1];
+    }
+
     sc_allocator** allocators;
+    int* size_to_allocator;
     int num_pools;
     int increment;
     int max_size;
+
+    int num_thread_caches;
+    volatile unsigned epoch;
 };
 
 
@@ -232,14 +387,32 @@ compute_use_default_new()
 sc_mempool_int::sc_mempool_int(int blksz, int npools, int incr)
 {
     use_default_new = compute_use_default_new();
+    num_thread_caches = 0;
+    epoch = 0;
     if (! use_default_new) {
         num_pools = npools;
         increment = incr;
-        max_size = cell_sizes[sizeof(cell_sizes)/sizeof(cell_sizes[0]) - 1];
+        max_size = cell_sizes[npools];
         allocators = new sc_allocator*[npools + 1];
-        for (int i = 1; i <= npools; ++i)
-            allocators[i] = new sc_allocator(blksz, cell_sizes[i]);
+        for (int i = 1; i <= npools; ++i) {
+            /* Make sure that a block holds a reasonable number of
+               cells of the larger sizes too */
+            int bs = (blksz > 8 * cell_sizes[i]) ? blksz : 8 * cell_sizes[i];
+            allocators[i] = new sc_allocator(bs, cell_sizes[i]);
+        }
         allocators[0] = allocators[1];
+
+        /* Map each multiple of <increment> to the smallest size class
+           that holds it */
+        int nsizes = max_size / increment + 1;
+        size_to_allocator = new int[nsizes];
+        size_to_allocator[0] = 0;
+        int j = 1;
+        for (int k = 1; k < nsizes; ++k) {
+            while (cell_sizes[j] < k * increment)
+                ++j;
+            size_to_allocator[k] = j;
+        }
     }
 }
 
@@ -248,31 +421,207 @@ sc_mempool_int::~sc_mempool_int()
     for (int i = 1; i <= num_pools; ++i)
         delete allocators[i];
     delete[] allocators;
+    delete[] size_to_allocator;
 }
 
-static sc_mempool_int* the_mempool = 0;
+//  The pool is created on first use, and read without the lock after
+//  that.  It is written with release and read with acquire semantics,
+//  so that a thread that sees the pool sees it constructed.
+
+static sc_mempool_int* volatile the_mempool = 0;
+
+static sc_mempool_int*
+get_mempool()
+{
+#if defined(_MSC_VER)
+    // Volatile reads have acquire semantics with MSVC on x86.
+    return the_mempool;
+#else
+    return __atomic_load_n(&the_mempool, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static void
+set_mempool(sc_mempool_int* pool)
+{
+#if defined(_MSC_VER)
+    the_mempool = pool;
+#else
+    __atomic_store_n(&the_mempool, pool, __ATOMIC_RELEASE);
+#endif
+}
+
+
+//  The cache of a thread is released when the thread exits: with
+//  MSVC, by the destructor of a thread_local object, and elsewhere by
+//  the destructor of a pthread key.  Neither runs when a fiber is
+//  deleted, so processes that run as fibers of one thread share its
+//  cache.
+
+static void
+release_this_thread_cache(void*)
+{
+    get_mempool()->release_thread_cache();
+}
+
+#if defined(_MSC_VER)
+
+struct sc_thread_cache_guard {
+    bool armed;
+    ~sc_thread_cache_guard() { if (armed) release_this_thread_cache(0); }
+};
+
+static thread_local sc_thread_cache_guard thread_cache_guard;
+
+#else
+
+static pthread_key_t thread_cache_key;
+static pthread_once_t thread_cache_key_once = PTHREAD_ONCE_INIT;
+
+static void
+make_thread_cache_key()
+{
+    pthread_key_create(&thread_cache_key, release_this_thread_cache);
+}
+
+#endif
+
+/* Returns the cache of this thread, or 0 if it has been released. */
+sc_thread_cache*
+sc_mempool_int::get_thread_cache()
+{
+    sc_thread_cache* tc = this_thread_cache;
+    if (tc == 0) {
+        if (this_thread_cache_released)
+            return 0;
+        tc = (sc_thread_cache*) calloc(1, sizeof(sc_thread_cache));
+        tc->epoch = epoch;
+        sc_mempool_lock::acquire();
+        num_thread_caches++;
+        sc_mempool_lock::release();
+        this_thread_cache = tc;
+#if defined(_MSC_VER)
+        thread_cache_guard.armed = true;
+#else
+        pthread_once(&thread_cache_key_once, make_thread_cache_key);
+        pthread_setspecific(thread_cache_key, tc);
+#endif
+    }
+    else if (tc->epoch != epoch) {
+        /* The cells in the magazines have been returned to the system */
+        for (int i = 0; i <= num_pools; ++i)
+            tc->mags[i].count = 0;
+        tc->epoch = epoch;
+    }
+    return tc;
+}
+
+/* Adds the counts of size class i of the cache to those of the
+   allocator.  The lock must be held. */
+void
+sc_mempool_int::add_counts(sc_thread_cache* tc, int i)
+{
+    allocators[i]->requests += tc->requests[i];
+    allocators[i]->mag_hits += tc->mag_hits[i];
+    allocators[i]->freed    += tc->freed[i];
+    tc->requests[i] = 0;
+    tc->mag_hits[i] = 0;
+    tc->freed[i] = 0;
+}
 
 void*
 sc_mempool_int::do_allocate(size_t sz)
 {
-    int which_allocator = cell_size_to_allocator[(sz - 1) / increment + 1];
-    void* p = allocators[which_allocator]->allocate();
-    return p;
+    int which = which_allocator(sz);
+    sc_thread_cache* tc = get_thread_cache();
+    void* result;
+    if (tc == 0) {
+        sc_mempool_lock::acquire();
+        allocators[which]->requests++;
+        result = allocators[which]->allocate();
+        sc_mempool_lock::release();
+        return result;
+    }
+    sc_magazine* mag = &tc->mags[which];
+    tc->requests[which]++;
+    if (mag->count > 0) {
+        tc->mag_hits[which]++;
+        return mag->cells[--mag->count];
+    }
+    sc_mempool_lock::acquire();
+    allocators[which]->refill(mag, SC_MAGAZINE_SIZE / 2);
+    add_counts(tc, which);
+    sc_mempool_lock::release();
+    return mag->cells[--mag->count];
 }
 
 void
 sc_mempool_int::do_release(void* p, size_t sz)
 {
-    int which_allocator = cell_size_to_allocator[(sz - 1) / increment + 1];
-    allocators[which_allocator]->release(p);
+    int which = which_allocator(sz);
+    sc_thread_cache* tc = get_thread_cache();
+    if (tc == 0) {
+        sc_mempool_lock::acquire();
+        allocators[which]->freed++;
+        allocators[which]->release(p);
+        sc_mempool_lock::release();
+        return;
+    }
+    sc_magazine* mag = &tc->mags[which];
+    tc->freed[which]++;
+    if (mag->count == SC_MAGAZINE_SIZE) {
+        sc_mempool_lock::acquire();
+        allocators[which]->drain(mag, SC_MAGAZINE_SIZE / 2);
+        add_counts(tc, which);
+        sc_mempool_lock::release();
+    }
+    mag->cells[mag->count++] = p;
+}
+
+/* Drains the magazines of this thread, unless sc_mempool::reset() has
+   returned their cells to the system, and frees its cache. */
+void
+sc_mempool_int::release_thread_cache()
+{
+    sc_thread_cache* tc = this_thread_cache;
+    if (tc == 0)
+        return;
+    sc_mempool_lock::acquire();
+    for (int i = 1; i <= num_pools; ++i) {
+        if (tc->epoch == epoch)
+            allocators[i]->drain(&tc->mags[i], tc->mags[i].count);
+        add_counts(tc, i);
+    }
+    num_thread_caches--;
+    sc_mempool_lock::release();
+    free(tc);
+    this_thread_cache = 0;
+    this_thread_cache_released = true;
+}
+
+void
+sc_mempool_int::do_reset()
+{
+    sc_mempool_lock::acquire();
+    for (int i = 1; i <= num_pools; ++i)
+        allocators[i]->reset();
+    ++epoch;
+    sc_mempool_lock::release();
 }
 
 void
 sc_mempool_int::display_statistics()
 {
     printf("*** Memory Pool Statistics ***\n");
-    for (int i = 1; i <= num_pools; ++i)
+    sc_thread_cache* tc = this_thread_cache;
+    sc_mempool_lock::acquire();
+    printf("%d thread cache(s), %d-cell magazines.\n", num_thread_caches, SC_MAGAZINE_SIZE);
+    for (int i = 1; i <= num_pools; ++i) {
+        if (tc != 0)
+            add_counts(tc, i);
         allocators[i]->display_statistics();
+    }
+    sc_mempool_lock::release();
 }
 
 /****************************************************************************/
@@ -280,23 +629,28 @@ sc_mempool_int::display_statistics()
 void*
 sc_mempool::allocate(size_t sz)
 {
-    if (use_default_new)
-        return ::operator new(sz);
-
-    if (the_mempool == 0) {
-        use_default_new = compute_use_default_new();
-        if (use_default_new)
+    sc_mempool_int* pool = get_mempool();
+
+    if (pool == 0) {
+        sc_mempool_lock::acquire();
+        if ((the_mempool == 0) && ! use_default_new) {
+            use_default_new = compute_use_default_new();
+            if (! use_default_new) {
+                // Note that the_mempool is never freed.  This is going to
+                // cause memory leaks when the program exits.
+                set_mempool(new sc_mempool_int( 1984, SC_MEMPOOL_NUM_POOLS, 8 ));
+            }
+        }
+        pool = the_mempool;
+        sc_mempool_lock::release();
+        if (pool == 0)
             return ::operator new(sz);
-
-        // Note that the_mempool is never freed.  This is going to cause
-        // memory leaks when the program exits.
-        the_mempool = new sc_mempool_int( 1984, sizeof(cell_sizes)/sizeof(cell_sizes[0]) - 1, 8 );
     }
 
-    if (sz > (unsigned) the_mempool->max_size)
+    if (sz > (unsigned) pool->max_size)
         return ::operator new(sz);
 
-    return the_mempool->do_allocate(sz);
+    return pool->do_allocate(sz);
 }
 
 void
@@ -304,20 +658,31 @@ sc_mempool::release(void* p, size_t sz)
 {
     if (p) {
         
-        if (use_default_new || sz > (unsigned) the_mempool->max_size) {
+        sc_mempool_int* pool = get_mempool();
+
+        if (pool == 0 || sz > (unsigned) pool->max_size) {
             ::operator delete(p);
             return;
         }
 
-        the_mempool->do_release(p, sz);
+        pool->do_release(p, sz);
     }
 }
 
+void
+sc_mempool::reset()
+{
+    sc_mempool_int* pool = get_mempool();
+    if (pool)
+        pool->do_reset();
+}
+
 void
 sc_mempool::display_statistics()
 {
-    if (the_mempool && !use_default_new) {
-        the_mempool->display_statistics();
+    sc_mempool_int* pool = get_mempool();
+    if (pool) {
+        pool->display_statistics();
     } else {
         printf("SystemC info: no memory allocation was done through the memory pool.\n");
     }
@@ -45,6 +45,12 @@ class sc_mempool {
 public:
     static void* allocate(size_t sz);
     static void release(void* p, size_t sz);
+
+    // Returns all memory held by the pool to the system.  Must only be
+    // called when no object allocated through the pool is alive, e.g.,
+    // at the end of a simulation run.
+    static void reset();
+
     static void display_statistics();
 };
 
@@ -93,8 +93,20 @@ bool sc_enable_name_checking = true;
 const char*
 sc_object::basename() const
 {
-    const char* p = strrchr( m_name, HIERARCHY_CHAR );
-    return p ? (p + 1) : m_name;
+    /* The interned name is gone with the object manager */
+    if (simc == 0) {
+        const char* p = strrchr( m_name, HIERARCHY_CHAR );
+        return p ? (p + 1) : m_name;
+    }
+    return m_node->leaf;
+}
+
+const char*
+sc_object::build_name() const
+{
+    m_name = new char[m_node->length + 1];
+    m_node->copy_path(m_name);
+    return m_name;
 }
 
 void
@@ -160,34 +172,20 @@ sc_object::sc_object_init(const char* nm)
         put_in_table = false;
     }
 
-    /* Note here we pull a little trick -- use the
-       first byte to store information about whether
-       to put the object in the object table in the
-       object manager */
-    if (parent) {
-        int pn_len = strlen(parent->name());
-        m_name = new char[pn_len + strlen(newname) + 3];
-        m_name++;
-        strcpy(m_name, parent->name());
-        m_name[pn_len] = HIERARCHY_CHAR;
-        m_name[pn_len + 1] = '\0';
-    }
-    else {
-        m_name = new char[strlen(newname) + 3];
-        m_name++;
-        m_name[0] = '\0';
-    }
-    m_name[-1] = put_in_table;
-    strcat(m_name, newname);
+    m_node = object_manager->make_name(parent ? parent->m_node : 0, newname,
+                                       put_in_table);
+    m_name = 0;
+    m_in_table = false;
+    object_manager->link_object(this);
 
     if (put_in_table) {
-        if (object_manager->find_object(m_name)) {
-            cerr << "SystemC error: Object `" << m_name << "' already exists." << endl;
+        if (object_manager->find_object(m_node)) {
+            cerr << "SystemC error: Object `" << name() << "' already exists." << endl;
             cerr << "              (Latter declaration will be ignored.)" << endl;
         }
         else {
-            /* should check for the uniqueness of the name */
-            object_manager->insert_object(m_name, this);
+            object_manager->insert_object(m_node, this);
+            m_in_table = true;
         }
     }
 }
@@ -239,11 +237,13 @@ sc_object::sc_object(const char* nm)
 
 sc_object::~sc_object()
 {
-    if (m_name[-1] && simc) {
+    if (simc) {
         sc_object_manager* object_manager = simc->get_object_manager();
-        object_manager->remove_object(m_name);
+        if (m_in_table)
+            object_manager->remove_object(m_node);
+        object_manager->unlink_object(this);
+        object_manager->release_name(m_node);
     }
-    --m_name;
     delete[] m_name;
 }
 
@@ -55,12 +55,14 @@ using std::hex;
 
 class sc_trace_file;
 class sc_simcontext;
+struct sc_name_node;
 
 class sc_object {
     friend class sc_object_manager;
 
 public:
-    const char* name() const { return m_name; }
+    /* The full hierarchical name is built on the first call */
+    const char* name() const { return m_name ? m_name : build_name(); }
     const char* basename() const;
 
     void print() const;
@@ -84,11 +86,18 @@ protected:
 
 private:
     void sc_object_init(const char* nm);
+    const char* build_name() const;
 
 private:
     /* Each simulation object is associated with a simulation context */ 
     sc_simcontext* simc;   
-    char* m_name;
+    /* The name, as interned by the object manager */
+    const sc_name_node* m_node;
+    mutable char* m_name;
+    bool m_in_table;
+    /* Links of the object manager's list of all objects */
+    sc_object* m_prev_object;
+    sc_object* m_next_object;
 };
 
 const char HIERARCHY_CHAR = '.';
@@ -59,41 +59,236 @@ using std::hex;
 #include "sc_object_manager.h"
 #include "sc_module_name.h"
 
-int strcmp_void(const void* a, const void* b)
+/* Size of a block of the string arena */
+const int SC_NAME_ARENA_BLOCK_SIZE = 4096;
+
+/* Room for an unshared leaf after its node; enough for any name
+   sc_object makes up, "{-2147483648}" included */
+const int SC_NAME_NODE_LEAF_SIZE = 16;
+
+void
+sc_name_node::copy_path( char* buf ) const
+{
+    int pos = length;
+    buf[pos] = '\0';
+    for (const sc_name_node* n = this; n != 0; n = n->parent) {
+        pos -= n->leaf_length;
+        memcpy(buf + pos, n->leaf, n->leaf_length);
+        if (n->parent)
+            buf[--pos] = HIERARCHY_CHAR;
+    }
+}
+
+/* Steps a cursor backwards through the full path of a node, one
+   character at a time; returns -1 at the beginning of the path. */
+static inline int
+name_node_prev_char( const sc_name_node*& n, int& pos )
 {
-  return strcmp(static_cast<const char*>(a),static_cast<const char*>(b));
+    if (pos > 0)
+        return n->leaf[--pos];
+    if (n->parent == 0)
+        return -1;
+    n = n->parent;
+    pos = n->leaf_length;
+    return HIERARCHY_CHAR;
+}
+
+bool
+sc_name_node_hash_traits::equal( const sc_name_node* a, const sc_name_node* b )
+{
+    if (a->length != b->length)
+        return false;
+
+    /* Fast path: both paths are split into the same shared leaves */
+    const sc_name_node* x = a;
+    const sc_name_node* y = b;
+    while (x->leaf == y->leaf && x->leaf_length == y->leaf_length) {
+        x = x->parent;
+        y = y->parent;
+        if (x == y)
+            return true;
+        if (x == 0 || y == 0)
+            break;
+    }
+
+    /* Otherwise, compare the paths character by character, from the
+       end where they are most likely to differ */
+    x = a;
+    y = b;
+    int xpos = x->leaf_length;
+    int ypos = y->leaf_length;
+    while (true) {
+        int c = name_node_prev_char(x, xpos);
+        if (c != name_node_prev_char(y, ypos))
+            return false;
+        if (c == -1)
+            return true;
+    }
 }
+
 sc_object_manager::sc_object_manager()
 {
     ordered_object_vector = new object_vector_type;
 
     object_table = new object_table_type;
-    object_table->set_hash_fn(default_str_hash_fn);
-    object_table->set_cmpr_fn(strcmp_void);
+    leaf_table = new leaf_table_type;
 
     object_hierarchy = new object_hierarchy_type;
     ordered_object_vector_dirty = true;
     next_object_index = 0;
     module_name_stack = 0;
+    object_list = 0;
+
+    arena_blocks = 0;
+    arena_next = 0;
+    arena_avail = 0;
+
+    free_nodes = 0;
+    free_leaf_nodes = 0;
 }
 
 sc_object_manager::~sc_object_manager()
 {
     delete object_hierarchy;
 
-    /* Go through each object in the table, and
-       mark the simc field of the object NULL */
-    object_table_type::iterator it(object_table);
-    for ( ; !it.empty(); it++) {
-        sc_object* obj = it.contents();
+    /* Go through each live object, named or not, and mark the simc
+       field of the object NULL.  Since the names are about to go
+       away with the arena, give each object its own copy of its full
+       name first. */
+    for (sc_object* obj = object_list; obj != 0; obj = obj->m_next_object) {
+        (void) obj->name();
         obj->simc = 0;
     }
+    object_list = 0;
     delete object_table;
+    delete leaf_table;
     delete ordered_object_vector;
+
+    while (arena_blocks != 0) {
+        char* next = *(char**) arena_blocks;
+        free(arena_blocks);
+        arena_blocks = next;
+    }
+}
+
+void*
+sc_object_manager::arena_allocate(int n, bool aligned)
+{
+    if (aligned) {
+        int skew = (int) ((size_t) arena_next % sizeof(double));
+        if (skew != 0 && arena_avail >= (int) sizeof(double) - skew) {
+            arena_next  += sizeof(double) - skew;
+            arena_avail -= sizeof(double) - skew;
+        }
+    }
+    if (n > arena_avail) {
+        int bs = (n > SC_NAME_ARENA_BLOCK_SIZE) ? n : SC_NAME_ARENA_BLOCK_SIZE;
+        /* The link to the next block takes the first double-sized
+           word, so that the rest of the block is aligned */
+        char* block = (char*) malloc(sizeof(double) + bs);
+        *(char**) block = arena_blocks;
+        arena_blocks = block;
+        arena_next = block + sizeof(double);
+        arena_avail = bs;
+    }
+    void* p = arena_next;
+    arena_next += n;
+    arena_avail -= n;
+    return p;
+}
+
+const sc_name_node*
+sc_object_manager::make_name(const sc_name_node* parent, const char* leaf,
+                             bool share_leaf)
+{
+    int leaf_length = strlen(leaf);
+    const char* l = 0;
+    sc_name_node* n;
+    if (! share_leaf && leaf_length < SC_NAME_NODE_LEAF_SIZE) {
+        /* The leaf goes right after the node, and is recycled with it */
+        n = free_leaf_nodes;
+        if (n != 0)
+            free_leaf_nodes = (sc_name_node*) n->parent;
+        else
+            n = (sc_name_node*) arena_allocate(sizeof(sc_name_node) +
+                                               SC_NAME_NODE_LEAF_SIZE, true);
+        char* s = (char*) (n + 1);
+        memcpy(s, leaf, leaf_length + 1);
+        l = s;
+    }
+    else {
+        if (! share_leaf || ! leaf_table->lookup(leaf, &l)) {
+            char* s = (char*) arena_allocate(leaf_length + 1, false);
+            memcpy(s, leaf, leaf_length + 1);
+            if (share_leaf)
+                leaf_table->insert(s, s);
+            l = s;
+        }
+        n = free_nodes;
+        if (n != 0)
+            free_nodes = (sc_name_node*) n->parent;
+        else
+            n = (sc_name_node*) arena_allocate(sizeof(sc_name_node), true);
+    }
+
+    n->parent = parent;
+    n->leaf = l;
+    n->leaf_length = leaf_length;
+    n->refs = 1;
+    if (parent)
+        ((sc_name_node*) parent)->refs++;
+
+    unsigned h = 0;
+    n->length = leaf_length;
+    if (parent) {
+        h = sc_name_node::hash_step(parent->hash, HIERARCHY_CHAR);
+        n->length += parent->length + 1;
+    }
+    for (int i = 0; i < leaf_length; ++i)
+        h = sc_name_node::hash_step(h, l[i]);
+    n->hash = h;
+    return n;
+}
+
+void
+sc_object_manager::release_name(const sc_name_node* name)
+{
+    /* Releasing a node drops its reference to its parent */
+    sc_name_node* n = (sc_name_node*) name;
+    while (n != 0 && --n->refs == 0) {
+        sc_name_node* parent = (sc_name_node*) n->parent;
+        if (n->leaf == (const char*) (n + 1)) {
+            n->parent = free_leaf_nodes;
+            free_leaf_nodes = n;
+        }
+        else {
+            n->parent = free_nodes;
+            free_nodes = n;
+        }
+        n = parent;
+    }
 }
 
 sc_object*
 sc_object_manager::find_object(const char* name)
+{
+    /* Wrap the path into a single-leaf node; see
+       sc_name_node_hash_traits::equal() */
+    sc_name_node key;
+    unsigned h = 0;
+    int len = 0;
+    for (const char* p = name; *p != 0; ++p, ++len)
+        h = sc_name_node::hash_step(h, *p);
+    key.parent = 0;
+    key.leaf = name;
+    key.leaf_length = len;
+    key.length = len;
+    key.hash = h;
+    return (*object_table)[&key];
+}
+
+sc_object*
+sc_object_manager::find_object(const sc_name_node* name)
 {
     return (*object_table)[name];
 }
@@ -184,15 +379,36 @@ sc_object_manager::top_of_module_name_stack()
 }
 
 void
-sc_object_manager::insert_object(const char* name, sc_object* obj)
+sc_object_manager::insert_object(const sc_name_node* name, sc_object* obj)
 {
     object_table->insert(name, obj);
     ordered_object_vector_dirty = true;
 }
 
 void
-sc_object_manager::remove_object(const char* name)
+sc_object_manager::remove_object(const sc_name_node* name)
 {
     object_table->remove(name);
     ordered_object_vector_dirty = true;
 }
+
+void
+sc_object_manager::link_object(sc_object* obj)
+{
+    obj->m_prev_object = 0;
+    obj->m_next_object = object_list;
+    if (object_list != 0)
+        object_list->m_prev_object = obj;
+    object_list = obj;
+}
+
+void
+sc_object_manager::unlink_object(sc_object* obj)
+{
+    if (obj->m_prev_object != 0)
+        obj->m_prev_object->m_next_object = obj->m_next_object;
+    else
+        object_list = obj->m_next_object;
+    if (obj->m_next_object != 0)
+        obj->m_next_object->m_prev_object = obj->m_prev_object;
+}
@@ -36,13 +36,66 @@
 #ifndef SC_OBJECT_MANAGER_H
 #define SC_OBJECT_MANAGER_H
 
+#include "sc_flat_hash.h"
+
 class sc_module_name;
 
+//
+// Hierarchical names are interned as (parent, leaf) pairs.  The leaf
+// strings live in a string arena owned by the object manager, and
+// leaves of named objects are shared, so that a name like "clk" is
+// stored once no matter how many modules have one.  Each node keeps
+// the hash of its full path, computed incrementally from the
+// parent's, so that the full path never has to be built to index
+// an object.
+//
+// A node is referenced by the object it names and by the nodes of
+// that object's children, which may outlive it.  When the last
+// reference goes, the node goes back to a free list of the object
+// manager, so that creating and destroying objects over and over
+// does not grow the arena.  The leaf of an unnamed object is stored
+// right after its node and recycled with it.  Shared leaves stay in
+// the arena until the object manager goes away; there is one per
+// distinct name, so they are bounded by the design, not by how many
+// objects come and go.
+//
+
+struct sc_name_node {
+    const sc_name_node* parent;
+    const char*         leaf;
+    int                 leaf_length;
+    int                 length;     // length of the full path
+    unsigned            hash;       // hash state of the full path
+    int                 refs;       // the object and the child nodes
+
+    static unsigned hash_step( unsigned h, char c )
+    {
+        unsigned g;
+        h = (h << 4) + c;
+        if ((g = h & 0xf0000000) != 0)
+            h = (h ^ (g >> 24)) ^ g;
+        return h;
+    }
+
+    /* Writes the full path, which has length chars, into buf. */
+    void copy_path( char* buf ) const;
+};
+
+/* Hash traits for indexing name nodes by their full path.  Two nodes
+   are equal if their full paths are, regardless of how the paths are
+   split into leaves; a path that is looked up by string is wrapped
+   into a single parentless node. */
+struct sc_name_node_hash_traits {
+    static unsigned hash( const sc_name_node* n ) { return n->hash * 2654435789U; }
+    static bool equal( const sc_name_node* a, const sc_name_node* b );
+};
+
 class sc_object_manager {
     friend class sc_simcontext;
 
 public:
-    typedef sc_phash<const char*, sc_object*> object_table_type;
+    typedef sc_flat_hash<const sc_name_node*, sc_object*, sc_name_node_hash_traits> object_table_type;
+    typedef sc_flat_hash<const char*, const char*, sc_flat_str_hash_traits> leaf_table_type;
     typedef sc_pvector<sc_object*> object_vector_type;
     typedef sc_plist<sc_object*> object_hierarchy_type;
 
@@ -62,16 +115,46 @@ public:
     sc_module_name* pop_module_name();
     sc_module_name* top_of_module_name_stack();
 
-    void insert_object(const char* name, sc_object* obj);
-    void remove_object(const char* name);
+    /* Interns the name leaf under parent (0 for a top-level name).
+       If share_leaf, the leaf string is shared with other nodes. */
+    const sc_name_node* make_name(const sc_name_node* parent, const char* leaf,
+                                  bool share_leaf);
+    /* Drops the reference of an object to its name, which must have
+       been taken out of the object table; see sc_name_node. */
+    void release_name(const sc_name_node* name);
+
+    sc_object* find_object(const sc_name_node* name);
+    void insert_object(const sc_name_node* name, sc_object* obj);
+    void remove_object(const sc_name_node* name);
+
+    /* Every object whose name is interned is linked, whether or not
+       it is in the object table, so that each gets a copy of its name
+       before the arena goes away. */
+    void link_object(sc_object* obj);
+    void unlink_object(sc_object* obj);
 
 private:
+    void* arena_allocate(int n, bool aligned);
+
     object_table_type* object_table;
+    leaf_table_type* leaf_table;
     object_vector_type* ordered_object_vector;
     bool ordered_object_vector_dirty;
     int next_object_index;
     object_hierarchy_type* object_hierarchy;
     sc_module_name* module_name_stack;
+    sc_object* object_list;
+
+    /* The string arena: a list of blocks, each starting with a link
+       to the next one */
+    char* arena_blocks;
+    char* arena_next;
+    int arena_avail;
+
+    /* Released nodes, linked through their parent fields: those with
+       a shared leaf, and those with room for an unshared leaf */
+    sc_name_node* free_nodes;
+    sc_name_node* free_leaf_nodes;
 };
 
 #endif
@@ -186,7 +186,7 @@ sc_port_manager::sc_port_manager(sc_simcontext* simcontext)
 {
     simc = simcontext;
     error_occurred = false;
-    port_status_table = new sc_phash<sc_port_b*, sc_port_info*>;
+    port_status_table = new sc_flat_hash<sc_port_b*, sc_port_info*>;
     unresolved_lambdas = new sc_pvector<sc_lambda_ptr*>;
     unbound_syncs = 0;
 }
@@ -202,7 +202,7 @@ void
 sc_port_manager::delete_port_status_table()
 {
     if (port_status_table) {
-        sc_phash<sc_port_b*, sc_port_info*>::iterator it(port_status_table);
+        sc_flat_hash<sc_port_b*, sc_port_info*>::iterator it(port_status_table);
         for (; !it.empty(); it++) {
             delete it.contents();
         }
@@ -513,7 +513,7 @@ sc_port_manager::resolve_all_ports()
     /* Ensure that all ports have been bound */
 
     /* Loop through port_status_table to update the signals */
-    sc_phash<sc_port_b*, sc_port_info*>::iterator it(port_status_table);
+    sc_flat_hash<sc_port_b*, sc_port_info*>::iterator it(port_status_table);
     for ( ; !it.empty(); it++) {
         sc_port_b* port = it.key();
         sc_port_info* port_info = it.contents();
@@ -18,8 +18,9 @@
 
 /* Requires "sc_port.h" */
 
+#include "sc_flat_hash.h"
+
 template<class T> class sc_pvector;
-template<class K, class C> class sc_phash;
 
 class sc_port_b;
 struct sc_port_info;
@@ -65,7 +66,7 @@ public:
 private:
     bool error_occurred;
     sc_simcontext* simc; /* back pointer to the simulation context */
-    sc_phash<sc_port_b*, sc_port_info*>* port_status_table;
+    sc_flat_hash<sc_port_b*, sc_port_info*>* port_status_table;
     sc_pvector<sc_lambda_ptr*>* unresolved_lambdas;
     sc_sync_process_handle unbound_syncs;
 
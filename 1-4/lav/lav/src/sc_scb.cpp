@@ -0,0 +1,990 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_scb.cpp -- The SCB binary waveform format: writer, reader and
+                  conversion to VCD.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sc_scb.h"
+#include "sc_lz.h"
+
+// Makes room for need elements in p, which holds n of them
+template< class T >
+static void
+scb_reserve( T*& p, int n, int* alloc, int need )
+{
+    if (need <= *alloc)
+        return;
+    int new_alloc = (*alloc < 16) ? 16 : *alloc;
+    while (new_alloc < need)
+        new_alloc *= 2;
+    T* q = new T[new_alloc];
+    if (n > 0)
+        memcpy(q, p, n * sizeof(T));
+    delete[] p;
+    p = q;
+    *alloc = new_alloc;
+}
+
+// Large files need 64-bit offsets
+static scb_uint64
+scb_tell( FILE* f )
+{
+#ifdef WIN32
+    return (scb_uint64) _ftelli64(f);
+#else
+    return (scb_uint64) ftello(f);
+#endif
+}
+
+static bool
+scb_seek( FILE* f, scb_uint64 offset )
+{
+#ifdef WIN32
+    return _fseeki64(f, (__int64) offset, SEEK_SET) == 0;
+#else
+    return fseeko(f, (off_t) offset, SEEK_SET) == 0;
+#endif
+}
+
+// Returns the position after the value of a change of s that is not
+// all x, or 0 if it runs past end.  Values of SCB_BITS signals up to
+// 64 bits are returned in bits.
+static const unsigned char*
+scb_skip_value( const scb_signal& s, const unsigned char* q,
+                const unsigned char* end, scb_uint64* bits )
+{
+    if (s.kind == SCB_BITS && s.width <= 64)
+        return scb_get_varint(q, end, bits);
+    int size = scb_value_size(s.kind, s.width);
+    return (size > end - q) ? 0 : q + size;
+}
+
+
+/*****************************************************************************/
+
+scb_writer::scb_writer( FILE* _fp, int _block_size )
+    : fp(_fp), block_size(_block_size)
+{
+    index_fp = 0;
+    snapshot_interval = 0;
+    if (block_size < 4096)
+        block_size = 4096;
+    signals = 0;
+    n_signals = n_alloc = 0;
+    times = 0;
+    n_times = times_alloc = 0;
+    last_time = 0;
+    block_bytes = 0;
+    raw = packed = 0;
+    raw_alloc = packed_alloc = 0;
+    bytes_written = 0;
+    started = false;
+}
+
+scb_writer::~scb_writer()
+{
+    if (started) {
+        flush();
+        unsigned char end_marker[2] = { 0, 0 };
+        write_bytes(end_marker, 2);
+    }
+    for (int i = 0; i < n_signals; ++i) {
+        delete[] signals[i].name;
+        delete[] signals[i].data;
+        delete[] signals[i].snap;
+    }
+    delete[] signals;
+    delete[] times;
+    delete[] raw;
+    delete[] packed;
+}
+
+int
+scb_writer::add_signal( const char* name, int kind, int width )
+{
+    scb_reserve(signals, n_signals, &n_alloc, n_signals + 1);
+    signal_info& s = signals[n_signals];
+    s.name = new char[strlen(name) + 1];
+    strcpy(s.name, name);
+    s.kind = kind;
+    s.width = width;
+    s.data = 0;
+    s.len = s.cap = 0;
+    s.n_changes = 0;
+    s.last_cycle = 0;
+    s.last_change = 0;
+    s.snap = 0;
+    s.snap_len = s.snap_cap = 0;
+    s.snap_x = true;
+    s.snap_time = 0;
+    return n_signals++;
+}
+
+void
+scb_writer::set_index( FILE* _index_fp, scb_uint64 _snapshot_interval )
+{
+    index_fp = _index_fp;
+    snapshot_interval = _snapshot_interval;
+}
+
+void
+scb_writer::write_header( int time_unit_exponent )
+{
+    int size = SCB_MAGIC_SIZE + 40;
+    for (int i = 0; i < n_signals; ++i)
+        size += 30 + strlen(signals[i].name);
+    scb_reserve(raw, 0, &raw_alloc, size);
+
+    unsigned char* p = raw;
+    memcpy(p, SCB_MAGIC, SCB_MAGIC_SIZE);
+    p += SCB_MAGIC_SIZE;
+    p = scb_put_varint(p, SCB_VERSION);
+    p = scb_put_varint(p, time_unit_exponent + 15);
+    p = scb_put_varint(p, n_signals);
+    for (int i = 0; i < n_signals; ++i) {
+        int n = strlen(signals[i].name);
+        p = scb_put_varint(p, signals[i].kind);
+        p = scb_put_varint(p, signals[i].width);
+        p = scb_put_varint(p, n);
+        memcpy(p, signals[i].name, n);
+        p += n;
+    }
+    write_bytes(raw, p - raw);
+    started = true;
+
+    if (index_fp != 0) {
+        p = raw;
+        memcpy(p, SCB_INDEX_MAGIC, SCB_MAGIC_SIZE);
+        p += SCB_MAGIC_SIZE;
+        p = scb_put_varint(p, SCB_VERSION);
+        p = scb_put_varint(p, n_signals);
+        if (fwrite(raw, 1, p - raw, index_fp) != (size_t) (p - raw))
+            index_fp = 0;
+
+        // Nothing is known before the first block
+        for (int i = 0; i < n_signals; ++i) {
+            signals[i].snap_x = true;
+            signals[i].snap_time = 0;
+        }
+        write_snapshot();
+    }
+}
+
+void
+scb_writer::begin_cycle( scb_uint64 time )
+{
+    if (snapshot_interval != 0 && n_times != 0 && time - times[0] >= snapshot_interval)
+        flush();
+    scb_reserve(times, n_times, &times_alloc, n_times + 1);
+    times[n_times++] = time;
+}
+
+unsigned char*
+scb_writer::begin_change( int signal, bool all_x, int value_size )
+{
+    signal_info& s = signals[signal];
+    scb_reserve(s.data, s.len, &s.cap, s.len + 10 + value_size);
+
+    int cycle = n_times - 1;
+    s.last_change = s.len;
+    unsigned char* p = scb_put_varint(s.data + s.len,
+                                      ((scb_uint64) (cycle - s.last_cycle) << 1) | all_x);
+    s.last_cycle = cycle;
+    ++s.n_changes;
+    block_bytes += 2 + value_size;
+    return p;
+}
+
+void
+scb_writer::put_bits( int signal, scb_uint64 v, bool all_x )
+{
+    unsigned char* p = begin_change(signal, all_x, 10);
+    if (! all_x)
+        p = scb_put_varint(p, v);
+    end_change(signal, p);
+}
+
+void
+scb_writer::put_real( int signal, double v )
+{
+    unsigned char* p = begin_change(signal, false, 8);
+    scb_uint64 u;
+    memcpy(&u, &v, 8);
+    for (int i = 0; i < 8; ++i) {
+        *p++ = (unsigned char) u;
+        u >>= 8;
+    }
+    end_change(signal, p);
+}
+
+void
+scb_writer::end_cycle()
+{
+    if (block_bytes >= block_size)
+        flush();
+}
+
+void
+scb_writer::flush()
+{
+    if (n_times == 0)
+        return;
+
+    int size = 30 + 10 * n_times;
+    for (int i = 0; i < n_signals; ++i) {
+        if (signals[i].n_changes != 0)
+            size += 30 + signals[i].len;
+    }
+    scb_reserve(raw, 0, &raw_alloc, size);
+
+    unsigned char* p = raw;
+    p = scb_put_varint(p, n_times);
+    scb_uint64 prev = last_time;
+    for (int k = 0; k < n_times; ++k) {
+        p = scb_put_varint(p, times[k] - prev);
+        prev = times[k];
+    }
+    int n_changed = 0;
+    for (int i = 0; i < n_signals; ++i) {
+        if (signals[i].n_changes != 0)
+            ++n_changed;
+    }
+    p = scb_put_varint(p, n_changed);
+    int prev_signal = -1;
+    for (int i = 0; i < n_signals; ++i) {
+        signal_info& s = signals[i];
+        if (s.n_changes == 0)
+            continue;
+        p = scb_put_varint(p, i - prev_signal);
+        p = scb_put_varint(p, s.n_changes);
+        p = scb_put_varint(p, s.len);
+        memcpy(p, s.data, s.len);
+        p += s.len;
+        prev_signal = i;
+        if (index_fp != 0) {
+            // The last change is the value for the snapshot
+            const unsigned char* q = s.data + s.last_change;
+            scb_uint64 c;
+            q = scb_get_varint(q, s.data + s.len, &c);
+            int n = (s.data + s.len) - q;
+            scb_reserve(s.snap, 0, &s.snap_cap, n);
+            memcpy(s.snap, q, n);
+            s.snap_len = n;
+            s.snap_x = (c & 1) != 0;
+            s.snap_time = times[s.last_cycle];
+        }
+        s.len = 0;
+        s.n_changes = 0;
+        s.last_cycle = 0;
+    }
+    int raw_len = p - raw;
+
+    scb_reserve(packed, 0, &packed_alloc, 20 + sc_lz_bound(raw_len));
+    unsigned char* q = packed + 20;
+    int stored_len = sc_lz_compress(raw, raw_len, q);
+    if (stored_len >= raw_len) {
+        q = raw;
+        stored_len = raw_len;
+    }
+    unsigned char head[20];
+    unsigned char* h = scb_put_varint(head, raw_len);
+    h = scb_put_varint(h, stored_len);
+    write_bytes(head, h - head);
+    write_bytes(q, stored_len);
+
+    last_time = times[n_times - 1];
+    n_times = 0;
+    block_bytes = 0;
+
+    if (index_fp != 0)
+        write_snapshot();
+}
+
+void
+scb_writer::write_snapshot()
+{
+    int size = 0;
+    for (int i = 0; i < n_signals; ++i)
+        size += 10 + signals[i].snap_len;
+    scb_reserve(raw, 0, &raw_alloc, size);
+    unsigned char* p = raw;
+    for (int i = 0; i < n_signals; ++i) {
+        const signal_info& s = signals[i];
+        p = scb_put_varint(p, ((last_time - s.snap_time) << 1) | s.snap_x);
+        if (! s.snap_x) {
+            memcpy(p, s.snap, s.snap_len);
+            p += s.snap_len;
+        }
+    }
+    size = p - raw;
+
+    scb_reserve(packed, 0, &packed_alloc, sc_lz_bound(size));
+    const unsigned char* q = packed;
+    int stored_len = sc_lz_compress(raw, size, packed);
+    if (stored_len >= size) {
+        q = raw;
+        stored_len = size;
+    }
+    unsigned char head[50];
+    unsigned char* h = scb_put_varint(head, last_time);
+    h = scb_put_varint(h, bytes_written);
+    h = scb_put_varint(h, size);
+    h = scb_put_varint(h, stored_len);
+    if (fwrite(head, 1, h - head, index_fp) != (size_t) (h - head)
+        || fwrite(q, 1, stored_len, index_fp) != (size_t) stored_len) {
+        fprintf(stderr, "SCB Trace ERROR:\nCannot write to SCB index file.\n\n");
+        index_fp = 0;
+    }
+}
+
+void
+scb_writer::write_bytes( const unsigned char* p, int n )
+{
+    if (fwrite(p, 1, n, fp) != (size_t) n) {
+        static bool warned = false;
+        if (! warned) {
+            fprintf(stderr, "SCB Trace ERROR:\nCannot write to SCB trace file.\n\n");
+            warned = true;
+        }
+    }
+    bytes_written += n;
+}
+
+
+/*****************************************************************************/
+
+scb_reader::scb_reader()
+{
+    fp = 0;
+    err = 0;
+    time_unit = 0;
+    signals = 0;
+    n_signals = 0;
+    raw = packed = 0;
+    raw_alloc = packed_alloc = 0;
+    times = 0;
+    n_times = times_alloc = 0;
+    last_time = 0;
+    events = unsorted = 0;
+    n_events = events_alloc = unsorted_alloc = 0;
+    next_event = 0;
+    cycle_start = 0;
+    at_end = true;
+    index_fp = 0;
+    snapshots = 0;
+    n_snapshots = snapshots_alloc = 0;
+    values = 0;
+    value_data = 0;
+}
+
+scb_reader::~scb_reader()
+{
+    close();
+    delete[] raw;
+    delete[] packed;
+    delete[] times;
+    delete[] events;
+    delete[] unsorted;
+    delete[] cycle_start;
+}
+
+void
+scb_reader::close()
+{
+    close_index();
+    if (fp != 0)
+        fclose(fp);
+    fp = 0;
+    for (int i = 0; i < n_signals; ++i)
+        delete[] signals[i].name;
+    delete[] signals;
+    signals = 0;
+    n_signals = 0;
+    n_events = next_event = 0;
+    last_time = 0;
+    at_end = true;
+}
+
+bool
+scb_reader::fail( const char* msg )
+{
+    err = msg;
+    at_end = true;
+    n_events = next_event = 0;
+    return false;
+}
+
+bool
+scb_reader::read_varint( FILE* f, scb_uint64* v )
+{
+    scb_uint64 r = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int b = getc(f);
+        if (b == EOF)
+            return false;
+        r |= (scb_uint64) (b & 0x7f) << shift;
+        if ((b & 0x80) == 0) {
+            *v = r;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+scb_reader::open( const char* file_name )
+{
+    close();
+    err = 0;
+    fp = fopen(file_name, "rb");
+    if (fp == 0)
+        return fail("cannot open file");
+
+    char magic[SCB_MAGIC_SIZE];
+    if (fread(magic, 1, SCB_MAGIC_SIZE, fp) != (size_t) SCB_MAGIC_SIZE
+        || memcmp(magic, SCB_MAGIC, SCB_MAGIC_SIZE) != 0)
+        return fail("not an SCB file");
+
+    scb_uint64 version, unit, n;
+    if (! read_varint(fp, &version) || ! read_varint(fp, &unit) || ! read_varint(fp, &n))
+        return fail("truncated header");
+    if (version != SCB_VERSION)
+        return fail("unsupported SCB version");
+    if (unit > 17 || n > 0x7fffffff)
+        return fail("bad header");
+    time_unit = (int) unit - 15;
+
+    signals = new scb_signal[(int) n];
+    for (n_signals = 0; n_signals < (int) n; ) {
+        scb_uint64 kind, width, len;
+        if (! read_varint(fp, &kind) || ! read_varint(fp, &width) || ! read_varint(fp, &len))
+            return fail("truncated header");
+        if (kind > SCB_REAL || width == 0 || width > 0x7fffffff || len > 0xffff)
+            return fail("bad header");
+        scb_signal& s = signals[n_signals++];
+        s.kind = (int) kind;
+        s.width = (int) width;
+        s.name = new char[(int) len + 1];
+        s.name[0] = 0;
+        if (fread(s.name, 1, (size_t) len, fp) != (size_t) len)
+            return fail("truncated header");
+        s.name[len] = 0;
+    }
+    at_end = false;
+    return true;
+}
+
+bool
+scb_reader::next_change( scb_change* c )
+{
+    while (next_event == n_events) {
+        if (at_end)
+            return false;
+        if (! read_block())
+            return false;
+    }
+    const event& e = events[next_event++];
+    c->time = times[e.cycle];
+    c->signal = e.signal;
+    c->all_x = e.all_x;
+    c->value = e.value;
+    c->bits = e.bits;
+    if (values != 0)
+        set_value(e.signal, c->time, e.all_x, e.value, e.bits);
+    return true;
+}
+
+bool
+scb_reader::read_block()
+{
+    scb_uint64 raw_len, stored_len;
+    if (! read_varint(fp, &raw_len)) {
+        // A file that was not closed properly ends here
+        at_end = true;
+        return false;
+    }
+    if (! read_varint(fp, &stored_len))
+        return fail("truncated block");
+    if (raw_len == 0) {
+        at_end = true;
+        return false;
+    }
+    if (raw_len > 0x7fffffff || stored_len > raw_len)
+        return fail("bad block");
+
+    int n = (int) raw_len;
+    scb_reserve(raw, 0, &raw_alloc, n);
+    if (stored_len == raw_len) {
+        if (fread(raw, 1, n, fp) != (size_t) n)
+            return fail("truncated block");
+    }
+    else {
+        int m = (int) stored_len;
+        scb_reserve(packed, 0, &packed_alloc, m);
+        if (fread(packed, 1, m, fp) != (size_t) m)
+            return fail("truncated block");
+        if (sc_lz_decompress(packed, m, raw, n) != n)
+            return fail("corrupt block");
+    }
+    return parse_block(n);
+}
+
+bool
+scb_reader::parse_block( int len )
+{
+    const unsigned char* p = raw;
+    const unsigned char* const end = raw + len;
+    scb_uint64 v;
+
+    if ((p = scb_get_varint(p, end, &v)) == 0 || v == 0 || v > (scb_uint64) len)
+        return fail("bad block");
+    n_times = (int) v;
+    scb_reserve(times, 0, &times_alloc, n_times);
+    scb_uint64 t = last_time;
+    for (int k = 0; k < n_times; ++k) {
+        if ((p = scb_get_varint(p, end, &v)) == 0)
+            return fail("bad block");
+        t += v;
+        times[k] = t;
+    }
+    last_time = t;
+
+    n_events = next_event = 0;
+    scb_uint64 n_changed;
+    if ((p = scb_get_varint(p, end, &n_changed)) == 0)
+        return fail("bad block");
+    int sig = -1;
+    for (scb_uint64 i = 0; i < n_changed; ++i) {
+        scb_uint64 d, n, nbytes;
+        if ((p = scb_get_varint(p, end, &d)) == 0
+            || (p = scb_get_varint(p, end, &n)) == 0
+            || (p = scb_get_varint(p, end, &nbytes)) == 0)
+            return fail("bad block");
+        if (d == 0 || d > (scb_uint64) (n_signals - sig - 1)
+            || n > (scb_uint64) n_times || nbytes > (scb_uint64) (end - p))
+            return fail("bad block");
+        sig += (int) d;
+        const scb_signal& s = signals[sig];
+        const unsigned char* q = p;
+        const unsigned char* const qend = p + (int) nbytes;
+        p = qend;
+
+        scb_reserve(unsorted, n_events, &unsorted_alloc, n_events + (int) n);
+        int cycle = 0;
+        for (scb_uint64 j = 0; j < n; ++j) {
+            scb_uint64 c;
+            if ((q = scb_get_varint(q, qend, &c)) == 0
+                || (c >> 1) >= (scb_uint64) (n_times - cycle)
+                || (j > 0 && (c >> 1) == 0))
+                return fail("bad block");
+            cycle += (int) (c >> 1);
+            event& e = unsorted[n_events++];
+            e.cycle = cycle;
+            e.signal = sig;
+            e.all_x = (c & 1) != 0;
+            e.value = q;
+            e.bits = 0;
+            if (e.all_x)
+                continue;
+            if ((q = scb_skip_value(s, q, qend, &e.bits)) == 0)
+                return fail("bad block");
+        }
+    }
+
+    // Sort the changes by cycle; within a cycle they stay in signal order
+    scb_reserve(events, 0, &events_alloc, n_events);
+    delete[] cycle_start;
+    cycle_start = new int[n_times + 1];
+    memset(cycle_start, 0, (n_times + 1) * sizeof(int));
+    for (int k = 0; k < n_events; ++k)
+        ++cycle_start[unsorted[k].cycle + 1];
+    for (int k = 0; k < n_times; ++k)
+        cycle_start[k + 1] += cycle_start[k];
+    for (int k = 0; k < n_events; ++k)
+        events[cycle_start[unsorted[k].cycle]++] = unsorted[k];
+    return true;
+}
+
+void
+scb_reader::close_index()
+{
+    if (index_fp != 0)
+        fclose(index_fp);
+    index_fp = 0;
+    if (values != 0) {
+        for (int i = 0; i < n_signals; ++i)
+            delete[] value_data[i];
+    }
+    delete[] value_data;
+    delete[] values;
+    value_data = 0;
+    values = 0;
+    delete[] snapshots;
+    snapshots = 0;
+    n_snapshots = snapshots_alloc = 0;
+}
+
+bool
+scb_reader::open_index( const char* file_name )
+{
+    close_index();
+    if (fp == 0)
+        return fail("no SCB file open");
+    index_fp = fopen(file_name, "rb");
+    if (index_fp == 0)
+        return fail("cannot open index file");
+
+    char magic[SCB_MAGIC_SIZE];
+    scb_uint64 version, n;
+    if (fread(magic, 1, SCB_MAGIC_SIZE, index_fp) != (size_t) SCB_MAGIC_SIZE
+        || memcmp(magic, SCB_INDEX_MAGIC, SCB_MAGIC_SIZE) != 0
+        || ! read_varint(index_fp, &version) || ! read_varint(index_fp, &n))
+        return fail("not an SCB index file");
+    if (version != SCB_VERSION)
+        return fail("unsupported SCB version");
+    if (n != (scb_uint64) n_signals)
+        return fail("index does not match the SCB file");
+
+    scb_uint64 position = scb_tell(index_fp);
+    fseek(index_fp, 0, SEEK_END);
+    scb_uint64 file_end = scb_tell(index_fp);
+
+    // Only the headers of the snapshots are read here.  A snapshot cut
+    // off at the end of the file is ignored.
+    scb_uint64 time, offset, raw_len, stored_len;
+    while (scb_seek(index_fp, position)
+           && read_varint(index_fp, &time) && read_varint(index_fp, &offset)
+           && read_varint(index_fp, &raw_len) && read_varint(index_fp, &stored_len)) {
+        if (raw_len > 0x7fffffff || stored_len > raw_len)
+            return fail("bad index file");
+        position = scb_tell(index_fp);
+        if (position + stored_len > file_end)
+            break;
+        scb_reserve(snapshots, n_snapshots, &snapshots_alloc, n_snapshots + 1);
+        snapshot& s = snapshots[n_snapshots++];
+        s.time = time;
+        s.offset = offset;
+        s.position = position;
+        s.raw_len = (int) raw_len;
+        s.stored_len = (int) stored_len;
+        position += stored_len;
+    }
+    if (n_snapshots == 0)
+        return fail("empty index file");
+
+    values = new scb_change[n_signals];
+    value_data = new unsigned char*[n_signals];
+    for (int i = 0; i < n_signals; ++i) {
+        int size = scb_value_size(signals[i].kind, signals[i].width);
+        value_data[i] = new unsigned char[(size > 0) ? size : 1];
+        values[i].time = 0;
+        values[i].signal = i;
+        values[i].all_x = true;
+        values[i].value = value_data[i];
+        values[i].bits = 0;
+    }
+    return true;
+}
+
+void
+scb_reader::set_value( int signal, scb_uint64 time, bool all_x,
+                       const unsigned char* value, scb_uint64 bits )
+{
+    scb_change& v = values[signal];
+    v.time = time;
+    v.all_x = all_x;
+    v.bits = bits;
+    if (! all_x) {
+        const scb_signal& s = signals[signal];
+        int size = scb_value_size(s.kind, s.width);
+        if (size > 0)
+            memcpy(value_data[signal], value, size);
+    }
+}
+
+bool
+scb_reader::read_snapshot( const snapshot& snap )
+{
+    int n = snap.raw_len;
+    int m = snap.stored_len;
+    scb_reserve(raw, 0, &raw_alloc, n);
+    if (! scb_seek(index_fp, snap.position))
+        return fail("cannot read index file");
+    if (m == n) {
+        if (fread(raw, 1, n, index_fp) != (size_t) n)
+            return fail("cannot read index file");
+    }
+    else {
+        scb_reserve(packed, 0, &packed_alloc, m);
+        if (fread(packed, 1, m, index_fp) != (size_t) m)
+            return fail("cannot read index file");
+        if (sc_lz_decompress(packed, m, raw, n) != n)
+            return fail("corrupt index file");
+    }
+
+    const unsigned char* p = raw;
+    const unsigned char* const end = raw + n;
+    for (int i = 0; i < n_signals; ++i) {
+        scb_uint64 c, bits = 0;
+        if ((p = scb_get_varint(p, end, &c)) == 0)
+            return fail("bad index file");
+        const unsigned char* value = p;
+        if ((c & 1) == 0 && (p = scb_skip_value(signals[i], p, end, &bits)) == 0)
+            return fail("bad index file");
+        set_value(i, snap.time - (c >> 1), (c & 1) != 0, value, bits);
+    }
+    return true;
+}
+
+bool
+scb_reader::seek( scb_uint64 t )
+{
+    if (values == 0)
+        return fail("no index file open");
+    err = 0;
+
+    // The last snapshot at or before t; the first one is at time 0
+    int lo = 0;
+    int hi = n_snapshots - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (snapshots[mid].time <= t)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    const snapshot& snap = snapshots[lo];
+    if (! read_snapshot(snap))
+        return false;
+    if (! scb_seek(fp, snap.offset))
+        return fail("cannot seek in SCB file");
+    last_time = snap.time;
+    n_events = next_event = 0;
+    at_end = false;
+
+    // The changes up to t
+    for (;;) {
+        while (next_event == n_events) {
+            if (at_end || ! read_block())
+                return err == 0;
+        }
+        const event& e = events[next_event];
+        if (times[e.cycle] > t)
+            return true;
+        set_value(e.signal, times[e.cycle], e.all_x, e.value, e.bits);
+        ++next_event;
+    }
+}
+
+
+/*****************************************************************************/
+
+void
+scb_value_chars( const scb_signal& s, const scb_change& c, char* bits )
+{
+    int w = s.width;
+    if (c.all_x) {
+        memset(bits, 'x', w);
+        return;
+    }
+    if (s.kind == SCB_LOGIC) {
+        for (int j = 0; j < w; ++j)
+            bits[j] = "01xz"[(c.value[j >> 2] >> (6 - 2 * (j & 3))) & 3];
+    }
+    else if (w <= 64) {
+        for (int j = 0; j < w; ++j)
+            bits[j] = (char) ('0' + ((c.bits >> (w - 1 - j)) & 1));
+    }
+    else {
+        for (int j = 0; j < w; ++j)
+            bits[j] = (char) ('0' + ((c.value[j >> 3] >> (7 - (j & 7))) & 1));
+    }
+}
+
+double
+scb_value_real( const scb_change& c )
+{
+    scb_uint64 u = 0;
+    for (int i = 7; i >= 0; --i)
+        u = (u << 8) | c.value[i];
+    double d;
+    memcpy(&d, &u, 8);
+    return d;
+}
+
+static char*
+scb_put_decimal( char* p, scb_uint64 v )
+{
+    char tmp[24];
+    int n = 0;
+    do {
+        tmp[n++] = (char) ('0' + (int) (v % 10));
+        v /= 10;
+    } while (v != 0);
+    while (n > 0)
+        *p++ = tmp[--n];
+    *p = 0;
+    return p;
+}
+
+// Same identifiers as vcd_trace_file::create_vcd_name()
+static void
+scb_vcd_code( int n, char* buf )
+{
+    do {
+        *buf++ = (char) ('!' + n % 94);
+        n /= 94;
+    } while (n-- != 0);
+    *buf = 0;
+}
+
+// Writes a vector value the way the VCD trace file does
+static void
+scb_put_vcd_vector( FILE* f, char* bits, int w, const char* code )
+{
+    if (w == 1) {
+        fprintf(f, "%c%s\n", bits[0], code);
+        return;
+    }
+    char first = bits[0];
+    int i = 0;
+    if (first == 'z' || first == 'x' || first == '0') {
+        i = 1;
+        while (i < w && bits[i] == first)
+            ++i;
+        if (! (first == '0' && i < w && bits[i] == '1'))
+            --i;
+    }
+    bits[w] = 0;
+    fprintf(f, "b%s %s\n", bits + i, code);
+}
+
+int
+scb_to_vcd( const char* scb_name, const char* vcd_name )
+{
+    scb_reader r;
+    if (! r.open(scb_name)) {
+        fprintf(stderr, "%s: %s\n", scb_name, r.error());
+        return -1;
+    }
+    FILE* f = fopen(vcd_name, "w");
+    if (f == 0) {
+        fprintf(stderr, "Cannot write %s\n", vcd_name);
+        return -1;
+    }
+    setvbuf(f, 0, _IOFBF, 1 << 16);
+
+    char buf[200];
+    time_t now;
+    time(&now);
+    strftime(buf, 199, "%b %d, %Y       %H:%M:%S", localtime(&now));
+    fprintf(f, "$date\n     %s\n$end\n\n", buf);
+    fprintf(f, "$version\n Converted from SCB file %s\n$end\n\n", scb_name);
+    static const char* units[] = { "fs", "ps", "ns", "us", "ms", "s" };
+    int e = r.time_unit_exponent() + 15;
+    static const char* scales[] = { "1", "10", "100" };
+    fprintf(f, "$timescale\n     %s %s\n$end\n\n", scales[e % 3], units[e / 3]);
+    fprintf(f, "$scope module SystemC $end\n");
+
+    int max_width = 1;
+    char** codes = new char*[r.num_signals()];
+    for (int i = 0; i < r.num_signals(); ++i) {
+        const scb_signal& s = r.signal(i);
+        codes[i] = new char[8];
+        scb_vcd_code(i, codes[i]);
+        if (s.width > max_width)
+            max_width = s.width;
+        fprintf(f, "$var %s  % 3d  %s  ",
+                (s.kind == SCB_REAL) ? "real" : "wire", s.width, codes[i]);
+        for (const char* p = s.name; *p != 0; ++p)
+            putc((*p == '[') ? '(' : (*p == ']') ? ')' : *p, f);
+        fprintf(f, "       $end\n");
+    }
+    fprintf(f, "$upscope $end\n");
+    fprintf(f, "$enddefinitions  $end\n\n");
+
+    char* bits = new char[max_width + 1];
+    bool first = true;
+    bool in_dumpvars = false;
+    scb_uint64 cur_time = 0;
+    scb_change c;
+    while (r.next_change(&c)) {
+        if (first) {
+            fprintf(f, "$dumpvars\n");
+            in_dumpvars = true;
+            cur_time = c.time;
+            first = false;
+        }
+        else if (c.time != cur_time) {
+            if (in_dumpvars) {
+                fprintf(f, "$end\n\n");
+                in_dumpvars = false;
+            }
+            else
+                fprintf(f, "\n");
+            scb_put_decimal(buf, c.time);
+            fprintf(f, "#%s\n", buf);
+            cur_time = c.time;
+        }
+        const scb_signal& s = r.signal(c.signal);
+        if (s.kind == SCB_REAL)
+            fprintf(f, "r%.16g %s\n", scb_value_real(c), codes[c.signal]);
+        else {
+            scb_value_chars(s, c, bits);
+            scb_put_vcd_vector(f, bits, s.width, codes[c.signal]);
+        }
+    }
+    if (in_dumpvars)
+        fprintf(f, "$end\n\n");
+    else if (! first)
+        fprintf(f, "\n");
+
+    for (int i = 0; i < r.num_signals(); ++i)
+        delete[] codes[i];
+    delete[] codes;
+    delete[] bits;
+
+    int rc = 0;
+    if (r.error() != 0) {
+        fprintf(stderr, "%s: %s\n", scb_name, r.error());
+        rc = -1;
+    }
+    if (fclose(f) != 0) {
+        fprintf(stderr, "Cannot write %s\n", vcd_name);
+        rc = -1;
+    }
+    return rc;
+}
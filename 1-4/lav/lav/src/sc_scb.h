@@ -0,0 +1,390 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_scb.h -- The SCB binary waveform format: writer, reader and
+                conversion to VCD.  This part does not depend on the
+                rest of SystemC, so that tools can be built from it
+                alone.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#ifndef SC_SCB_H
+#define SC_SCB_H
+
+#include <stdio.h>
+
+//
+// An SCB file is
+//
+//     header, block, block, ..., end marker
+//
+// All integers are unsigned varints: 7 bits per byte, least significant
+// first, the high bit set on all bytes but the last.
+//
+// The header is the magic string "SCBW\032", the format version, the
+// time unit as exponent + 15 (1e-15 .. 1e2 seconds), the number of
+// signals, and for each signal its kind, width, and name (length and
+// characters).  Signals are numbered in this order from 0.
+//
+// A block is its raw size, its stored size, and the stored bytes.  The
+// block is compressed with sc_lz_compress() if the stored size is
+// smaller than the raw size, and stored as it is otherwise.  The end
+// marker is a block of raw size 0.
+//
+// The raw block holds the value changes of a run of cycles:
+//
+//     number of cycles n
+//     time of cycle 0, as difference to the last time of the previous
+//         block (0 for the first block)
+//     times of cycles 1 ... n-1, each as difference to the previous
+//     number of signals that change in the block
+//     for each of those signals, in increasing order:
+//         signal number, as difference to the previous one plus 1
+//             (as it is for the first)
+//         number of changes
+//         number of bytes of the changes
+//         the changes
+//
+// A change is a varint c followed by the value.  c >> 1 is the cycle of
+// the change, as difference to the cycle of the previous change of the
+// signal in the block (to cycle 0 for the first).  If c & 1 is set
+// all bits of the value are x and nothing follows; otherwise the value
+// is, by kind:
+//
+//     SCB_BITS   width <= 64: varint; otherwise (width + 7) / 8 bytes,
+//                most significant bits first, left-aligned
+//     SCB_LOGIC  (width + 3) / 4 bytes of 2-bit codes 0, 1, x, z
+//                (0 ... 3), most significant first, left-aligned
+//     SCB_REAL   8 bytes of an IEEE double, least significant first
+//
+// The first cycle of the first block holds the initial values of all
+// signals.  Since each block starts its own delta coding, a reader can
+// start at any block if it knows the values of the signals there.
+//
+// Those values are kept in the optional index file, which is
+//
+//     header, snapshot, snapshot, ...
+//
+// The header is the magic string "SCBI\032", the format version and
+// the number of signals.  A snapshot is taken before the first block
+// and after each block:
+//
+//     time of the last cycle before it (0 for the first)
+//     file offset of the following block
+//     raw size and stored size of the values, as for blocks
+//     the values
+//
+// The raw values hold, for each signal in order, a change as above,
+// except that c >> 1 is the time of the change as difference to the
+// time of the snapshot.  The first snapshot has all values x.
+// To find the values at time t, a reader takes the last snapshot with
+// time <= t and applies the changes from its block on up to time t.
+//
+
+#ifdef WIN32
+typedef unsigned __int64 scb_uint64;
+#else
+typedef unsigned long long scb_uint64;
+#endif
+
+#define SCB_MAGIC "SCBW\032"
+#define SCB_INDEX_MAGIC "SCBI\032"
+const int SCB_MAGIC_SIZE = 5;
+const int SCB_VERSION = 1;
+
+enum scb_kind {
+    SCB_BITS = 0,
+    SCB_LOGIC = 1,
+    SCB_REAL = 2
+};
+
+inline unsigned char*
+scb_put_varint( unsigned char* p, scb_uint64 v )
+{
+    while (v >= 0x80) {
+        *p++ = (unsigned char) (v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (unsigned char) v;
+    return p;
+}
+
+// Returns the position after the varint, or 0 if it runs past end
+inline const unsigned char*
+scb_get_varint( const unsigned char* p, const unsigned char* end, scb_uint64* v )
+{
+    scb_uint64 r = 0;
+    int shift = 0;
+    while (p < end && shift < 64) {
+        unsigned char b = *p++;
+        r |= (scb_uint64) (b & 0x7f) << shift;
+        if ((b & 0x80) == 0) {
+            *v = r;
+            return p;
+        }
+        shift += 7;
+    }
+    return 0;
+}
+
+// Number of bytes of a value, apart from varints
+inline int
+scb_value_size( int kind, int width )
+{
+    switch (kind) {
+    case SCB_BITS:  return (width <= 64) ? 0 : (width + 7) / 8;
+    case SCB_LOGIC: return (width + 3) / 4;
+    default:        return 8;
+    }
+}
+
+//
+// scb_writer writes an SCB file.  The signals are declared with
+// add_signal(), then write_header() is called once.  For each cycle
+// in which signals change, begin_cycle() is called with its time,
+// then for each changed signal begin_change() returns room for its
+// value, which the caller writes and passes on to end_change(); then
+// end_cycle() is called.  Changes are collected per signal, and a
+// block is written whenever they reach the block size.
+//
+// If set_index() is called before write_header(), a snapshot of all
+// values is written to the index file after each block; blocks are
+// then also ended after snapshot_interval time units, if that is not
+// 0, so that no snapshot is further than that from any time.
+//
+
+class scb_writer {
+public:
+    scb_writer( FILE* fp, int block_size );
+    // Writes the pending changes and the end marker; does not close fp
+    ~scb_writer();
+
+    int add_signal( const char* name, int kind, int width );
+    // Does not take over index_fp either
+    void set_index( FILE* index_fp, scb_uint64 snapshot_interval );
+    void write_header( int time_unit_exponent );
+
+    void begin_cycle( scb_uint64 time );
+    unsigned char* begin_change( int signal, bool all_x, int value_size );
+    void end_change( int signal, unsigned char* end )
+    {
+        signals[signal].len = end - signals[signal].data;
+    }
+    void end_cycle();
+
+    // Shortcuts for values of SCB_BITS signals up to 64 bits, and of
+    // SCB_REAL signals
+    void put_bits( int signal, scb_uint64 v, bool all_x );
+    void put_real( int signal, double v );
+
+    // Writes the pending changes as a block
+    void flush();
+
+    // Bytes written to the file so far
+    scb_uint64 file_size() const { return bytes_written; }
+
+private:
+    struct signal_info {
+        char* name;
+        int kind;
+        int width;
+        unsigned char* data;    // changes in the current block
+        int len;
+        int cap;
+        int n_changes;
+        int last_cycle;
+        int last_change;        // offset of the last change in data
+        unsigned char* snap;    // value at the end of the last block
+        int snap_len;
+        int snap_cap;
+        bool snap_x;
+        scb_uint64 snap_time;   // of its change
+    };
+
+    void write_bytes( const unsigned char* p, int n );
+    void write_snapshot();
+
+    FILE* fp;
+    FILE* index_fp;
+    scb_uint64 snapshot_interval;
+    int block_size;
+    signal_info* signals;
+    int n_signals;
+    int n_alloc;
+
+    scb_uint64* times;          // of the cycles in the current block
+    int n_times;
+    int times_alloc;
+    scb_uint64 last_time;       // of the previous block
+    int block_bytes;            // of changes in the current block
+
+    unsigned char* raw;         // block being written
+    int raw_alloc;
+    unsigned char* packed;
+    int packed_alloc;
+    scb_uint64 bytes_written;
+    bool started;               // = 1 means the header is written
+
+private:
+    // Disabled
+    scb_writer( const scb_writer& );
+    void operator=( const scb_writer& );
+};
+
+//
+// A value change as returned by scb_reader.  value points to the value
+// as stored (see above) and stays valid until the next call of
+// next_change(); for SCB_BITS signals up to 64 bits, bits holds the
+// value.
+//
+
+struct scb_change {
+    scb_uint64 time;
+    int signal;
+    bool all_x;
+    const unsigned char* value;
+    scb_uint64 bits;
+};
+
+struct scb_signal {
+    char* name;
+    int kind;
+    int width;
+};
+
+//
+// scb_reader reads an SCB file and returns its value changes in time
+// order; the changes of a cycle come in increasing signal order.
+//
+
+class scb_reader {
+public:
+    scb_reader();
+    ~scb_reader();
+
+    // Opens the file and reads the header; returns false and sets
+    // error() on failure.
+    bool open( const char* file_name );
+    void close();
+
+    int time_unit_exponent() const { return time_unit; }
+    int num_signals() const { return n_signals; }
+    const scb_signal& signal( int i ) const { return signals[i]; }
+
+    // Returns false at the end of the file, or on error
+    bool next_change( scb_change* c );
+
+    // Reads the snapshots of the index file of the open SCB file
+    bool open_index( const char* file_name );
+
+    // Positions the reader at time t, using the index: value() then
+    // returns the values at t, and next_change() the changes after t.
+    // Afterwards value() follows the changes next_change() returns.
+    bool seek( scb_uint64 t );
+    const scb_change& value( int i ) const { return values[i]; }
+
+    // 0 if there was no error
+    const char* error() const { return err; }
+
+private:
+    struct event {
+        int cycle;
+        int signal;
+        bool all_x;
+        const unsigned char* value;
+        scb_uint64 bits;
+    };
+
+    struct snapshot {
+        scb_uint64 time;
+        scb_uint64 offset;      // of the block in the SCB file
+        scb_uint64 position;    // of the values in the index file
+        int raw_len;
+        int stored_len;
+    };
+
+    bool read_varint( FILE* f, scb_uint64* v );
+    bool read_block();
+    bool parse_block( int n );
+    bool read_snapshot( const snapshot& s );
+    void set_value( int signal, scb_uint64 time, bool all_x,
+                    const unsigned char* value, scb_uint64 bits );
+    void close_index();
+    bool fail( const char* msg );
+
+    FILE* fp;
+    const char* err;
+    int time_unit;
+    scb_signal* signals;
+    int n_signals;
+
+    unsigned char* raw;
+    int raw_alloc;
+    unsigned char* packed;
+    int packed_alloc;
+
+    scb_uint64* times;
+    int n_times;
+    int times_alloc;
+    scb_uint64 last_time;
+    event* events;              // of the current block, in time order
+    int n_events;
+    int events_alloc;
+    int next_event;
+    event* unsorted;            // as read from the block
+    int unsorted_alloc;
+    int* cycle_start;
+    bool at_end;
+
+    FILE* index_fp;
+    snapshot* snapshots;
+    int n_snapshots;
+    int snapshots_alloc;
+    scb_change* values;         // of all signals, if there is an index
+    unsigned char** value_data;
+
+private:
+    // Disabled
+    scb_reader( const scb_reader& );
+    void operator=( const scb_reader& );
+};
+
+// The value of a change as VCD characters 0, 1, x, z, most significant
+// first; bits must have room for the width of the signal.  Not for
+// SCB_REAL signals.
+extern void scb_value_chars( const scb_signal& s, const scb_change& c, char* bits );
+
+// The value of a change of an SCB_REAL signal
+extern double scb_value_real( const scb_change& c );
+
+// Converts an SCB file to VCD; returns 0 on success, or prints an error
+// message and returns -1.
+extern int scb_to_vcd( const char* scb_name, const char* vcd_name );
+
+#endif
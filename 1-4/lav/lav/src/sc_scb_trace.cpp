@@ -0,0 +1,727 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_scb_trace.cpp -- Tracing to SCB binary waveform files.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __BCPLUSPLUS__
+#pragma hdrstop
+#endif
+#include "sc_string.h"
+#include "sc_logic.h"
+#include "sc_logic_vector.h"
+
+#include "sc_bool_vector.h"
+#include "sc_scb_trace.h"
+#include "sc_simcontext.h"
+#include "sc_trace_registry.h"
+#include "numeric_bit/numeric_bit.h"
+#include "sc_resolved.h"
+
+static void
+scb_put_error_message(const char* msg, bool just_warning)
+{
+    if(just_warning){
+        fprintf(stderr, "SCB Trace Warning:\n%s\n\n", msg);
+    }
+    else{
+        fprintf(stderr, "SCB Trace ERROR:\n%s\n\n", msg);
+    }
+}
+
+// 2-bit SCB_LOGIC code of an sc_logic character, mapped as for VCD
+static inline unsigned
+scb_logic_code(char c)
+{
+    switch(c){
+        case '0':
+        case 'L':
+            return 0;
+        case '1':
+        case 'H':
+            return 1;
+        case 'Z':
+            return 3;
+        default:
+            return 2;
+    }
+}
+
+// Writes the bits object[width-1] ... object[0] as an SCB_BITS value
+template< class T >
+static void
+scb_put_bit_vector(scb_writer& w, int signal, const T& object, int width)
+{
+    if (width <= 64) {
+        scb_uint64 v = 0;
+        for (int i = width - 1; i >= 0; --i)
+            v = (v << 1) | ((object)[i] ? 1 : 0);
+        w.put_bits(signal, v, false);
+        return;
+    }
+    unsigned char* p = w.begin_change(signal, false, (width + 7) / 8);
+    unsigned acc = 0;
+    int n = 0;
+    for (int i = width - 1; i >= 0; --i) {
+        acc = (acc << 1) | ((object)[i] ? 1 : 0);
+        if (++n == 8) {
+            *p++ = (unsigned char) acc;
+            acc = 0;
+            n = 0;
+        }
+    }
+    if (n != 0)
+        *p++ = (unsigned char) (acc << (8 - n));
+    w.end_change(signal, p);
+}
+
+// The 8 bits of buf, of n digit_types, from bit lo on
+static inline unsigned
+scb_packed_byte(const digit_type* buf, int n, int lo)
+{
+    int k = lo / BITS_PER_DIGIT_TYPE;
+    int o = lo % BITS_PER_DIGIT_TYPE;
+    digit_type d = buf[k] >> o;
+    if (o > (int) BITS_PER_DIGIT_TYPE - 8 && k + 1 < n)
+        d |= buf[k + 1] << (BITS_PER_DIGIT_TYPE - o);
+    return (unsigned) (d & 0xff);
+}
+
+// sc_unsigned and sc_signed are read from their packed representation
+// instead of a bit at a time
+template< class T >
+static void
+scb_put_packed_vector(scb_writer& w, int signal, const T& object, int width)
+{
+    const int n = (width - 1) / BITS_PER_DIGIT_TYPE + 1;
+    digit_type small[8];
+    digit_type* buf = (n <= 8) ? small : new digit_type[n];
+    object.get_packed_rep(buf);
+
+    if (width <= 64) {
+        scb_uint64 v = 0;
+        for (int lo = 0; lo < width; lo += 8)
+            v |= (scb_uint64) scb_packed_byte(buf, n, lo) << lo;
+        if (width < 64)
+            v &= ((scb_uint64) 1 << width) - 1;
+        w.put_bits(signal, v, false);
+    }
+    else {
+        unsigned char* p = w.begin_change(signal, false, (width + 7) / 8);
+        int lo;
+        for (lo = width - 8; lo >= 0; lo -= 8)
+            *p++ = (unsigned char) scb_packed_byte(buf, n, lo);
+        if (lo > -8)
+            *p++ = (unsigned char) (scb_packed_byte(buf, n, 0) << -lo);
+        w.end_change(signal, p);
+    }
+    if (buf != small)
+        delete[] buf;
+}
+
+static void
+scb_put_bit_vector(scb_writer& w, int signal, const sc_unsigned& object, int width)
+{
+    scb_put_packed_vector(w, signal, object, width);
+}
+
+static void
+scb_put_bit_vector(scb_writer& w, int signal, const sc_signed& object, int width)
+{
+    scb_put_packed_vector(w, signal, object, width);
+}
+
+static inline scb_uint64
+scb_mask(int width)
+{
+    return (width >= 64) ? ~(scb_uint64) 0 : (((scb_uint64) 1 << width) - 1);
+}
+
+// sc_uint_base and sc_int_base are written from their number
+static void
+scb_put_bit_vector(scb_writer& w, int signal, const sc_uint_base& object, int width)
+{
+    w.put_bits(signal, (scb_uint64) object.num & scb_mask(width), false);
+}
+
+static void
+scb_put_bit_vector(scb_writer& w, int signal, const sc_int_base& object, int width)
+{
+    w.put_bits(signal, (scb_uint64) object.num & scb_mask(width), false);
+}
+
+// Writes the values object[width-1] ... object[0] of an
+// sc_logic_vector as an SCB_LOGIC value
+template< class T >
+static void
+scb_put_logic_vector(scb_writer& w, int signal, const T& object, int width)
+{
+    unsigned char* p = w.begin_change(signal, false, (width + 3) / 4);
+    unsigned acc = 0;
+    int n = 0;
+    for (int i = width - 1; i >= 0; --i) {
+        acc = (acc << 2) | scb_logic_code((object)[i].to_char());
+        if (++n == 4) {
+            *p++ = (unsigned char) acc;
+            acc = 0;
+            n = 0;
+        }
+    }
+    if (n != 0)
+        *p++ = (unsigned char) (acc << (8 - 2 * n));
+    w.end_change(signal, p);
+}
+
+
+/*****************************************************************************/
+
+// Base class for the traces
+class scb_trace {
+public:
+    scb_trace(const sc_string& _name, int _kind)
+        : name(_name), kind(_kind), width(0), signal(-1)
+    { }
+    virtual ~scb_trace();
+
+    // Vectors may only know their width when tracing begins
+    virtual void set_width();
+
+    virtual bool changed() = 0;
+
+    // Writes the current value and remembers it for changed()
+    virtual void write(scb_writer& w) = 0;
+
+    const sc_string name;
+    int kind;                   // scb_kind
+    int width;
+    int signal;                 // in the file, set by initialize()
+};
+
+scb_trace::~scb_trace()
+{
+}
+
+void scb_trace::set_width()
+{
+  /* Intentionally Blank, should be defined for each type separately */
+}
+
+
+/*****************************************************************************/
+
+// Encoders of the kinds of values (see sc_trace_value.h)
+
+static inline int scb_signal_kind(sc_trace_logic) { return SCB_LOGIC; }
+static inline int scb_signal_kind(sc_trace_logics) { return SCB_LOGIC; }
+static inline int scb_signal_kind(sc_trace_real) { return SCB_REAL; }
+template< class K >
+inline int scb_signal_kind(K) { return SCB_BITS; }
+
+// Integer values are at most 64 bits wide, however wide they are
+// traced
+static inline int scb_width(int width, sc_trace_integer) { return (width < 64) ? width : 64; }
+template< class K >
+inline int scb_width(int width, K) { return width; }
+
+template< class T >
+inline void
+scb_put_value(scb_trace& t, scb_writer& w, const T& object, sc_trace_bit)
+{
+    w.put_bits(t.signal, object ? 1 : 0, false);
+}
+
+template< class T >
+inline void
+scb_put_value(scb_trace& t, scb_writer& w, const T& object, sc_trace_logic)
+{
+    unsigned char* p = w.begin_change(t.signal, false, 1);
+    *p++ = (unsigned char) (scb_logic_code(object.to_char()) << 6);
+    w.end_change(t.signal, p);
+}
+
+template< class T >
+inline void
+scb_put_value(scb_trace& t, scb_writer& w, const T& object, sc_trace_bits)
+{
+    scb_put_bit_vector(w, t.signal, object, t.width);
+}
+
+template< class T >
+inline void
+scb_put_value(scb_trace& t, scb_writer& w, const T& object, sc_trace_logics)
+{
+    scb_put_logic_vector(w, t.signal, object, t.width);
+}
+
+// Values that do not fit into the width are written as x
+template< class T >
+inline void
+scb_put_value(scb_trace& t, scb_writer& w, const T& object, sc_trace_integer)
+{
+    unsigned long v;
+    bool fits = sc_trace_get_integer(object, t.width, v);
+    w.put_bits(t.signal, v, !fits);
+}
+
+template< class T >
+inline void
+scb_put_value(scb_trace& t, scb_writer& w, const T& object, sc_trace_real)
+{
+    w.put_real(t.signal, sc_trace_to_double(object));
+}
+
+// The trace of an object of any traced type; enumerated objects are
+// traced as integers
+template< class T >
+class scb_typed_trace : public scb_trace {
+public:
+    typedef typename sc_trace_traits<T>::kind kind_type;
+
+    scb_typed_trace(const T& _object, const sc_string& _name, int _width = 1)
+        : scb_trace(_name, scb_signal_kind(kind_type())), value(_object)
+    {
+        width = scb_width(sc_trace_width(_object, _width), kind_type());
+    }
+
+    bool changed() { return value.changed(); }
+
+    void write(scb_writer& w)
+    {
+        scb_put_value(*this, w, value.object, kind_type());
+        value.update_old();
+    }
+
+    // Vectors may have been resized since they were traced
+    void set_width() { width = scb_width(sc_trace_width(value.object, width), kind_type()); }
+
+protected:
+    sc_trace_value<T> value;
+};
+
+
+/**************************************************************************************************
+           scb_trace_file functions
+***************************************************************************************************/
+
+
+scb_trace_file::scb_trace_file(const char *name)
+{
+    sc_string file_name = name ;
+    file_name += ".scb";
+    fp = fopen((const char *) file_name, "wb");
+    if (!fp) {
+        sc_string msg = sc_string("Cannot write trace file '") + file_name + "'";
+        fprintf(stderr, "FATAL: %s\n", (const char *) msg);
+        exit(1);
+    }
+    writer = 0;
+    index_name = sc_string(name) + ".scbi";
+    index_fp = 0;
+    write_index = true;
+    snapshot_interval = 0;
+    trace_delta_cycles = false; // Make this the default
+    initialized = false;
+    block_size = default_block_size;
+
+    //default timestep = 1 sec
+    time_unit = 0;
+    timescale_unit = 1;
+    timescale_set_by_user = false;
+    previous_time = 0;
+}
+
+scb_trace_file::~scb_trace_file()
+{
+    // Writes the pending changes
+    delete writer;
+    for (int i = 0; i < traces.size(); i++)
+        delete traces[i];
+    fclose(fp);
+    if (index_fp)
+        fclose(index_fp);
+}
+
+void scb_trace_file::sc_set_scb_time_unit(int exponent10_seconds)
+{
+    if(initialized){
+        scb_put_error_message("SCB trace timescale unit cannot be changed once tracing has begun.\n"
+                              "To change the scale, create a new trace file.",
+                              false);
+        return;
+    }
+    if(exponent10_seconds < -15 || exponent10_seconds >  2){
+        scb_put_error_message("set_scb_time_unit() has valid exponent range -15...+2.", false);
+        return;
+    }
+    time_unit = exponent10_seconds;
+    timescale_unit = 1;
+    for (int i = exponent10_seconds; i < 0; i++)
+        timescale_unit /= 10;
+    for (int i = 0; i < exponent10_seconds; i++)
+        timescale_unit *= 10;
+    timescale_set_by_user = true;
+}
+
+void scb_trace_file::sc_set_scb_block_size(int bytes)
+{
+    if(initialized){
+        scb_put_error_message("SCB block size cannot be changed once tracing has begun.", false);
+        return;
+    }
+    block_size = bytes;
+}
+
+void scb_trace_file::sc_set_scb_index(bool flag)
+{
+    if(initialized){
+        scb_put_error_message("SCB index cannot be switched once tracing has begun.", false);
+        return;
+    }
+    write_index = flag;
+}
+
+void scb_trace_file::sc_set_scb_snapshot_interval(double interval)
+{
+    if(initialized){
+        scb_put_error_message("SCB snapshot interval cannot be changed once tracing has begun.", false);
+        return;
+    }
+    snapshot_interval = interval;
+}
+
+void scb_trace_file::add_trace(scb_trace* t)
+{
+    if(initialized){
+        scb_put_error_message("No traces can be added once simulation has started.\n"
+                              "To add traces, create a new SCB trace file.", false);
+        delete t;
+        return;
+    }
+    traces.push_back(t);
+}
+
+void scb_trace_file::trace(const bool& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<bool>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const sc_logic& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_logic>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const sc_bool_vector& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_bool_vector>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const sc_logic_vector& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_logic_vector>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const unsigned char& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<unsigned char>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const unsigned short& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<unsigned short>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const unsigned int& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<unsigned int>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const unsigned long& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<unsigned long>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const char& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<char>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const short& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<short>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const int& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<int>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const long& object, const sc_string& name, int width)
+{
+    add_trace(new scb_typed_trace<long>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const float& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<float>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const double& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<double>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const sc_signal_bool_vector& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_bool_vector>((const sc_bool_vector&) object, name));
+    sc_share_trace(this, (const sc_bool_vector&) object);
+}
+
+void scb_trace_file::trace(const sc_signal_logic_vector& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
+}
+
+void scb_trace_file::trace(const sc_uint_base& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_uint_base>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const sc_int_base& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_int_base>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const sc_unsigned& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_unsigned>(object, name));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::trace(const sc_signed& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_signed>(object, name));
+    sc_share_trace(this, object);
+}
+
+#ifdef SC_INCLUDE_FX
+
+void scb_trace_file::trace(const sc_fxval& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_fxval>(object, name));
+}
+
+void scb_trace_file::trace(const sc_fxval_fast& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_fxval_fast>(object, name));
+}
+
+void scb_trace_file::trace(const sc_fxnum& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_fxnum>(object, name));
+}
+
+void scb_trace_file::trace(const sc_fxnum_fast& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_fxnum_fast>(object, name));
+}
+
+#endif
+
+void scb_trace_file::trace(const sc_signal_resolved& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_logic>((const sc_logic&) *(object.get_data_ptr()), name));
+    sc_share_trace(this, (const sc_logic&) *(object.get_data_ptr()));
+}
+
+void scb_trace_file::trace(const sc_signal_resolved_vector& object, const sc_string& name)
+{
+    add_trace(new scb_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
+}
+
+void scb_trace_file::trace(const unsigned& object, const sc_string& name, const char** enum_literals)
+{
+    // Number of bits required to represent the number of literals
+    int nliterals;
+    for (nliterals = 0; enum_literals[nliterals]; nliterals++);
+    int width = 0;
+    for (unsigned shifted_maxindex = nliterals - 1; shifted_maxindex != 0; shifted_maxindex >>= 1)
+        width++;
+    add_trace(new scb_typed_trace<unsigned>(object, name, width));
+    sc_share_trace(this, object);
+}
+
+void scb_trace_file::write_comment(const sc_string&)
+{
+    /* Intentionally blank */
+}
+
+void scb_trace_file::delta_cycles(bool flag)
+{
+    trace_delta_cycles = flag;
+}
+
+int scb_trace_file::num_traces() const
+{
+    return traces.size();
+}
+
+const char* scb_trace_file::trace_name(int i) const
+{
+    return (const char *) traces[i]->name;
+}
+
+scb_uint64 scb_trace_file::now_units() const
+{
+    unsigned high, low;
+    double_to_special_int64(sc_simulation_time() / timescale_unit, &high, &low);
+    return (scb_uint64) high * 1000000000 + low;
+}
+
+void scb_trace_file::initialize()
+{
+    if(timescale_set_by_user == false && getenv("SCENIC_REGRESSION") == NULL) {
+        fprintf(stderr,"WARNING: Default time step (1 s) is used for SCB tracing.\n");
+    }
+
+    writer = new scb_writer(fp, block_size);
+    if (write_index) {
+        index_fp = fopen((const char *) index_name, "wb");
+        if (index_fp) {
+            writer->set_index(index_fp, (scb_uint64) (snapshot_interval / timescale_unit));
+        }
+        else {
+            sc_string msg = sc_string("Cannot write index file '") + index_name + "'";
+            scb_put_error_message((const char *) msg, true);
+        }
+    }
+    int i;
+    for (i = 0; i < traces.size(); i++) {
+        scb_trace* t = traces[i];
+        t->set_width(); // needed for all vectors
+        t->signal = writer->add_signal((const char *) t->name, t->kind, t->width);
+    }
+    writer->write_header(time_unit);
+
+    init_change_detection(traces.size());
+
+    // All initial values
+    previous_time = now_units();
+    writer->begin_cycle(previous_time);
+    for (i = 0; i < traces.size(); i++)
+        traces[i]->write(*writer);
+    writer->end_cycle();
+}
+
+void scb_trace_file::cycle(bool this_is_a_delta_cycle)
+{
+    // Trace delta cycles only when enabled
+    if (!trace_delta_cycles && this_is_a_delta_cycle) return;
+
+    // Check for initialization
+    if (!initialized) {
+        initialize();
+        initialized = true;
+        return;
+    };
+
+    // Cycles with falling time are not written; delta cycles get the
+    // time of the cycle they follow.
+    scb_uint64 now = now_units();
+    if (now < previous_time)
+        return;
+
+    bool time_written = false;
+    scb_trace* const* const l_traces = traces.raw_data();
+    const int* const l_candidates = candidates();
+    const int n_candidates = num_candidates();
+    for (int k = 0; k < n_candidates; k++) {
+        scb_trace* t = l_traces[l_candidates[k]];
+        if (t->changed()) {
+            if (!time_written) {
+                writer->begin_cycle(now);
+                time_written = true;
+            }
+            t->write(*writer);
+        }
+    }
+    // Traces just enabled again
+    const int* const l_forced = forced();
+    const int n_forced = num_forced();
+    for (int k = 0; k < n_forced; k++) {
+        if (!time_written) {
+            writer->begin_cycle(now);
+            time_written = true;
+        }
+        l_traces[l_forced[k]]->write(*writer);
+    }
+    clear_dirty();
+
+    if (time_written) {
+        writer->end_cycle();
+        previous_time = now;
+    }
+}
+
+
+sc_trace_file *sc_create_scb_trace_file(const char * name)
+{
+    sc_trace_file *tf;
+
+    tf = new scb_trace_file(name);
+    sc_get_curr_simcontext()->add_trace_file(tf);
+    return tf;
+}
+
+void sc_close_scb_trace_file( sc_trace_file* tf )
+{
+    scb_trace_file* scb_tf = (scb_trace_file*)tf;
+    delete scb_tf;
+}
@@ -0,0 +1,217 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_scb_trace.h -- Tracing to SCB binary waveform files.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+/********************************************************************
+
+  SCB files (see sc_scb.h) hold the same information as VCD files in
+  a fraction of the space: times are delta-coded varints, value
+  changes are grouped per signal in blocks, and each block is
+  compressed.  Values are stored as bits rather than formatted as
+  text.  scb2vcd converts SCB files to VCD.
+
+  An index with snapshots of all values is written to the sidecar
+  file `.scbi', so that viewers can start at any time without reading
+  the trace from the beginning (scb_reader::seek()).
+
+  Comments are not stored.
+
+********************************************************************/
+
+#ifndef SC_SCB_TRACE_H
+#define SC_SCB_TRACE_H
+
+#include <stdio.h>
+#include "sc_trace.h"
+#include "sc_vector.h"
+#include "sc_scb.h"
+
+class scb_trace;  // defined in sc_scb_trace.cpp
+
+
+class scb_trace_file : public sc_trace_file {
+public:
+    void sc_set_scb_time_unit(int exponent10_seconds); // -7 -> 100ns
+
+    // Changes are compressed and written in blocks of about this
+    // many bytes; larger blocks compress better.  The default is
+    // default_block_size.
+    void sc_set_scb_block_size(int bytes);
+    enum { default_block_size = 1 << 20 };
+
+    // Write the `.scbi' index file (default: true).  Snapshots are
+    // taken after each block, and, if interval is not 0, at least
+    // every interval units of simulation time.
+    void sc_set_scb_index(bool flag);
+    void sc_set_scb_snapshot_interval(double interval);
+
+    // Create an SCB trace file.
+    // `Name' forms the base of the name to which `.scb' is added.
+    scb_trace_file(const char *name);
+
+    // Flush results and close file.
+    ~scb_trace_file();
+
+protected:
+    // These are all virtual functions in sc_trace_file and
+    // they need to be defined here.
+
+    // Trace a boolean object (single bit)
+     void trace(const bool& object, const sc_string& name);
+
+    // Trace a sc_logic object (single bit)
+     void trace(const sc_logic& object, const sc_string& name);
+
+    // Trace a sc_bool_vector
+     void trace(const sc_bool_vector& object, const sc_string& name);
+
+    // Trace a sc_logic_vector
+     void trace(const sc_logic_vector& object, const sc_string& name);
+    
+    // Trace an unsigned char with the given width
+     void trace(const unsigned char& object, const sc_string& name, int width);
+
+    // Trace an unsigned short with the given width
+     void trace(const unsigned short& object, const sc_string& name, int width);
+
+    // Trace an unsigned int with the given width
+     void trace(const unsigned int& object, const sc_string& name, int width);
+
+    // Trace an unsigned long with the given width
+     void trace(const unsigned long& object, const sc_string& name, int width);
+
+    // Trace a signed char with the given width
+     void trace(const char& object, const sc_string& name, int width);
+
+    // Trace a signed short with the given width
+     void trace(const short& object, const sc_string& name, int width);
+
+    // Trace a signed int with the given width
+     void trace(const int& object, const sc_string& name, int width);
+
+    // Trace a signed long with the given width
+     void trace(const long& object, const sc_string& name, int width);
+    
+    // Trace a float
+     void trace(const float& object, const sc_string& name);
+
+    // Trace a double
+     void trace(const double& object, const sc_string& name);
+
+    // Trace sc_signal<sc_bool_vector>
+     void trace(const sc_signal_bool_vector& object, const sc_string& name);
+
+    // Trace sc_signal<sc_logic_vector>
+     void trace(const sc_signal_logic_vector& object, const sc_string& name);
+
+    // Trace sc_uint_base
+     void trace (const sc_uint_base& object, const sc_string& name);
+
+    // Trace sc_int_base
+     void trace (const sc_int_base& object, const sc_string& name);
+
+    // Trace sc_unsigned
+     void trace (const sc_unsigned& object, const sc_string& name);
+
+    // Trace sc_signed
+     void trace (const sc_signed& object, const sc_string& name);
+
+#ifdef SC_INCLUDE_FX
+    // Trace sc_fxval
+    void trace( const sc_fxval& object, const sc_string& name );
+
+    // Trace sc_fxval_fast
+    void trace( const sc_fxval_fast& object, const sc_string& name );
+
+    // Trace sc_fxnum
+    void trace( const sc_fxnum& object, const sc_string& name );
+
+    // Trace sc_fxnum_fast
+    void trace( const sc_fxnum_fast& object, const sc_string& name );
+#endif
+
+    // Trace resolved signal
+     void trace (const sc_signal_resolved& object, const sc_string& name);
+
+    // Trace resolved signal vector
+     void trace (const sc_signal_resolved_vector& object, const sc_string& name);
+  
+    // Trace an enumerated object; the literals are not stored.
+     void trace(const unsigned& object, const sc_string& name, const char** enum_literals);
+
+    // Comments are not stored
+     void write_comment(const sc_string& comment);
+
+    // Also trace transitions between delta cycles if flag is true.
+     void delta_cycles(bool flag);
+
+    // Number of traces, for dirty-list change detection
+     int num_traces() const;
+
+    // Name of trace i, for enable() and disable()
+     const char* trace_name(int i) const;
+
+    // Write trace info for cycle.
+     void cycle(bool delta_cycle);
+    
+private:
+    // Initialize the tracing
+    void initialize();
+    // Add a trace, if tracing has not begun
+    void add_trace(scb_trace* t);
+    // Current time in time units
+    scb_uint64 now_units() const;
+    
+    // Array to store the variables traced
+    sc_pvector<scb_trace*> traces;
+    // Pointer to the file that needs to be written
+    FILE* fp;
+    scb_writer* writer;         // created by initialize()
+    sc_string index_name;
+    FILE* index_fp;             // opened by initialize()
+    bool write_index;
+    double snapshot_interval;   // in simulation time units
+
+    int time_unit;              // exponent of 10 seconds
+    double timescale_unit;      // in seconds
+    bool timescale_set_by_user; // = 1 means set by user
+    int block_size;
+    bool trace_delta_cycles;    // = 1 means trace the delta cycles
+    bool initialized;           // = 1 means initialized
+
+    scb_uint64 previous_time;   // of the last cycle written
+};
+
+// Create SCB file
+extern sc_trace_file *sc_create_scb_trace_file(const char* name);
+extern void sc_close_scb_trace_file( sc_trace_file* tf );
+
+#endif
@@ -66,6 +66,7 @@ using std::hex;
 #include "sc_logic.h"
 #include "sc_signal_array.h"
 #include "sc_simcontext.h"
+#include "sc_trace_registry.h"
 
 #include "sc_signal_optimize.h"
 
@@ -85,6 +86,7 @@ sc_signal_base::sc_signal_base( sc_object* from, bool add_to_simcontext )
 {
     submitted = false;
     created_by = from;
+    trace_hooks = 0;
     if (add_to_simcontext)
         simcontext()->add_signal(this);
     update_func = update_func_abort;
@@ -97,6 +99,7 @@ sc_signal_base::sc_signal_base( const char* nm, sc_object* from,
 {
     submitted = false;
     created_by = from;
+    trace_hooks = 0;
     if (add_to_simcontext)
         simcontext()->add_signal(this);
     update_func = update_func_abort;
@@ -105,7 +108,29 @@ sc_signal_base::sc_signal_base( const char* nm, sc_object* from,
 
 sc_signal_base::~sc_signal_base()
 {
-    /* Intentionally blank */
+    while (trace_hooks != 0) {
+        sc_trace_hook* h = trace_hooks;
+        trace_hooks = h->next;
+        if (h->file != 0)
+            h->file->unwatch( h->index );
+        else
+            h->registry->unwatch( h->index );
+        delete h;
+    }
+}
+
+/* Puts the traces of this signal on the dirty lists of their files,
+   or of the trace registry; called by the kernel after the signal has
+   been updated. */
+void
+sc_signal_base::trace_updated() const
+{
+    for (sc_trace_hook* h = trace_hooks; h != 0; h = h->next) {
+        if (h->file != 0)
+            h->file->mark_dirty( h->index );
+        else
+            h->registry->mark_dirty( h->index );
+    }
 }
 
 void
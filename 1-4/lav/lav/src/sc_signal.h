@@ -52,6 +52,7 @@ class sc_sync;
 class sc_async;
 class sc_aproc;
 class sc_module;
+class sc_signal_group;
 
 #define SC_SIGNAL_PROP_NONE      0
 #define SC_SIGNAL_PROP_ASYNC     (1U<<0)
@@ -78,6 +79,9 @@ class sc_signal_base : public sc_object
     friend class sc_aproc_process;
     friend class sc_simcontext;
     friend class sc_signal_optimize;
+    friend class sc_signal_group;
+    friend class sc_trace_file;
+    friend class sc_trace_registry;
 
 public:
     typedef void (*UPDATE_FUNC)(sc_signal_base*);
@@ -145,6 +149,11 @@ protected:
     mutable sc_pvector<sc_async_process_handle> sensitive_asyncs;
     mutable sc_pvector<sc_aproc_process_handle> sensitive_aprocs;
 
+    /* Traces of this signal that are checked for changes only after
+       it is updated; see sc_trace_file::watch_signal(). */
+    mutable sc_trace_hook* trace_hooks;
+    void trace_updated() const;
+
 private:
         // Prevent use of copy constructor.  This constructor has no
         // implementation.
@@ -166,6 +175,7 @@ template< class T > class sc_signal : public sc_signal_base
 {
     friend class sc_clock;
     friend class sc_clock_edge;
+    friend class sc_signal_group;
 
 public:
         // Constructors
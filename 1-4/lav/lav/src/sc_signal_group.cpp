@@ -0,0 +1,197 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_signal_group.cpp - Groups of signals that are written together and
+                          share a single slot in the update queue.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#include <stdlib.h>
+#ifndef _MSC_VER
+#include <iostream>
+using std::ostream;
+using std::cerr;
+using std::endl;
+#else
+// MSVC6.0 has bugs in standard library
+#include <iostream.h>
+#endif
+#include <assert.h>
+
+#include "sc_signal_group.h"
+#include "sc_simcontext.h"
+
+const char* sc_signal_group::kind_string = "sc_signal_group";
+
+sc_signal_group::sc_signal_group()
+    : sc_signal_base(this)
+{
+    pending = committed = 0;
+    lastof_pending = lastof_committed = -1;
+    n_alloc = 0;
+    update_func = &sc_signal_group::update_group;
+}
+
+sc_signal_group::sc_signal_group( const char* nm )
+    : sc_signal_base(nm, this)
+{
+    pending = committed = 0;
+    lastof_pending = lastof_committed = -1;
+    n_alloc = 0;
+    update_func = &sc_signal_group::update_group;
+}
+
+sc_signal_group::~sc_signal_group()
+{
+    delete[] pending;
+    delete[] committed;
+}
+
+const char*
+sc_signal_group::kind() const
+{
+    return kind_string;
+}
+
+void
+sc_signal_group::add_member( sc_signal_base* sig )
+{
+    if (simcontext()->is_running()) {
+        cerr << "Signal groups may not be extended after simulation has started." << endl;
+        assert( false );
+    }
+
+    for (int i = 0; i < members.size(); ++i) {
+        /* Already a member? */
+        if (sig == members[i])
+            return;
+    }
+    members.push_back(sig);
+
+    /* Each member is written at most once per delta cycle, so the
+       pending and committed arrays never need more slots than there
+       are members. */
+    if (members.size() > n_alloc) {
+        n_alloc += 8;
+        sc_signal_base** new_pending = new sc_signal_base*[n_alloc];
+        for (int i = 0; i <= lastof_pending; ++i)
+            new_pending[i] = pending[i];
+        delete[] pending;
+        pending = new_pending;
+
+        assert( lastof_committed == -1 );
+        delete[] committed;
+        committed = new sc_signal_base*[n_alloc];
+    }
+}
+
+void
+sc_signal_group::check_member( const sc_signal_base* sig ) const
+{
+    for (int i = 0; i < members.size(); ++i) {
+        if (sig == members[i])
+            return;
+    }
+    cerr << "Signal written through group `" << name()
+         << "' is not a member of the group." << endl;
+    assert( false );
+}
+
+/* Moves the members written in this delta cycle to the committed
+   array, and recycles the committed array for the next delta cycle. */
+void
+sc_signal_group::commit_pending()
+{
+    assert( lastof_committed == -1 );
+    sc_signal_base** tmp = committed;
+    committed = pending;
+    lastof_committed = lastof_pending;
+    pending = tmp;
+    lastof_pending = -1;
+}
+
+/* The kernel's update function for a group; this is the only work
+   the update queue does for all the members written through it. */
+void
+sc_signal_group::update_group(sc_signal_base* me)
+{
+    sc_signal_group* const g = static_cast<sc_signal_group*>(me);
+    g->commit_pending();
+
+    int i = g->lastof_committed;
+    if (i >= 0) {
+        sc_signal_base* const* const l_committed = g->committed;
+        do {
+            sc_signal_base* const sig = l_committed[i];
+            (*sig->update_func)(sig);
+            sig->set_submitted( false );
+            if (sig->trace_hooks != 0)
+                sig->trace_updated();
+        } while (--i >= 0);
+        g->add_dependent_procs_to_queue_default();
+    }
+}
+
+/* Used by sc_simcontext::initial_crunch(), which updates signals
+   through the virtual interface. */
+void
+sc_signal_group::update()
+{
+    commit_pending();
+
+    for (int i = lastof_committed; i >= 0; --i) {
+        sc_signal_base* const sig = committed[i];
+        sig->update();
+        sig->set_submitted( false );
+    }
+    add_dependent_procs_to_queue_default();
+}
+
+void
+sc_signal_group::update_old()
+{
+    for (int i = lastof_committed; i >= 0; --i) {
+        committed[i]->update_old();
+    }
+    lastof_committed = -1;
+}
+
+sc_signal_base::UPDATE_FUNC*
+sc_signal_group::update_funcs_array() const
+{
+    /* Sensitivity to the group itself is handled by update_group(),
+       whatever kinds of processes are sensitive to it. */
+    static UPDATE_FUNC funcs[] = {
+        &sc_signal_group::update_group,
+        &sc_signal_group::update_group,
+        &sc_signal_group::update_group,
+        &sc_signal_group::update_group
+    };
+    return funcs;
+}
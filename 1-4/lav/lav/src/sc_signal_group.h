@@ -0,0 +1,137 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_signal_group.h - Groups of signals that are written together and
+                        share a single slot in the update queue.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#ifndef SC_SIGNAL_GROUP_H
+#define SC_SIGNAL_GROUP_H
+
+#include "sc_signal.h"
+
+//
+// A signal group bundles the fields of a multi-field interface
+// (address, data, strobes, valid, ...).  Members are declared once,
+// before simulation starts, with add().  Writing a member through
+// the group bypasses sc_signal<T>::write() and the per-signal
+// submit_update(); instead the group itself is submitted once per
+// delta cycle, and its update function commits every member written
+// in that delta cycle in a single pass.
+//
+// Members remain ordinary signals: they may still be read, traced,
+// and written directly, and processes may be sensitive to them.
+// Processes may also be made sensitive to the group itself, in which
+// case they are triggered at most once per delta cycle, no matter
+// how many members changed.
+//
+// Supported member types are the generic sc_signal<T> and its
+// bool, unsigned and sc_logic specializations.
+//
+class sc_signal_group : public sc_signal_base
+{
+public:
+        // Constructors
+    sc_signal_group();
+    explicit sc_signal_group( const char* nm );
+
+        // Destructor
+    virtual ~sc_signal_group();
+
+        // Declares sig as a member of this group; must be called
+        // before simulation starts.
+    template< class T >
+    sc_signal_group& add( sc_signal<T>& sig )
+    {
+        add_member( &sig );
+        return *this;
+    }
+
+        // Writes nv to the member sig.  Nothing is submitted unless
+        // the value differs from the current value of sig.
+    template< class T >
+    sc_signal_group& write( sc_signal<T>& sig, const T& nv )
+    {
+#ifdef DEBUG_SYSTEMC
+        check_member( &sig );
+#endif
+        sig.new_value = nv;
+        if (!(sig.cur_value == nv))
+            mark( &sig );
+        return *this;
+    }
+
+    int size() const { return members.size(); }
+
+    static const char* kind_string;
+    virtual const char* kind() const;
+
+protected:
+    virtual void update();
+    virtual void update_old();
+    virtual UPDATE_FUNC* update_funcs_array() const;
+
+    static void update_group(sc_signal_base*);
+
+private:
+    void add_member( sc_signal_base* sig );
+    void check_member( const sc_signal_base* sig ) const;
+    void commit_pending();
+
+    void mark( sc_signal_base* sig )
+    {
+        /* A member that is already on some update queue (either on
+           its own or through this group) is committed anyway. */
+        if (! sig->is_submitted()) {
+            sig->set_submitted( true );
+            pending[++lastof_pending] = sig;
+            submit_update();
+        }
+    }
+
+    sc_pvector<sc_signal_base*> members;
+
+    /* Members written in the current delta cycle, and members
+       committed in the previous one whose old values are yet to be
+       updated.  The two arrays are swapped by update_group(). */
+    sc_signal_base** pending;
+    int lastof_pending;
+    sc_signal_base** committed;
+    int lastof_committed;
+    int n_alloc;
+
+private:
+        // Prevent use of copy constructor.  This constructor has no
+        // implementation.
+    sc_signal_group( const sc_signal_group& );
+    void operator=( const sc_signal_group& );
+};
+
+#endif
@@ -70,6 +70,7 @@ using std::hex;
 
 #include "sc_ver.h"
 #include "sc_trace.h"
+#include "sc_trace_registry.h"
 
 #include "sc_context_switch.h"
 
@@ -238,6 +239,7 @@ sc_simcontext::sc_simcontext()
     total_number_of_aprocs = 0;
 
     aa_process_table = new sc_async_aproc_process_table;
+    trace_registry = new sc_trace_registry;
     error_occurred = false;
 }
 
@@ -248,6 +250,7 @@ sc_simcontext::~sc_simcontext()
     delete prioq;
     for (int i = 0; i < trace_files.size(); ++i)
         delete trace_files[i];
+    delete trace_registry;
 
     delete[] signals_to_update_arrays[0];
     delete[] signals_to_update_arrays[1];
@@ -432,6 +435,8 @@ sc_simcontext::crunch()
                 sc_signal_base* sig = old_signals_to_update[i];
                 (*sig->update_func)(sig);
                 sig->set_submitted( false );
+                if (sig->trace_hooks != 0)
+                    sig->trace_updated();
             } while (--i >= 0);
         }
 
@@ -446,6 +451,8 @@ sc_simcontext::crunch()
                         sc_signal_base* const sig = l_signals_to_update[j];
                         (*sig->update_func)(sig);
                         sig->set_submitted( false );
+                        if (sig->trace_hooks != 0)
+                            sig->trace_updated();
                     } while (--j >= 0);
                 }
             } while (--i >= 0);
@@ -874,9 +881,13 @@ sc_simcontext::add_trace_file( sc_trace_file* tf )
 void
 sc_simcontext::trace_cycle( bool delta_cycle )
 {
+    if (trace_files.size() == 0)
+        return;
+    /* Objects traced in several files are checked once, here. */
+    trace_registry->detect();
     sc_trace_file* const* const l_trace_files = trace_files.raw_data();
     for (int i = trace_files.size() - 1; i >=0; --i) {
-        l_trace_files[i]->cycle( delta_cycle );
+        l_trace_files[i]->do_cycle( delta_cycle );
     }
 }
 
@@ -55,6 +55,7 @@ struct qt_t;
 class sc_port_manager;
 class sc_module;
 class sc_trace_file;
+class sc_trace_registry;
 class sc_array_concat_manager;
 class sc_object_manager;
 class sc_object;
@@ -111,6 +112,7 @@ public:
 
     void add_trace_file(sc_trace_file* tf);
     void trace_cycle(bool delta_cycle);
+    sc_trace_registry* get_trace_registry() { return trace_registry; }
 
     /* prepare for simulation - should be called after all objects have been
        instantiated */
@@ -207,6 +209,7 @@ private:
     int lastof_clock_edges_to_advance;
 
     sc_pvector<sc_trace_file*> trace_files;
+    sc_trace_registry* trace_registry;
 
     sc_signal_base** signals_to_update_arrays[2];
     int curr_array;
@@ -63,162 +63,182 @@ roundup( int n, int m )
 
 class sc_string_rep {
     friend class sc_string;
-    friend ostream& operator<<( ostream&, const sc_string& );
-    friend istream& operator>>( istream&, sc_string& );
-    friend sc_string operator+( const char*, const sc_string& );
 
-    sc_string_rep( int size = 16 )
+    sc_string_rep( int size )
     {
         ref_count = 1;
         alloc = roundup( size, 16 );
         str = new char[alloc];
-        *str = '\0';
     }
-    sc_string_rep( const char* s )
-    {
-        ref_count = 1;
-        if (s) {
-            alloc = 1 + strlen(s);
-            str = strcpy( new char[alloc], s );
-        }
-        else {
-            alloc = 16;
-            str = strcpy( new char[alloc], "" );
-        }
-    }
-    sc_string_rep( const char* s, int n); // get first n chars from the string
     ~sc_string_rep()
     {
         assert( ref_count == 0 );
         delete[] str;
     }
 
-    void resize( int new_size );
-    void set_string( const char* s );
-
     int ref_count;
     int alloc;
     char* str;
 };
 
-sc_string_rep::sc_string_rep( const char* s, int n)
+/* Sets up fresh, unshared storage with room for size chars; whatever
+   was owned before must have been released. */
+char*
+sc_string::init( int size )
 {
-    ref_count = 1;
-    if (s && n>0) {
-        alloc = 1 + n;
-        str = strncpy( new char[alloc], s,n );
-        str[n] = 00;
+    if (size <= SHORT_SIZE) {
+        rep = 0;
+        str = short_str;
     }
     else {
-        alloc = 16;
-        str = strcpy( new char[alloc], "" );
+        rep = new sc_string_rep(size);
+        str = rep->str;
     }
+    return str;
 }
 
 void
-sc_string_rep::resize( int new_size )
+sc_string::release()
 {
-    if (new_size <= alloc) return;
-    alloc = roundup( new_size, 16 );
-    char* new_str = strcpy( new char[alloc], str );
-    delete[] str;
-    str = new_str;
+    if (rep != 0 && --(rep->ref_count) == 0)
+        delete rep;
 }
 
-void
-sc_string_rep::set_string( const char* s )
+/* True if size chars can be written in place without affecting any
+   other string. */
+bool
+sc_string::writable( int size ) const
 {
-    int len = strlen(s);
-    resize( len + 1 );
-    strcpy( str, s );
+    if (rep == 0)
+        return (size <= SHORT_SIZE);
+    return (rep->ref_count == 1 && size <= rep->alloc);
+}
+
+int
+sc_string::capacity() const
+{
+    return (rep == 0) ? (int) SHORT_SIZE : rep->alloc;
 }
 
 sc_string::sc_string(int size)
 {
-    rep = new sc_string_rep(size);
+    *init(size) = '\0';
 }
 
 sc_string::sc_string( const char* s )
 {
-    rep = new sc_string_rep(s);
+    if (s == 0)
+        s = "";
+    int len = strlen(s);
+    memcpy( init(len + 1), s, len + 1 );
 }
 
 sc_string::sc_string( const char* s, int n )
 {
-    rep = new sc_string_rep(s,n);
+    if (s && n>0) {
+        strncpy( init(n + 1), s, n );
+        str[n] = 00;
+    }
+    else {
+        *init(1) = '\0';
+    }
 }
 
 sc_string::sc_string( const sc_string& s )
 {
     rep = s.rep;
-    rep->ref_count++;
+    if (rep != 0) {
+        rep->ref_count++;
+        str = rep->str;
+    }
+    else {
+        memcpy( short_str, s.short_str, SHORT_SIZE );
+        str = short_str;
+    }
 }
 
-sc_string::sc_string( sc_string_rep* r )
+sc_string::sc_string( const sc_string_view& v )
 {
-    rep = r;
+    int len = v.length();
+    memcpy( init(len + 1), v.data(), len );
+    str[len] = '\0';
 }
 
-sc_string::~sc_string()
+#ifdef SC_STRING_HAS_MOVE
+sc_string::sc_string( sc_string&& s )
 {
-    if (--(rep->ref_count) == 0)
-        delete rep;
+    rep = s.rep;
+    if (rep != 0) {
+        str = rep->str;
+        s.rep = 0;
+        s.str = s.short_str;
+        s.short_str[0] = '\0';
+    }
+    else {
+        memcpy( short_str, s.short_str, SHORT_SIZE );
+        str = short_str;
+    }
 }
+#endif
 
-int
-sc_string::length() const
+sc_string::~sc_string()
 {
-    return strlen(rep->str);
+    release();
 }
 
 sc_string
 sc_string::operator+( const char* s ) const
 {
     int len = length();
-    sc_string_rep* r = new sc_string_rep( len + strlen(s) + 1 );
-    strcpy( r->str, rep->str );
-    strcpy( r->str + len, s );
-    return sc_string(r);
+    int slen = strlen(s);
+    sc_string r( len + slen + 1 );
+    memcpy( r.str, str, len );
+    memcpy( r.str + len, s, slen + 1 );
+    return r;
 }
 sc_string sc_string::operator+(char c) const
 {
     int len = length();
-    sc_string_rep* r = new sc_string_rep( len + 2 );
-    strcpy( r->str, rep->str );
-    r->str[len] = c;
-    r->str[len+1] = 00;
-    return sc_string(r);
+    sc_string r( len + 2 );
+    memcpy( r.str, str, len );
+    r.str[len] = c;
+    r.str[len+1] = 00;
+    return r;
 }
 
 sc_string
 operator+( const char* s, const sc_string& t )
 {
     int len = strlen(s);
-    sc_string_rep* r = new sc_string_rep( len + t.length() + 1 );
-    strcpy( r->str, s );
-    strcpy( r->str + len, t );
-    return sc_string(r);
+    int tlen = t.length();
+    sc_string r( len + tlen + 1 );
+    memcpy( r.str, s, len );
+    memcpy( r.str + len, t.str, tlen + 1 );
+    return r;
 }
 
 sc_string
 sc_string::operator+( const sc_string& s ) const
 {
     int len = length();
-    sc_string_rep* r = new sc_string_rep( len + s.length() + 1 );
-    strcpy( r->str, rep->str );
-    strcpy( r->str + len, s.rep->str );
-    return sc_string(r);
+    int slen = s.length();
+    sc_string r( len + slen + 1 );
+    memcpy( r.str, str, len );
+    memcpy( r.str + len, s.str, slen + 1 );
+    return r;
 }
 
 sc_string&
 sc_string::operator=( const char* s )
 {
-    if (rep->ref_count > 1) {
-        --rep->ref_count;
-        rep = new sc_string_rep(s);
+    int len = strlen(s);
+    if (writable(len + 1)) {
+        memmove( str, s, len + 1 );
     }
     else {
-        rep->set_string(s);
+        /* s may point into our own storage; copy it first. */
+        sc_string t(s);
+        swap(t);
     }
     return *this;
 }
@@ -228,28 +248,64 @@ sc_string::operator=( const sc_string& s )
 {
     if (&s == this)
         return *this;
-    if (--(rep->ref_count) == 0)
-        delete rep;
+    release();
     rep = s.rep;
-    rep->ref_count++;
+    if (rep != 0) {
+        rep->ref_count++;
+        str = rep->str;
+    }
+    else {
+        memcpy( short_str, s.short_str, SHORT_SIZE );
+        str = short_str;
+    }
+    return *this;
+}
+
+#ifdef SC_STRING_HAS_MOVE
+sc_string&
+sc_string::operator=( sc_string&& s )
+{
+    if (&s != this)
+        swap(s);
     return *this;
 }
+#endif
+
+void
+sc_string::swap( sc_string& s )
+{
+    sc_string_rep* r = rep;
+    rep = s.rep;
+    s.rep = r;
+
+    char tmp[SHORT_SIZE];
+    memcpy( tmp, short_str, SHORT_SIZE );
+    memcpy( short_str, s.short_str, SHORT_SIZE );
+    memcpy( s.short_str, tmp, SHORT_SIZE );
+
+    str = (rep != 0) ? rep->str : short_str;
+    s.str = (s.rep != 0) ? s.rep->str : s.short_str;
+}
 
 sc_string&
 sc_string::operator+=( const char* s )
 {
     int oldlen = length();
     int slen   = strlen(s);
-    if (rep->ref_count > 1) {
-        sc_string_rep* oldrep = rep;
-        --rep->ref_count;
-        rep = new sc_string_rep( oldlen + slen + 1 );
-        strcpy( rep->str, oldrep->str );
-        strcpy( rep->str + oldlen, s );
+    int size   = oldlen + slen + 1;
+    if (writable(size)) {
+        memmove( str + oldlen, s, slen + 1 );
     }
     else {
-        rep->resize( oldlen + slen + 1 );
-        strcpy( rep->str + oldlen, s );
+        /* Grow geometrically, so that repeated appends stay linear.
+           The old storage is kept until s has been copied, as s may
+           point into it. */
+        if (size < 2 * capacity())
+            size = 2 * capacity();
+        sc_string r( size );
+        memcpy( r.str, str, oldlen );
+        memcpy( r.str + oldlen, s, slen + 1 );
+        swap(r);
     }
     return *this;
 }
@@ -257,43 +313,35 @@ sc_string::operator+=( const char* s )
 sc_string& sc_string::operator+=(char c)
 {
     int oldlen = length();
-    if (rep->ref_count > 1) {
-        sc_string_rep* oldrep = rep;
-        --rep->ref_count;
-        rep = new sc_string_rep( oldlen + 2 );
-        strcpy( rep->str, oldrep->str );
-        rep->str[oldlen]=c;
-        rep->str[oldlen+1]=00;
-    }
-    else {
-        rep->resize( oldlen + 2 );
-        rep->str[oldlen]=c;
-        rep->str[oldlen+1]=00;
+    if (! writable(oldlen + 2)) {
+        int size = oldlen + 2;
+        if (size < 2 * capacity())
+            size = 2 * capacity();
+        sc_string r( size );
+        memcpy( r.str, str, oldlen );
+        swap(r);
     }
+    str[oldlen]=c;
+    str[oldlen+1]=00;
     return *this;
 }
 
 sc_string&
 sc_string::operator+=( const sc_string& s )
 {
-    return this->operator+=( s.rep->str );
+    return this->operator+=( s.str );
 }
 
 int
 sc_string::cmp( const char* s ) const
 {
-    return strcmp( rep->str, s );
+    return strcmp( str, s );
 }
 
 int
 sc_string::cmp( const sc_string& s ) const
 {
-    return strcmp( rep->str, s.rep->str );
-}
-
-const char* sc_string::c_str() const
-{
-  return rep->str;
+    return strcmp( str, s.str );
 }
 
 // get substring
@@ -301,7 +349,7 @@ sc_string sc_string::substr(int first,int last) const
 {
   if(first<0 || last<0 || first>=last || first>=length() || last>=length())
     return "";
-  return sc_string(rep->str+first, last-first+1);
+  return sc_string(str+first, last-first+1);
 }
 
 
@@ -316,11 +364,11 @@ sc_string sc_string::make_str(long n) // convert integer to string
 #define DEFINE_RELOP(op) \
 bool sc_string::operator ## op( const char* s ) const \
 {						\
-    return strcmp( rep->str, s ) op 0;		\
+    return strcmp( str, s ) op 0;		\
 }						\
 bool sc_string::operator ## op( const sc_string& s ) const \
 {						\
-    return strcmp( rep->str, s.rep->str ) op 0;	\
+    return strcmp( str, s.str ) op 0;	\
 }
 
 DEFINE_RELOP(==)
@@ -330,31 +378,33 @@ DEFINE_RELOP(<=)
 DEFINE_RELOP(>)
 DEFINE_RELOP(>=)
 
-sc_string::operator const char*() const
-{
-    return rep->str;
-}
-
-char
-sc_string::operator[]( int i ) const
+void
+sc_string::set( int i, char c )
 {
-    return rep->str[i];
+    if (rep != 0 && rep->ref_count > 1) {
+        sc_string t( str );
+        swap(t);
+    }
+    str[i] = c;
 }
 
-void
-sc_string::set( int i, char c )
+char*
+sc_string::buffer( int size )
 {
-    if (rep->ref_count > 1) {
-        rep->ref_count--;
-        rep = new sc_string_rep(rep->str);
+    if (! writable(size)) {
+        /* Keep the current contents, up to the new size. */
+        int old_size = capacity();
+        sc_string t( size );
+        memcpy( t.str, str, (old_size < size) ? old_size : size );
+        swap(t);
     }
-    rep->str[i] = c;
+    return str;
 }
 
 void
 sc_string::print(ostream& os) const
 {
-    os << rep->str;
+    os << str;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -362,18 +412,15 @@ sc_string::print(ostream& os) const
 ostream&
 operator<<( ostream& os, const sc_string& s )
 {
-    return os << s.rep->str;
+    return os << s.str;
 }
 
 istream&
 operator>>( istream& is, sc_string& s )
 {
-    if (s.rep->ref_count > 1) {
-        --s.rep->ref_count;
-        s.rep = new sc_string_rep;
-    }
+    s = "";
     int i = 0;
-    char* p = s.rep->str;
+    char* p = s.str;
     char ch;
 
         /* skip white spaces */
@@ -381,9 +428,8 @@ operator>>( istream& is, sc_string& s )
         ;
 
     for ( ; is.good() && !isspace(ch); is.get(ch)) {
-        if (i > s.rep->alloc - 2) {
-            s.rep->resize( (int) (s.rep->alloc * 1.5) );
-            p = s.rep->str + i;
+        if (i > s.capacity() - 2) {
+            p = s.buffer( (int) (s.capacity() * 1.5) ) + i;
         }
         *p++ = ch;
         i++;
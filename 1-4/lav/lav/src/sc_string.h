@@ -49,6 +49,7 @@ using std::hex;
 // MSVC6.0 has bugs in standard library
 #include <iostream.h>
 #endif
+#include <string.h>
 
 #ifdef __BCPLUSPLUS__
 #pragma hdrstop
@@ -80,7 +81,22 @@ enum sc_numrep
 };
 
 class sc_string_rep;
+class sc_string_view;
 
+// Compilers that support rvalue references get move construction and
+// move assignment for sc_string.
+#if !defined(SC_STRING_HAS_MOVE)
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#define SC_STRING_HAS_MOVE
+#endif
+#endif
+
+//
+// Strings of up to SHORT_SIZE - 1 characters are stored inside the
+// sc_string object itself; longer strings live in a reference counted
+// sc_string_rep that is shared between copies until one of them is
+// modified.  Neither the empty string nor short strings allocate.
+//
 class sc_string {
     friend ostream& operator<<( ostream& os, const sc_string& s );
     friend istream& operator>>( istream& is, sc_string& s );
@@ -90,6 +106,10 @@ public:
     sc_string( const char* s ); // must be 0-ended
     sc_string( const char* s, int n ); // get first n chars from the string
     sc_string( const sc_string& s );
+    explicit sc_string( const sc_string_view& v );
+#ifdef SC_STRING_HAS_MOVE
+    sc_string( sc_string&& s );
+#endif
     ~sc_string();
 
     sc_string operator+( const char* s ) const;
@@ -100,15 +120,22 @@ public:
 
     sc_string& operator=( const char* s );
     sc_string& operator=( const sc_string& s );
+#ifdef SC_STRING_HAS_MOVE
+    sc_string& operator=( sc_string&& s );
+#endif
 
     sc_string& operator+=( const char* s );
     sc_string& operator+=( char c);
     sc_string& operator+=( const sc_string& s );
 
+    // exchange contents; also serves as a cheap move where rvalue
+    // references are not available
+    void swap( sc_string& s );
+
     int cmp( const char* s ) const;
     int cmp( const sc_string& s ) const;
 
-    const char* c_str() const;
+    const char* c_str() const { return str; }
     // get substring
     sc_string substr(int,int) const;
     static sc_string make_str(long n); // convert long to string
@@ -125,19 +152,73 @@ public:
     DECL_RELOP(>=);
 #undef DECL_RELOP
 
-    int length() const;
+    int length() const { return strlen(str); }
 
-    operator const char*() const;
-    char operator[](int i) const;
+    operator const char*() const { return str; }
+    char operator[](int i) const { return str[i]; }
     void set( int i, char c );
 
+    // Returns the characters of the string for writing, with room for
+    // at least size chars including the terminating 0, which is left
+    // to the caller.
+    char* buffer( int size );
+
     void print(ostream& os = cout) const;
 
 private:
-    sc_string( sc_string_rep* r );
-    sc_string_rep* rep;
+    enum { SHORT_SIZE = 16 };
+
+    char* init( int size );
+    void release();
+    bool writable( int size ) const;
+    int capacity() const;
+
+    char* str;          // short_str or rep->str
+    sc_string_rep* rep; // 0 if the string is held in short_str
+    char short_str[SHORT_SIZE];
 };
 
+//
+// A non-owning reference to a sequence of characters, for internal
+// functions that only read a string and should accept a const char*
+// or an sc_string without constructing a temporary sc_string.  The
+// characters are not necessarily 0-ended and must outlive the view.
+//
+class sc_string_view {
+public:
+    sc_string_view() : m_str(""), m_len(0) { }
+    sc_string_view( const char* s ) : m_str(s), m_len(strlen(s)) { }
+    sc_string_view( const char* s, int n ) : m_str(s), m_len(n) { }
+    sc_string_view( const sc_string& s ) : m_str(s.c_str()), m_len(s.length()) { }
+
+    const char* data() const { return m_str; }
+    int length() const { return m_len; }
+    bool empty() const { return (m_len == 0); }
+    char operator[](int i) const { return m_str[i]; }
+
+    sc_string_view substr( int pos, int n ) const
+        { return sc_string_view( m_str + pos, n ); }
+
+    int cmp( const sc_string_view& v ) const
+    {
+        int n = (m_len < v.m_len) ? m_len : v.m_len;
+        int r = memcmp( m_str, v.m_str, n );
+        return (r != 0) ? r : (m_len - v.m_len);
+    }
+
+private:
+    const char* m_str;
+    int m_len;
+};
+
+inline
+ostream&
+operator << ( ostream& os, const sc_string_view& v )
+{
+    os.write( v.data(), v.length() );
+    return os;
+}
+
 const sc_string to_string( sc_numrep );
 
 inline
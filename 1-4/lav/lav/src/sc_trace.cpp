@@ -61,12 +61,93 @@ using std::hex;
 #endif
 #include "sc_trace.h"
 #include "sc_signal.h"
+#include "sc_simcontext.h"
+#include "sc_trace_registry.h"
+
+// Makes p, of n elements, hold need elements, the new ones set to fill
+template< class T >
+static void
+sc_trace_grow(T*& p, int* n, int need, T fill)
+{
+    if (need <= *n)
+        return;
+    int new_n = (*n == 0) ? 64 : *n;
+    while (new_n < need)
+        new_n *= 2;
+    T* q = new T[new_n];
+    int i;
+    for (i = 0; i < *n; ++i)
+        q[i] = p[i];
+    for ( ; i < new_n; ++i)
+        q[i] = fill;
+    delete[] p;
+    p = q;
+    *n = new_n;
+}
+
+// Removes the hook of trace i from sig
+void sc_trace_file::unhook(sc_signal_base* sig, int i)
+{
+    sc_trace_hook** pp = &sig->trace_hooks;
+    while (*pp != 0) {
+        sc_trace_hook* h = *pp;
+        if (h->file == this && h->index == i) {
+            *pp = h->next;
+            delete h;
+            return;
+        }
+        pp = &h->next;
+    }
+}
 
 // Trace file common functions.
 
 sc_trace_file::sc_trace_file()
 {
-  /* Intentionally blank */
+    watched = 0;
+    n_watched = 0;
+    n_detect = 0;
+    candidate = 0;
+    is_dirty = 0;
+    n_polled = 0;
+    lastof_dirty = -1;
+    is_polled = 0;
+    is_shared = 0;
+    is_on = 0;
+    is_off = 0;
+    n_off = 0;
+    forced_list = 0;
+    is_forced = 0;
+    n_forced = 0;
+    rebuild_pending = false;
+    registry = 0;
+    trace_entry = 0;
+    n_trace_entry = 0;
+    file_off = false;
+    enables_changed = false;
+    start_pending = stop_pending = false;
+    start_time = stop_time = 0;
+}
+
+sc_trace_file::~sc_trace_file()
+{
+    /* Unhook the signals that are still alive. */
+    for (int i = 0; i < n_watched; ++i) {
+        if (watched[i] != 0)
+            unhook(watched[i], i);
+    }
+    if (registry != 0)
+        registry->remove_file(this);
+    delete[] watched;
+    delete[] candidate;
+    delete[] is_dirty;
+    delete[] is_polled;
+    delete[] is_shared;
+    delete[] is_on;
+    delete[] is_off;
+    delete[] forced_list;
+    delete[] is_forced;
+    delete[] trace_entry;
 }
 
 void tprintf(sc_trace_file* tf,  const char* format, ...)
@@ -89,24 +170,318 @@ void sc_trace_file::delta_cycles(bool)
   /* Intentionally blank */
 }
 
+int sc_trace_file::num_traces() const
+{
+    return 0;
+}
+
+const char* sc_trace_file::trace_name(int) const
+{
+    return 0;
+}
+
+// Matches name against a pattern with the wildcards `*' and `?'
+static bool
+sc_trace_name_matches(const char* pattern, const char* name)
+{
+    const char* star = 0;
+    const char* resume = 0;
+    while (*name != 0) {
+        if (*pattern == '*') {
+            star = pattern++;
+            resume = name;
+        }
+        else if (*pattern == '?' || *pattern == *name) {
+            ++pattern;
+            ++name;
+        }
+        else if (star != 0) {
+            pattern = star + 1;
+            name = ++resume;
+        }
+        else
+            return false;
+    }
+    while (*pattern == '*')
+        ++pattern;
+    return (*pattern == 0);
+}
+
+void sc_trace_file::set_enabled(const char* pattern, bool flag)
+{
+    int n = num_traces();
+    sc_trace_grow(is_off, &n_off, n, false);
+    for (int i = 0; i < n; ++i) {
+        const char* name = trace_name(i);
+        if (name != 0 && sc_trace_name_matches(pattern, name))
+            is_off[i] = ! flag;
+    }
+    enables_changed = true;
+}
+
+void sc_trace_file::enable(const char* pattern)
+{
+    set_enabled(pattern, true);
+}
+
+void sc_trace_file::disable(const char* pattern)
+{
+    set_enabled(pattern, false);
+}
+
+void sc_trace_file::stop_at(double t)
+{
+    stop_time = t;
+    stop_pending = true;
+}
+
+void sc_trace_file::start_at(double t)
+{
+    start_time = t;
+    start_pending = true;
+    if (! file_off) {
+        file_off = true;
+        enables_changed = true;
+    }
+}
+
+// Applies the start and stop times that have been reached, in order
+void sc_trace_file::check_window()
+{
+    double now = sc_simulation_time();
+    bool start = start_pending && start_time <= now;
+    bool stop = stop_pending && stop_time <= now;
+    if (! start && ! stop)
+        return;
+    if (start && stop)
+        file_off = (start_time <= stop_time);
+    else
+        file_off = stop;
+    if (start)
+        start_pending = false;
+    if (stop)
+        stop_pending = false;
+    enables_changed = true;
+}
+
+void sc_trace_file::do_cycle(bool delta_cycle)
+{
+    if (start_pending || stop_pending)
+        check_window();
+    if (candidate == 0) {
+        // Not initialized yet
+        cycle(delta_cycle);
+        return;
+    }
+    if (enables_changed)
+        update_enables();
+    if (file_off && n_forced == 0)
+        return;
+    cycle(delta_cycle);
+}
+
+void sc_trace_file::update_enables()
+{
+    enables_changed = false;
+    bool changed = false;
+    int i;
+    for (i = 0; i < n_detect; ++i) {
+        bool on = ! file_off && ! (i < n_off && is_off[i]);
+        if (on == is_on[i])
+            continue;
+        is_on[i] = on;
+        changed = true;
+        // Either way the trace is ignored by mark_dirty() until it
+        // has been written by the next cycle()
+        is_dirty[i] = true;
+        if (on) {
+            if (! is_forced[i]) {
+                is_forced[i] = true;
+                forced_list[n_forced++] = i;
+            }
+        }
+        else
+            is_forced[i] = false;
+    }
+    if (! changed)
+        return;
+
+    int k = 0;
+    for (int j = 0; j < n_forced; ++j) {
+        if (is_forced[forced_list[j]])
+            forced_list[k++] = forced_list[j];
+    }
+    n_forced = k;
+
+    // The dirty traces that are still on move behind the new polled ones
+    int n_dirty = lastof_dirty + 1;
+    int* dirty = new int[n_dirty + 1];
+    k = 0;
+    for (int j = 0; j < n_dirty; ++j) {
+        i = candidate[n_polled + j];
+        if (is_on[i])
+            dirty[k++] = i;
+    }
+    rebuild_polled();
+    for (int j = 0; j < k; ++j)
+        candidate[n_polled + j] = dirty[j];
+    lastof_dirty = k - 1;
+    delete[] dirty;
+
+    // Polled traces that were enabled again join the candidates once
+    // they have been written
+    if (n_forced != 0)
+        rebuild_pending = true;
+}
+
+// The polled traces that are on and not forced
+void sc_trace_file::rebuild_polled()
+{
+    n_polled = 0;
+    for (int i = 0; i < n_detect; ++i) {
+        if (is_polled[i] && is_on[i] && ! is_forced[i])
+            candidate[n_polled++] = i;
+    }
+}
+
+void sc_trace_file::watch_signal(const sc_signal_base* sig, int first)
+{
+    int n = num_traces();
+    /* Traces added after initialization are not checked at all. */
+    if (n <= first || candidate != 0)
+        return;
+    sc_trace_grow(watched, &n_watched, n, (sc_signal_base*) 0);
+    for (int i = first; i < n; ++i) {
+        sc_trace_hook* h = new sc_trace_hook;
+        h->file = this;
+        h->registry = 0;
+        h->index = i;
+        h->next = sig->trace_hooks;
+        sig->trace_hooks = h;
+        watched[i] = const_cast<sc_signal_base*>(sig);
+    }
+}
+
+void sc_trace_file::unwatch(int i)
+{
+    watched[i] = 0;
+}
+
+void sc_trace_file::set_trace_entry(int i, sc_trace_registry* r, int e)
+{
+    if (e < 0)
+        return;
+    registry = r;
+    sc_trace_grow(trace_entry, &n_trace_entry, i + 1, -1);
+    trace_entry[i] = e;
+}
+
+void sc_trace_file::init_change_detection(int n)
+{
+    delete[] candidate;
+    delete[] is_dirty;
+    delete[] is_polled;
+    delete[] is_shared;
+    delete[] is_on;
+    delete[] forced_list;
+    delete[] is_forced;
+    candidate = new int[n + 1];
+    is_dirty = new bool[n + 1];
+    is_polled = new bool[n + 1];
+    is_shared = new bool[n + 1];
+    is_on = new bool[n + 1];
+    forced_list = new int[n + 1];
+    is_forced = new bool[n + 1];
+    n_detect = n;
+    n_polled = 0;
+    lastof_dirty = -1;
+    n_forced = 0;
+    rebuild_pending = false;
+    enables_changed = false;
+
+    int i;
+    for (i = 0; i < n; ++i) {
+        sc_signal_base* sig = (i < n_watched) ? watched[i] : 0;
+        is_shared[i] = (i < n_trace_entry && trace_entry[i] >= 0
+                        && registry->is_shared(trace_entry[i]));
+        if (is_shared[i] && sig != 0) {
+            /* The registry watches the signal instead. */
+            registry->watch(trace_entry[i], sig);
+            unhook(sig, i);
+            watched[i] = sig = 0;
+        }
+        is_polled[i] = (sig == 0 && ! is_shared[i]);
+        is_on[i] = ! file_off && ! (i < n_off && is_off[i]);
+        is_forced[i] = false;
+        is_dirty[i] = ! is_on[i] || is_shared[i];
+        if (is_polled[i] && is_on[i])
+            candidate[n_polled++] = i;
+    }
+
+    /* Values may have changed since the traces were created, so the
+       first cycle checks every trace. */
+    for (i = 0; i < n && i < n_watched; ++i) {
+        if (watched[i] != 0)
+            mark_dirty(i);
+    }
+}
+
+void sc_trace_file::clear_dirty()
+{
+    const int* const l_dirty = candidate + n_polled;
+    for (int i = lastof_dirty; i >= 0; --i)
+        is_dirty[l_dirty[i]] = false;
+    lastof_dirty = -1;
+
+    if (n_forced != 0) {
+        for (int j = 0; j < n_forced; ++j) {
+            int i = forced_list[j];
+            is_forced[i] = false;
+            // Shared traces are only ever written when forced
+            is_dirty[i] = is_shared[i] || ! is_on[i];
+        }
+        n_forced = 0;
+        if (rebuild_pending) {
+            rebuild_pending = false;
+            rebuild_polled();
+        }
+    }
+}
+
 void sc_trace(sc_trace_file *tf, const sc_signal<char>& object, const sc_string& name, int width) 
 {
-    if (tf) tf->trace(*(object.get_data_ptr()), name, width);
+    if (tf) {
+        int first = tf->num_traces();
+        tf->trace(*(object.get_data_ptr()), name, width);
+        tf->watch_signal(&object, first);
+    }
 }
 
 void sc_trace(sc_trace_file *tf, const sc_signal<short>& object, const sc_string& name, int width) 
 {
-    if (tf) tf->trace(*(object.get_data_ptr()), name, width);
+    if (tf) {
+        int first = tf->num_traces();
+        tf->trace(*(object.get_data_ptr()), name, width);
+        tf->watch_signal(&object, first);
+    }
 }
 
 void sc_trace(sc_trace_file *tf, const sc_signal<int>& object, const sc_string& name, int width) 
 {
-    if (tf) tf->trace(*(object.get_data_ptr()), name, width);
+    if (tf) {
+        int first = tf->num_traces();
+        tf->trace(*(object.get_data_ptr()), name, width);
+        tf->watch_signal(&object, first);
+    }
 }
 
 void sc_trace(sc_trace_file *tf, const sc_signal<long>& object, const sc_string& name, int width) 
 {
-    if (tf) tf->trace(*(object.get_data_ptr()), name, width);
+    if (tf) {
+        int first = tf->num_traces();
+        tf->trace(*(object.get_data_ptr()), name, width);
+        tf->watch_signal(&object, first);
+    }
 }
 
 void sc_trace(sc_trace_file* /* not used */, const void* /* not used */, const sc_string& name)
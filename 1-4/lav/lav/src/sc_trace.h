@@ -72,6 +72,19 @@ template <class A> class sc_signal_array;
 template <class T> class sc_channel;
 template <class A> class sc_channel_array;
 class sc_signal_resolved_vector;
+class sc_signal_base;
+class sc_trace_file;
+class sc_trace_registry;
+
+// Links a signal to one of the traces of its value, or, if file is 0,
+// to an entry of the trace registry.  The hooks of a signal form a
+// list headed by sc_signal_base::trace_hooks.
+struct sc_trace_hook {
+    sc_trace_file*     file;
+    sc_trace_registry* registry;
+    int                index;
+    sc_trace_hook*     next;
+};
 
 // Base class for all kinds of trace files. 
 
@@ -184,12 +197,125 @@ public:
     // Also trace transitions between delta cycles if flag is true.
     virtual void delta_cycles(bool flag);
 
+    // Number of traces in the file.  Trace files that use dirty-list
+    // change detection (see init_change_detection()) return their
+    // trace count, others return 0.
+    virtual int num_traces() const;
+
+    // Called by sc_trace() for signals: the traces first ...
+    // num_traces() - 1, just added for sig, are checked for changes
+    // only in cycles in which sig was updated.
+    void watch_signal(const sc_signal_base* sig, int first);
+
+    // Called by sc_share_trace(): trace i shows the object of entry e
+    // of registry r, if e is not -1.
+    void set_trace_entry(int i, sc_trace_registry* r, int e);
+
+    // Name of trace i, for enable() and disable(); trace files that
+    // do not use dirty-list change detection return 0.
+    virtual const char* trace_name(int i) const;
+
+    // Runtime control.  Disabled traces are not checked for changes
+    // at all; when they are enabled again, their current values are
+    // written in the next cycle, so that the waveform is right from
+    // then on.  enable() and disable() apply to the traces added so
+    // far whose names match pattern, in which `*' stands for any
+    // characters and `?' for any one character.
+    void enable(const char* pattern = "*");
+    void disable(const char* pattern = "*");
+
+    // Tracing stops from simulation time t on, and starts again at
+    // time t, respectively; start_at() stops it until then.  Times
+    // are in the units of sc_simulation_time().
+    void stop_at(double t);
+    void start_at(double t);
+
 protected:
     // Write trace info for cycle.
     virtual void cycle(bool delta_cycle) = 0;
 
+    // Dirty-list change detection.  initialize() calls
+    // init_change_detection() with the number of traces; from then on
+    // cycle() need only check the traces candidates()[0] ...
+    // candidates()[num_candidates() - 1] -- the traces that are not
+    // watched, followed by those whose signal was updated -- and call
+    // clear_dirty() once it has written them.  The traces
+    // forced()[0] ... forced()[num_forced() - 1] are written whether
+    // they changed or not: they have just been enabled again, or the
+    // trace registry found that their shared object changed.  They
+    // are never among the candidates.
+    void init_change_detection(int n);
+    const int* candidates() const { return candidate; }
+    int num_candidates() const { return n_polled + lastof_dirty + 1; }
+    const int* forced() const { return forced_list; }
+    int num_forced() const { return n_forced; }
+    void clear_dirty();
+
     // Flush results and close file.
-    virtual ~sc_trace_file() { /* Intentionally blank */ };
+    virtual ~sc_trace_file();
+
+private:
+    friend class sc_signal_base;
+    friend class sc_trace_registry;
+
+    // Called through the hooks of an updated signal
+    void mark_dirty(int i)
+    {
+        if (i < n_detect && ! is_dirty[i]) {
+            is_dirty[i] = true;
+            candidate[n_polled + ++lastof_dirty] = i;
+        }
+    }
+    void unwatch(int i);
+    void unhook(sc_signal_base* sig, int i);
+
+    // Called by the trace registry when the shared object of trace i
+    // changed
+    void mark_changed(int i)
+    {
+        if (i < n_detect && is_on[i] && ! is_forced[i]) {
+            is_forced[i] = true;
+            forced_list[n_forced++] = i;
+        }
+    }
+
+    // Called by sc_simcontext instead of cycle()
+    void do_cycle(bool delta_cycle);
+    void set_enabled(const char* pattern, bool flag);
+    void check_window();
+    void update_enables();
+    void rebuild_polled();
+
+    sc_signal_base** watched;   // signal of each trace, or 0 if polled
+    int n_watched;
+    int n_detect;               // number of traces at initialization
+    int* candidate;             // polled traces, then dirty ones
+    bool* is_dirty;
+    int n_polled;
+    int lastof_dirty;
+
+    // Disabled and shared traces are kept out of the candidates, and
+    // their is_dirty flags are held true so that mark_dirty() ignores
+    // them.
+    bool* is_polled;            // polled rather than watched
+    bool* is_shared;            // changes detected by the registry
+    bool* is_on;                // being traced
+    bool* is_off;               // disabled by name
+    int n_off;
+    int* forced_list;
+    bool* is_forced;
+    int n_forced;
+    bool rebuild_pending;       // polled traces are among the forced
+
+    sc_trace_registry* registry;
+    int* trace_entry;           // entry in the registry, or -1
+    int n_trace_entry;
+    bool file_off;              // outside of the time window
+    bool enables_changed;
+    bool start_pending;
+    bool stop_pending;
+    double start_time;
+    double stop_time;
 };
 
 /***************************************************************************************************/
@@ -346,7 +472,11 @@ inline void sc_trace(sc_trace_file *tf, const double* object, const sc_string& n
 template< class T > 
 inline void sc_trace(sc_trace_file *tf, const sc_signal<T>& object, const sc_string& name)
 {
-    sc_trace(tf, *(object.get_data_ptr()), name);
+    if (tf) {
+        int first = tf->num_traces();
+        sc_trace(tf, *(object.get_data_ptr()), name);
+        tf->watch_signal(&object, first);
+    }
 }
 
 // Just the above template function will not work unless the last argument happens to be 
@@ -363,7 +493,11 @@ inline void sc_trace(sc_trace_file *tf, const sc_signal<T>& object, const sc_str
 template< class T >
 inline void sc_trace(sc_trace_file *tf, const sc_signal<T>& object, const char* name)
 {
-    sc_trace(tf, *(object.get_data_ptr()), name);
+    if (tf) {
+        int first = tf->num_traces();
+        sc_trace(tf, *(object.get_data_ptr()), name);
+        tf->watch_signal(&object, first);
+    }
 }
 
 // Specializations for signals of type int, char, short, long
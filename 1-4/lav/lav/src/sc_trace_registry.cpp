@@ -0,0 +1,261 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_trace_registry.cpp -- Change detection shared by the trace files.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#include <assert.h>
+#include <string.h>
+
+#include "sc_trace_registry.h"
+#include "sc_signal.h"
+
+sc_trace_detector::~sc_trace_detector()
+{
+}
+
+// Makes room for need elements in p, which holds n of them
+template< class T >
+static void
+sc_trace_registry_reserve( T*& p, int n, int* alloc, int need )
+{
+    if (need <= *alloc)
+        return;
+    int new_alloc = (*alloc < 16) ? 16 : *alloc;
+    while (new_alloc < need)
+        new_alloc *= 2;
+    T* q = new T[new_alloc];
+    if (n > 0)
+        memcpy(q, p, n * sizeof(T));
+    delete[] p;
+    p = q;
+    *alloc = new_alloc;
+}
+
+sc_trace_registry::sc_trace_registry()
+{
+    entries = 0;
+    n_entries = entries_alloc = 0;
+    subs = 0;
+    n_subs = subs_alloc = 0;
+    polled = 0;
+    n_polled = 0;
+    polled_stale = false;
+    dirty = 0;
+    lastof_dirty = -1;
+    is_dirty = 0;
+    frozen = false;
+}
+
+sc_trace_registry::~sc_trace_registry()
+{
+    for (int e = 0; e < n_entries; ++e) {
+        entry& x = entries[e];
+        delete x.detector;
+        /* Unhook the signals that are still alive. */
+        if (x.signal == 0)
+            continue;
+        sc_trace_hook** pp = &x.signal->trace_hooks;
+        while (*pp != 0) {
+            sc_trace_hook* h = *pp;
+            if (h->registry == this && h->index == e) {
+                *pp = h->next;
+                delete h;
+                break;
+            }
+            pp = &h->next;
+        }
+    }
+    delete[] entries;
+    delete[] subs;
+    delete[] polled;
+    delete[] dirty;
+    delete[] is_dirty;
+}
+
+int
+sc_trace_registry::find( const void* object, const void* type ) const
+{
+    for (int e = first_entry[object] - 1; e >= 0; e = entries[e].next) {
+        if (entries[e].type == type)
+            return e;
+    }
+    return -1;
+}
+
+int
+sc_trace_registry::add_entry( const void* object, const void* type,
+                              sc_trace_detector* d )
+{
+    sc_trace_registry_reserve(entries, n_entries, &entries_alloc, n_entries + 1);
+    entry& x = entries[n_entries];
+    x.object = object;
+    x.type = type;
+    x.detector = d;
+    x.next = first_entry[object] - 1;
+    x.signal = 0;
+    x.dead = false;
+    x.first_sub = 0;
+    x.n_subs = 0;
+    first_entry.insert(object, n_entries + 1);
+    return n_entries++;
+}
+
+void
+sc_trace_registry::subscribe( int e, sc_trace_file* tf, int index )
+{
+    sc_trace_registry_reserve(subs, n_subs, &subs_alloc, n_subs + 1);
+    subscriber& s = subs[n_subs++];
+    s.entry = e;
+    s.file = tf;
+    s.index = index;
+    ++entries[e].n_subs;
+}
+
+// Decides which objects are shared, and groups the subscribers by entry
+void
+sc_trace_registry::freeze()
+{
+    frozen = true;
+
+    int e;
+    int first = 0;
+    for (e = 0; e < n_entries; ++e) {
+        entry& x = entries[e];
+        x.first_sub = first;
+        first += x.n_subs;
+        if (x.n_subs < 2) {
+            delete x.detector;
+            x.detector = 0;
+        }
+        else {
+            // Trace files write the current values as they initialize
+            x.detector->update();
+        }
+    }
+    subscriber* sorted = new subscriber[n_subs + 1];
+    for (int k = 0; k < n_subs; ++k) {
+        entry& x = entries[subs[k].entry];
+        sorted[x.first_sub++] = subs[k];
+    }
+    for (e = 0; e < n_entries; ++e)
+        entries[e].first_sub -= entries[e].n_subs;
+    delete[] subs;
+    subs = sorted;
+    subs_alloc = n_subs + 1;
+
+    polled = new int[n_entries + 1];
+    dirty = new int[n_entries + 1];
+    is_dirty = new bool[n_entries + 1];
+    for (e = 0; e < n_entries; ++e)
+        is_dirty[e] = false;
+    polled_stale = true;
+}
+
+void
+sc_trace_registry::rebuild_polled()
+{
+    polled_stale = false;
+    n_polled = 0;
+    for (int e = 0; e < n_entries; ++e) {
+        const entry& x = entries[e];
+        if (x.detector != 0 && x.signal == 0 && ! x.dead)
+            polled[n_polled++] = e;
+    }
+}
+
+void
+sc_trace_registry::watch( int e, sc_signal_base* sig )
+{
+    entry& x = entries[e];
+    if (x.signal == sig || x.dead)
+        return;
+    assert( x.signal == 0 );
+    sc_trace_hook* h = new sc_trace_hook;
+    h->file = 0;
+    h->registry = this;
+    h->index = e;
+    h->next = sig->trace_hooks;
+    sig->trace_hooks = h;
+    x.signal = sig;
+    polled_stale = true;
+}
+
+void
+sc_trace_registry::unwatch( int e )
+{
+    entries[e].signal = 0;
+    entries[e].dead = true;
+    polled_stale = true;
+}
+
+void
+sc_trace_registry::remove_file( sc_trace_file* tf )
+{
+    for (int k = 0; k < n_subs; ++k) {
+        if (subs[k].file == tf)
+            subs[k].file = 0;
+    }
+}
+
+inline void
+sc_trace_registry::check( int e )
+{
+    const entry& x = entries[e];
+    if (x.detector->update()) {
+        const subscriber* s = subs + x.first_sub;
+        for (int k = x.n_subs; k > 0; --k, ++s) {
+            if (s->file != 0)
+                s->file->mark_changed(s->index);
+        }
+    }
+}
+
+void
+sc_trace_registry::detect()
+{
+    if (! frozen) {
+        freeze();
+        return;
+    }
+    if (polled_stale)
+        rebuild_polled();
+
+    const int* const l_polled = polled;
+    for (int k = 0; k < n_polled; ++k)
+        check(l_polled[k]);
+    for (int k = lastof_dirty; k >= 0; --k) {
+        int e = dirty[k];
+        is_dirty[e] = false;
+        if (! entries[e].dead)
+            check(e);
+    }
+    lastof_dirty = -1;
+}
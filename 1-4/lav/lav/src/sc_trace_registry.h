@@ -0,0 +1,209 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_trace_registry.h -- Change detection shared by the trace files.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#ifndef SC_TRACE_REGISTRY_H
+#define SC_TRACE_REGISTRY_H
+
+#include "sc_trace.h"
+#include "sc_flat_hash.h"
+#include "sc_simcontext.h"
+#include "sc_trace_value.h"
+
+class sc_signal_base;
+
+//
+// Detects the changes of one traced object, by comparing it with a
+// copy of its value.
+//
+
+class sc_trace_detector {
+public:
+    virtual ~sc_trace_detector();
+
+    // Returns true if the object changed since the last call, and
+    // remembers its current value
+    virtual bool update() = 0;
+};
+
+template< class T >
+class sc_trace_detector_t : public sc_trace_detector {
+public:
+    sc_trace_detector_t( const T& _object )
+        : value(_object)
+    { }
+    bool update()
+    {
+        if (! value.changed())
+            return false;
+        value.update_old();
+        return true;
+    }
+
+private:
+    sc_trace_value<T> value;
+};
+
+// The address of key identifies the traced type T
+template< class T >
+struct sc_trace_type_key {
+    static char key;
+};
+
+template< class T >
+char sc_trace_type_key<T>::key = 0;
+
+
+//
+// The trace registry of a simulation context records each object that
+// is traced, in any number of trace files, once.  When simulation
+// starts, the objects that are traced more than once are shared: from
+// then on the registry checks them for changes once per cycle, and
+// hands the changes to the trace files, which write them without
+// checking them again (see sc_trace_file::forced()).  The other
+// objects are left to the dirty-list change detection of their trace
+// files.
+//
+// Signals watched by the trace files of a shared object are watched by
+// the registry instead, so that it checks the object only in cycles in
+// which its signal was updated.
+//
+
+class sc_trace_registry {
+    friend class sc_signal_base;
+
+public:
+    sc_trace_registry();
+    ~sc_trace_registry();
+
+    // Records that trace index of tf shows object.  Returns the entry
+    // of the object, or -1 once simulation has started.
+    template< class T >
+    int add( sc_trace_file* tf, int index, const T& object )
+    {
+        if (frozen)
+            return -1;
+        const void* type = &sc_trace_type_key<T>::key;
+        int e = find(&object, type);
+        if (e < 0)
+            e = add_entry(&object, type, new sc_trace_detector_t<T>(object));
+        subscribe(e, tf, index);
+        return e;
+    }
+
+    // Whether the changes of entry are detected by the registry
+    bool is_shared( int e ) const
+    {
+        return (frozen && entries[e].detector != 0);
+    }
+
+    // Called by trace files that initialize: the object of entry e is
+    // the value of sig
+    void watch( int e, sc_signal_base* sig );
+
+    // Called by trace files as they are closed
+    void remove_file( sc_trace_file* tf );
+
+    // Called by sc_simcontext before the trace files write a cycle
+    void detect();
+
+private:
+    struct entry {
+        const void* object;
+        const void* type;
+        sc_trace_detector* detector;    // 0 unless shared
+        int next;                       // with the same object, or -1
+        sc_signal_base* signal;
+        bool dead;                      // the signal was destroyed
+        int first_sub;
+        int n_subs;
+    };
+    struct subscriber {
+        int entry;
+        sc_trace_file* file;            // 0 once removed
+        int index;
+    };
+
+    int find( const void* object, const void* type ) const;
+    int add_entry( const void* object, const void* type, sc_trace_detector* d );
+    void subscribe( int e, sc_trace_file* tf, int index );
+    void freeze();
+    void rebuild_polled();
+    void check( int e );
+
+    // Called through the hooks of an updated signal
+    void mark_dirty( int e )
+    {
+        if (! is_dirty[e]) {
+            is_dirty[e] = true;
+            dirty[++lastof_dirty] = e;
+        }
+    }
+    void unwatch( int e );
+
+    entry* entries;
+    int n_entries;
+    int entries_alloc;
+    sc_flat_hash<const void*, int> first_entry;     // of each object, + 1
+
+    subscriber* subs;                   // sorted by entry once frozen
+    int n_subs;
+    int subs_alloc;
+
+    int* polled;                        // shared entries without signal
+    int n_polled;
+    bool polled_stale;
+    int* dirty;
+    int lastof_dirty;
+    bool* is_dirty;
+
+    bool frozen;                        // = 1 once simulation has started
+
+private:
+    // Disabled
+    sc_trace_registry( const sc_trace_registry& );
+    void operator=( const sc_trace_registry& );
+};
+
+
+// Called by trace files right after adding the trace of object
+template< class T >
+inline void
+sc_share_trace( sc_trace_file* tf, const T& object )
+{
+    sc_trace_registry* r = sc_get_curr_simcontext()->get_trace_registry();
+    int i = tf->num_traces() - 1;
+    if (i >= 0)
+        tf->set_trace_entry(i, r, r->add(tf, i, object));
+}
+
+#endif
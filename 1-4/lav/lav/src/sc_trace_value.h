@@ -0,0 +1,277 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    sc_trace_value.h -- Change detection and value capture of traced
+                        objects, shared by the trace file formats.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+/********************************************************************
+
+  What a trace file needs to know about each traced type is written
+  here once:
+
+    - sc_trace_value<T> refers to a traced object and keeps a copy of
+      the value last written, for change detection;
+
+    - sc_trace_traits<T>::kind tells how its values are written: as a
+      bit, an sc_logic value, a vector of either, an integer of a
+      given width, or a real;
+
+    - sc_trace_width(), sc_trace_get_bits(), sc_trace_get_integer()
+      and sc_trace_to_double() read its width and value.
+
+  A trace file format provides one template trace class, which
+  writes the value of its object with an encoder chosen by
+  overloading on the kind tag (see vcd_typed_trace in
+  sc_vcd_trace.cpp).  Only enumerated objects, whose literals are
+  written, need classes of their own.
+
+********************************************************************/
+
+#ifndef SC_TRACE_VALUE_H
+#define SC_TRACE_VALUE_H
+
+#include "sc_logic.h"
+#include "sc_logic_vector.h"
+#include "sc_bool_vector.h"
+#include "numeric_bit/numeric_bit.h"
+
+// The argument with which the copy of a traced value is constructed;
+// vectors are constructed with their length, and then assigned
+template< class T >
+inline const T&
+sc_trace_init_arg( const T& x ) { return x; }
+inline int sc_trace_init_arg( const sc_bool_vector& x ) { return x.length(); }
+inline int sc_trace_init_arg( const sc_logic_vector& x ) { return x.length(); }
+inline int sc_trace_init_arg( const sc_unsigned& x ) { return x.length(); }
+inline int sc_trace_init_arg( const sc_signed& x ) { return x.length(); }
+inline int sc_trace_init_arg( const sc_uint_base& x ) { return x.width; }
+inline int sc_trace_init_arg( const sc_int_base& x ) { return x.width; }
+
+template< class T >
+class sc_trace_value {
+public:
+    explicit sc_trace_value( const T& _object )
+        : object(_object), old_value(sc_trace_init_arg(_object))
+    {
+        old_value = _object;
+    }
+
+    bool changed() const { return object != old_value; }
+    void update_old() { old_value = object; }
+
+    const T& object;
+    T old_value;
+};
+
+#ifdef SC_INCLUDE_FX
+
+// Fixed-point copies are constructed with the parameters of the object
+
+template<>
+class sc_trace_value<sc_fxnum> {
+public:
+    explicit sc_trace_value( const sc_fxnum& _object )
+        : object(_object),
+          old_value(_object._params.type_params(),
+                    _object._params.enc(),
+                    _object._params.cast_switch(),
+                    0)
+    {
+        old_value = _object;
+    }
+
+    bool changed() const { return object != old_value; }
+    void update_old() { old_value = object; }
+
+    const sc_fxnum& object;
+    sc_fxnum old_value;
+};
+
+template<>
+class sc_trace_value<sc_fxnum_fast> {
+public:
+    explicit sc_trace_value( const sc_fxnum_fast& _object )
+        : object(_object),
+          old_value(_object._params.type_params(),
+                    _object._params.enc(),
+                    _object._params.cast_switch(),
+                    0)
+    {
+        old_value = _object;
+    }
+
+    bool changed() const { return object != old_value; }
+    void update_old() { old_value = object; }
+
+    const sc_fxnum_fast& object;
+    sc_fxnum_fast old_value;
+};
+
+#endif
+
+
+//
+// Kinds of traced values; the tags select the encoders of a format.
+//
+
+struct sc_trace_bit { };        // bool
+struct sc_trace_logic { };      // sc_logic
+struct sc_trace_bits { };       // vectors of bits
+struct sc_trace_logics { };     // sc_logic_vector
+struct sc_trace_integer { };    // C integers of a given width
+struct sc_trace_real { };       // float, double and sc_fxval
+
+template< class T >
+struct sc_trace_traits;
+
+template<> struct sc_trace_traits<bool> { typedef sc_trace_bit kind; };
+template<> struct sc_trace_traits<sc_logic> { typedef sc_trace_logic kind; };
+template<> struct sc_trace_traits<sc_bool_vector> { typedef sc_trace_bits kind; };
+template<> struct sc_trace_traits<sc_logic_vector> { typedef sc_trace_logics kind; };
+template<> struct sc_trace_traits<sc_unsigned> { typedef sc_trace_bits kind; };
+template<> struct sc_trace_traits<sc_signed> { typedef sc_trace_bits kind; };
+template<> struct sc_trace_traits<sc_uint_base> { typedef sc_trace_bits kind; };
+template<> struct sc_trace_traits<sc_int_base> { typedef sc_trace_bits kind; };
+template<> struct sc_trace_traits<float> { typedef sc_trace_real kind; };
+template<> struct sc_trace_traits<double> { typedef sc_trace_real kind; };
+
+// Integers also give the unsigned type of the same size
+#define DEFN_TRACE_INTEGER_TRAITS(tp, utp)                                    \
+template<> struct sc_trace_traits<tp> {                                       \
+    typedef sc_trace_integer kind;                                            \
+    typedef utp unsigned_type;                                                \
+};
+
+DEFN_TRACE_INTEGER_TRAITS(unsigned char, unsigned char)
+DEFN_TRACE_INTEGER_TRAITS(unsigned short, unsigned short)
+DEFN_TRACE_INTEGER_TRAITS(unsigned int, unsigned int)
+DEFN_TRACE_INTEGER_TRAITS(unsigned long, unsigned long)
+DEFN_TRACE_INTEGER_TRAITS(char, unsigned char)
+DEFN_TRACE_INTEGER_TRAITS(short, unsigned short)
+DEFN_TRACE_INTEGER_TRAITS(int, unsigned int)
+DEFN_TRACE_INTEGER_TRAITS(long, unsigned long)
+
+#undef DEFN_TRACE_INTEGER_TRAITS
+
+#ifdef SC_INCLUDE_FX
+template<> struct sc_trace_traits<sc_fxval> { typedef sc_trace_real kind; };
+template<> struct sc_trace_traits<sc_fxval_fast> { typedef sc_trace_real kind; };
+template<> struct sc_trace_traits<sc_fxnum> { typedef sc_trace_bits kind; };
+template<> struct sc_trace_traits<sc_fxnum_fast> { typedef sc_trace_bits kind; };
+#endif
+
+
+//
+// Value capture
+//
+
+// The width of a traced object in bits.  Vectors know their width;
+// other objects have the width they are traced with.
+template< class T >
+inline int
+sc_trace_width( const T&, int width ) { return width; }
+inline int sc_trace_width( const sc_bool_vector& x, int ) { return x.length(); }
+inline int sc_trace_width( const sc_logic_vector& x, int ) { return x.length(); }
+inline int sc_trace_width( const sc_unsigned& x, int ) { return x.length(); }
+inline int sc_trace_width( const sc_signed& x, int ) { return x.length(); }
+inline int sc_trace_width( const sc_uint_base& x, int ) { return x.width; }
+inline int sc_trace_width( const sc_int_base& x, int ) { return x.width; }
+#ifdef SC_INCLUDE_FX
+inline int sc_trace_width( const sc_fxnum& x, int ) { return x.wl(); }
+inline int sc_trace_width( const sc_fxnum_fast& x, int ) { return x.wl(); }
+#endif
+
+// Writes the width bits of a vector, most significant first, as the
+// characters '0' and '1' -- or, for sc_logic_vector, as the
+// characters of to_char().  The characters are not null-terminated.
+template< class T >
+inline void
+sc_trace_get_bits( const T& object, int width, char* p )
+{
+    for (int i = width - 1; i >= 0; --i)
+        *p++ = (object)[i] ? '1' : '0';
+}
+
+inline void
+sc_trace_get_bits( const sc_logic_vector& object, int width, char* p )
+{
+    for (int i = width - 1; i >= 0; --i)
+        *p++ = (object)[i].to_char();
+}
+
+inline void
+sc_trace_get_bits( const sc_unsigned& object, int width, char* p )
+{
+    if (width > 0)
+        object.get_bin_chars(p);
+}
+
+inline void
+sc_trace_get_bits( const sc_signed& object, int width, char* p )
+{
+    if (width > 0)
+        object.get_bin_chars(p);
+}
+
+inline void
+sc_trace_get_bits( const sc_uint_base& object, int width, char* p )
+{
+    for (int i = width - 1; i >= 0; --i)
+        *p++ = ((object.num >> i) & 1) ? '1' : '0';
+}
+
+inline void
+sc_trace_get_bits( const sc_int_base& object, int width, char* p )
+{
+    for (int i = width - 1; i >= 0; --i)
+        *p++ = ((object.num >> i) & 1) ? '1' : '0';
+}
+
+// Sets v to the bits of a C integer, as its unsigned type; returns
+// false if the value does not fit into width bits.
+template< class T >
+inline bool
+sc_trace_get_integer( const T& object, int width, unsigned long& v )
+{
+    typedef typename sc_trace_traits<T>::unsigned_type U;
+    const U u = (U) object;
+    const U mask = (width < (int) (8 * sizeof(U)))
+                   ? (U) ((1UL << width) - 1) : (U) ~(U) 0;
+    v = u;
+    return (u & mask) == u;
+}
+
+inline double sc_trace_to_double( double v ) { return v; }
+#ifdef SC_INCLUDE_FX
+inline double sc_trace_to_double( const sc_fxval& v ) { return v.to_double(); }
+inline double sc_trace_to_double( const sc_fxval_fast& v ) { return v.to_double(); }
+#endif
+
+#endif
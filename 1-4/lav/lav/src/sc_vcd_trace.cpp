@@ -49,6 +49,13 @@
 #include <assert.h>
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
+#ifdef WIN32
+#include "sc_cmnhdr.h"
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
 #ifdef __BCPLUSPLUS__
 #pragma hdrstop
 #endif
@@ -60,6 +67,7 @@
 #include "sc_vcd_trace.h"
 #include "sc_ver.h"
 #include "sc_simcontext.h"
+#include "sc_trace_registry.h"
 #include "numeric_bit/numeric_bit.h"
 #include "sc_resolved.h"
 #include "sc_dump.h"
@@ -73,1276 +81,593 @@ static char map_sc_logic_state_to_vcd_state(char in_char);
 // Print VCD error message
 static void vcd_put_error_message(const char* msg, bool just_warning);
 
-// Remove name problems associated with [] in vcd names
-static void remove_vcd_name_problems(sc_string& name);
-
-
-/*****************************************************************************/
-
-// Base class for the traces
-class vcd_trace {
-public:
-    vcd_trace(const sc_string& _name, const sc_string& _vcd_name);
-
-    // Needs to be pure virtual as has to be defined by the particular
-    // type being traced
-    virtual void write(FILE* f) = 0;
-    
-    virtual void set_width();
-
-    static char* strip_leading_bits(char* originalbuf);
-
-    // Comparison function needs to be pure virtual too
-    virtual bool changed() = 0;
-
-    // Make this virtual as some derived classes may overwrite
-    virtual void print_variable_declaration_line(FILE* f);
-
-    void compose_data_line(char* rawdata, char* compdata);
-
-    virtual ~vcd_trace();
-
-    const sc_string name;
-    const sc_string vcd_name;
-    const char* vcd_var_typ_name;
-    int bit_width; 
-};
-
-
-vcd_trace::vcd_trace(const sc_string& _name, const sc_string& _vcd_name)
-       : name(_name), vcd_name(_vcd_name), bit_width(0)
-{
-    /* Intentionally blank */
-}
-        
-void vcd_trace::compose_data_line(char* rawdata, char* compdata)
-{
-    assert(rawdata != compdata);
-
-    if(bit_width == 0) {
-        compdata[0] = '\0'; 
-    } else {
-        if(bit_width == 1){
-            compdata[0] = rawdata[0];
-            strcpy(&(compdata[1]), vcd_name);
-        }
-        else{
-            char* effective_begin = strip_leading_bits(rawdata);
-            sprintf(compdata, "b%s %s", effective_begin, (const char *) vcd_name);
-        }
-    }
-}
-
-void vcd_trace::print_variable_declaration_line(FILE* f)
-{
-    char buf[2000];
-
-    if(bit_width == 0){
-        sprintf(buf, "Traced object \"%s\" has 0 Bits, cannot be traced.", (const char *) name);
-        vcd_put_error_message(buf, false);
-    }
-    else{
-        sc_string namecopy = name; 
-        remove_vcd_name_problems(namecopy);  
-        sprintf(buf, "$var %s  % 3d  %s  %s       $end\n",
-                vcd_var_typ_name, bit_width, (const char *) vcd_name, (const char *) namecopy);
-        fputs(buf, f);
-    }
-}
-
-void vcd_trace::set_width()
-{
-  /* Intentionally Blank, should be defined for each type separately */
-}
-
-char* vcd_trace::strip_leading_bits(char* originalbuf)
-{
-    //*********************************************************************
-    // - Remove multiple leading 0,z,x, and replace by only one
-    // - For example,
-    //    b000z100    -> b0z100
-    //    b00000xxx   -> b0xxx
-    //    b000        -> b0
-    //    bzzzzz1     -> bz1
-    //    bxxxz10     -> xz10
-    // - For leading 0's followed by 1, remove all leading 0's
-    //    b0000010101 -> b10101  
-
-    char* position = originalbuf;
-
-    if( strlen(originalbuf) < 2 || (originalbuf[0] != 'z' && originalbuf[0] != 'x' && originalbuf[0] != '0' ))
-      return originalbuf;
-
-    char first_char = *position;
-    while(*position == first_char){
-        position++;
-    }
-
-    if(first_char == '0' && *position == '1'){ 
-        return position;
-    }
-    // else
-    return position-1;
-}
-
-vcd_trace::~vcd_trace()
-{
-  /* Intentionally Blank */
-}
-
-
-/**********************************************************************************************/
-
-class vcd_bool_trace : public vcd_trace {
-public:
-    vcd_bool_trace(const bool& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-
-protected:    
-    const bool& object;
-    bool old_value;
-};
-
-vcd_bool_trace::vcd_bool_trace(const bool& _object, const sc_string& _name, const sc_string& _vcd_name)
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    vcd_var_typ_name = "wire";
-    bit_width = 1;
-    old_value = object;
-}
-
-bool vcd_bool_trace::changed()
-{
-    return object != old_value;
-}
-
-void vcd_bool_trace::write(FILE* f)
-{
-    if (object == true) fputc('1', f); 
-    else fputc('0', f);
-
-    fprintf(f,"%s", (const char *) vcd_name);
-
-    old_value = object;
-}
-
-/*******************************************************************************************/
-
-class vcd_sc_logic_trace : public vcd_trace {
-public:
-    vcd_sc_logic_trace(const sc_logic& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-
-protected:    
-    const sc_logic& object;
-    sc_logic old_value;
-};
-
-
-vcd_sc_logic_trace::vcd_sc_logic_trace(const sc_logic& _object, const sc_string& _name, const sc_string& _vcd_name) 
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    vcd_var_typ_name = "wire";
-    bit_width = 1;
-    old_value = object;
-}
-
-
-bool vcd_sc_logic_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void vcd_sc_logic_trace::write(FILE* f)
-{
-    char out_char;
-    out_char = map_sc_logic_state_to_vcd_state(object.to_char());
-    fputc(out_char, f); 
-
-    fprintf(f,"%s", (const char *) vcd_name);
-
-    old_value = object;
-}
-
-/******************************************************************************************/
-
-class vcd_bool_vector_trace : public vcd_trace {
-public:
-    vcd_bool_vector_trace(const sc_bool_vector& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_bool_vector& object;
-    sc_bool_vector old_value;
-};
-
-
-vcd_bool_vector_trace::vcd_bool_vector_trace(const sc_bool_vector& _object, const sc_string& _name, const sc_string& _vcd_name) 
-  : vcd_trace(_name, _vcd_name), object(_object), old_value(_object.length()) // The last may look strange, but is correct
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool vcd_bool_vector_trace::changed()
-{
-    return object != old_value;
-}
-
-void vcd_bool_vector_trace::write(FILE* f)
-{
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[(object)[bitindex]];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
-
-    fputs(compdata, f);
-    old_value = object;
-}
+class vcd_buffer;
+class vcd_writer;
 
-void vcd_bool_vector_trace::set_width()
-{
-    bit_width = object.length();
-}
+// Write a name, removing problems associated with [] in vcd names
+static void put_vcd_name(vcd_buffer& out, const sc_string_view& name);
 
 
-/********************************************************************************/
+/*****************************************************************************/
 
-class vcd_sc_logic_vector_trace : public vcd_trace {
+// Output buffer of a VCD file.  Values are formatted directly into the
+// buffer, which is handed to the file with a single write whenever it
+// is full; the file itself is unbuffered.
+//
+// A raw buffer instead collects the value changes of an asynchronous
+// trace file in the form of records (see vcd_writer), and a full
+// buffer is handed to the writer thread.  In that case single chars
+// are copied to the output as they are, but vcd_trace and
+// vcd_trace_file format values, times and text through is_raw().
+class vcd_buffer {
 public:
-    vcd_sc_logic_vector_trace(const sc_logic_vector& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_logic_vector& object;
-    sc_logic_vector old_value;
-};
-
-vcd_sc_logic_vector_trace::vcd_sc_logic_vector_trace(const sc_logic_vector& _object, const sc_string& _name, const sc_string& _vcd_name) 
-  : vcd_trace(_name, _vcd_name), object(_object), old_value(_object.length()) // The last may look strange, but is correct
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool vcd_sc_logic_vector_trace::changed()
-{
-    return object != old_value;
-}
+    vcd_buffer(FILE* f, int size);
+    vcd_buffer(vcd_writer* w, int size);
+    ~vcd_buffer();
 
+    bool is_raw() const { return writer != 0; }
 
-void vcd_sc_logic_vector_trace::write(FILE* f)
-{
-    char in_char;
-    char out_char;
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for(bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        in_char = (object)[bitindex].to_char();
-        out_char = map_sc_logic_state_to_vcd_state(in_char);
-        *rawdata_ptr++ = out_char; 
+    // Returns room for at least n chars; the caller writes them and
+    // then passes the end of what it wrote to advance().
+    char* reserve(int n)
+    {
+        if (end - pos < n)
+            make_room(n);
+        return pos;
     }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
+    void advance(char* p) { pos = p; }
 
-    fputs(compdata, f);
-    old_value = object;
-}
-
-
-void vcd_sc_logic_vector_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-/******************************************************************************************/
-
-class vcd_sc_unsigned_trace : public vcd_trace {
-public:
-    vcd_sc_unsigned_trace(const sc_unsigned& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_unsigned& object;
-    sc_unsigned old_value;
-};
-
-
-vcd_sc_unsigned_trace::vcd_sc_unsigned_trace(const sc_unsigned& _object, const sc_string& _name, const sc_string& _vcd_name) 
-  : vcd_trace(_name, _vcd_name), object(_object), old_value(_object.length()) // The last may look strange, but is correct
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool vcd_sc_unsigned_trace::changed()
-{
-    return object != old_value;
-}
-
-void vcd_sc_unsigned_trace::write(FILE* f)
-{
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[(object)[bitindex]];
+    void put(char c)
+    {
+        if (pos == end)
+            flush();
+        *pos++ = c;
     }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
-
-    fputs(compdata, f);
-    old_value = object;
-}
-
-void vcd_sc_unsigned_trace::set_width()
-{
-    bit_width = object.length();
-}
+    void put(const char* s, int n);
+    void put(const char* s) { put(s, strlen(s)); }
 
+    void flush();
+    void resize(int size);
 
-/******************************************************************************************/
+private:
+    void make_room(int n);
 
-class vcd_sc_signed_trace : public vcd_trace {
-public:
-    vcd_sc_signed_trace(const sc_signed& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_signed& object;
-    sc_signed old_value;
+    FILE* fp;
+    vcd_writer* writer;
+    char* buf;
+    char* pos;
+    char* end;
 };
 
-
-vcd_sc_signed_trace::vcd_sc_signed_trace(const sc_signed& _object, const sc_string& _name, const sc_string& _vcd_name) 
-  : vcd_trace(_name, _vcd_name), object(_object), old_value(_object.length())
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool vcd_sc_signed_trace::changed()
-{
-    return object != old_value;
-}
-
-void vcd_sc_signed_trace::write(FILE* f)
-{
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[(object)[bitindex]];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
-
-    fputs(compdata, f);
-    old_value = object;
-}
-
-void vcd_sc_signed_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-/******************************************************************************************/
-
-class vcd_sc_uint_base_trace : public vcd_trace {
-public:
-    vcd_sc_uint_base_trace(const sc_uint_base& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_uint_base& object;
-    sc_uint_base old_value;
+// Asynchronous trace files.  The simulation thread only appends
+// records of the value changes to a raw vcd_buffer; a writer thread
+// formats them and writes the file.  There are two record buffers of
+// the same size: while the writer thread works through one, the
+// simulation fills the other.  If the simulation fills its buffer
+// before the writer thread is done, it waits, so memory use stays at
+// two buffers however far the writer falls behind.
+//
+// Records start with a tag:
+//    vcd_rec_time     unsigned high, low
+//    vcd_rec_text     int n, n chars
+//    vcd_rec_scalar   int trace, char value
+//    vcd_rec_integer  int trace, unsigned long value, char overflow
+//    vcd_rec_real     int trace, double value
+//    vcd_rec_vector   int trace, bit_width chars
+// Any other byte is copied to the output.
+enum {
+    vcd_rec_time = 1,
+    vcd_rec_text,
+    vcd_rec_scalar,
+    vcd_rec_integer,
+    vcd_rec_real,
+    vcd_rec_vector
 };
 
+// Room needed for a record of a trace, apart from the value
+const int vcd_rec_header_size = 1 + sizeof(int);
 
-vcd_sc_uint_base_trace::vcd_sc_uint_base_trace(const sc_uint_base& _object, const sc_string& _name, const sc_string& _vcd_name) 
-  : vcd_trace(_name, _vcd_name), object(_object), old_value(_object.width) // The last may look strange, but is correct
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool vcd_sc_uint_base_trace::changed()
-{
-    return object != old_value;
-}
-
-void vcd_sc_uint_base_trace::write(FILE* f)
-{
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.width-1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[int((object)[bitindex])];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
-
-    fputs(compdata, f);
-    old_value = object;
-}
-
-void vcd_sc_uint_base_trace::set_width()
-{
-    bit_width = object.width;
-}
-
-
-/******************************************************************************************/
+#ifdef WIN32
+typedef HANDLE vcd_thread_type;
+#else
+typedef pthread_t vcd_thread_type;
+#endif
 
-class vcd_sc_int_base_trace : public vcd_trace {
+class vcd_writer {
 public:
-    vcd_sc_int_base_trace(const sc_int_base& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_int_base& object;
-    sc_int_base old_value;
-};
-
-
-vcd_sc_int_base_trace::vcd_sc_int_base_trace(const sc_int_base& _object, const sc_string& _name, const sc_string& _vcd_name) 
-  : vcd_trace(_name, _vcd_name), object(_object), old_value(_object.width)
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool vcd_sc_int_base_trace::changed()
-{
-    return object != old_value;
-}
-
-void vcd_sc_int_base_trace::write(FILE* f)
-{
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.width-1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[int((object)[bitindex])];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
-
-    fputs(compdata, f);
-    old_value = object;
-}
-
-void vcd_sc_int_base_trace::set_width()
-{
-    bit_width = object.width;
-}
-
-
-#ifdef SC_INCLUDE_FX
-
-/*****************************************************************************/
-
-class vcd_sc_fxval_trace : public vcd_trace
-{
-public:
-
-    vcd_sc_fxval_trace( const sc_fxval& object,
-			const sc_string& _name,
-			const sc_string& _vcd_name );
-    void write( FILE* f );
-    bool changed();
-
-protected:
-
-    const sc_fxval& object;
-    sc_fxval old_value;
-
-};
-
-vcd_sc_fxval_trace::vcd_sc_fxval_trace( const sc_fxval& _object,
-				        const sc_string& _name,
-					const sc_string& _vcd_name )
-: vcd_trace( _name, _vcd_name ),
-  object( _object )
-{
-    vcd_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
-}
-
-bool
-vcd_sc_fxval_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-vcd_sc_fxval_trace::write( FILE* f )
-{
-    fprintf( f, "r%.16g %s", object.to_double(), (const char*) vcd_name );
-    old_value = object;
-}
-
-/*****************************************************************************/
-
-class vcd_sc_fxval_fast_trace : public vcd_trace
-{
-public:
-
-    vcd_sc_fxval_fast_trace( const sc_fxval_fast& object,
-			     const sc_string& _name,
-			     const sc_string& _vcd_name );
-    void write( FILE* f );
-    bool changed();
-
-protected:
-
-    const sc_fxval_fast& object;
-    sc_fxval_fast old_value;
-
-};
-
-vcd_sc_fxval_fast_trace::vcd_sc_fxval_fast_trace( const sc_fxval_fast& _object,
-						  const sc_string& _name,
-						  const sc_string& _vcd_name )
-: vcd_trace( _name, _vcd_name ),
-  object( _object )
-{
-    vcd_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
-}
-
-bool
-vcd_sc_fxval_fast_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-vcd_sc_fxval_fast_trace::write( FILE* f )
-{
-    fprintf( f, "r%.16g %s", object.to_double(), (const char*) vcd_name );
-    old_value = object;
-}
-
-/*****************************************************************************/
-
-class vcd_sc_fxnum_trace : public vcd_trace
-{
-public:
-
-    vcd_sc_fxnum_trace( const sc_fxnum& object,
-			const sc_string& _name,
-			const sc_string& _vcd_name );
-    void write( FILE* f );
-    bool changed();
-    void set_width();
-
-protected:
-
-    const sc_fxnum& object;
-    sc_fxnum old_value;
-
-};
-
-vcd_sc_fxnum_trace::vcd_sc_fxnum_trace( const sc_fxnum& _object,
-				        const sc_string& _name,
-					const sc_string& _vcd_name )
-: vcd_trace( _name, _vcd_name ),
-  object( _object ),
-  old_value( _object._params.type_params(),
-	     _object._params.enc(),
-	     _object._params.cast_switch(),
-	     0 )
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool
-vcd_sc_fxnum_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-vcd_sc_fxnum_trace::write( FILE* f )
-{
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for( bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
-    {
-        *rawdata_ptr ++ = "01"[(object)[bitindex]];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line( rawdata, compdata );
-
-    fputs( compdata, f );
-    old_value = object;
-}
-
-void
-vcd_sc_fxnum_trace::set_width()
-{
-    bit_width = object.wl();
-}
-
-/*****************************************************************************/
-
-class vcd_sc_fxnum_fast_trace : public vcd_trace
-{
-public:
-
-    vcd_sc_fxnum_fast_trace( const sc_fxnum_fast& object,
-			     const sc_string& _name,
-			     const sc_string& _vcd_name );
-    void write( FILE* f );
-    bool changed();
-    void set_width();
-
-protected:
-
-    const sc_fxnum_fast& object;
-    sc_fxnum_fast old_value;
-
-};
-
-vcd_sc_fxnum_fast_trace::vcd_sc_fxnum_fast_trace( const sc_fxnum_fast& _object,
-						  const sc_string& _name,
-						  const sc_string& _vcd_name )
-: vcd_trace( _name, _vcd_name ),
-  object( _object ),
-  old_value( _object._params.type_params(),
-	     _object._params.enc(),
-	     _object._params.cast_switch(),
-	     0 )
-{
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-bool
-vcd_sc_fxnum_fast_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-vcd_sc_fxnum_fast_trace::write( FILE* f )
-{
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for( bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
-    {
-        *rawdata_ptr ++ = "01"[(object)[bitindex]];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line( rawdata, compdata );
-
-    fputs( compdata, f );
-    old_value = object;
-}
-
-void
-vcd_sc_fxnum_fast_trace::set_width()
-{
-    bit_width = object.wl();
-}
-
+    // The writer thread writes the values of traces[0] ... traces[n-1]
+    // to out, which it takes over.
+    vcd_writer(vcd_trace* const* traces, int n, vcd_buffer* out, int size);
+    // Writes the records handed over so far and stops the thread.
+    ~vcd_writer();
+
+    // Hands over the n bytes of records in full, and returns an empty
+    // buffer; waits until the writer thread is done with the previous
+    // one.
+    char* exchange(char* full, int n);
+
+private:
+#ifdef WIN32
+    static DWORD WINAPI thread_main(LPVOID arg);
+#else
+    static void* thread_main(void* arg);
 #endif
+    void run();
+    void write_records(const char* p, const char* q);
+
+    void lock();
+    void unlock();
+    void wait_ready();
+    void signal_ready();
+    void wait_done();
+    void signal_done();
+
+    vcd_trace** traces;
+    int n_traces;
+    vcd_buffer* out;
+
+    // Protected by the lock
+    char* full;                 // buffer to be written, or 0
+    int full_len;
+    char* empty;                // buffer written, or 0
+    bool stopping;
+
+    vcd_thread_type thread;
+#ifdef WIN32
+    CRITICAL_SECTION mutex;
+    HANDLE ready_event;
+    HANDLE done_event;
+#else
+    pthread_mutex_t mutex;
+    pthread_cond_t ready_cond;
+    pthread_cond_t done_cond;
+#endif
+};
 
-
-/**************************************************************************************/
-
-class vcd_unsigned_int_trace : public vcd_trace {
-public:
-    vcd_unsigned_int_trace(const unsigned& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const unsigned& object;
-    unsigned old_value;
-    unsigned mask; 
-};
-
-
-vcd_unsigned_int_trace::vcd_unsigned_int_trace(const unsigned& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-
-bool vcd_unsigned_int_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void vcd_unsigned_int_trace::write(FILE* f)
-{
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
-}
-
-/**************************************************************************************/
-
-class vcd_unsigned_short_trace : public vcd_trace {
-public:
-    vcd_unsigned_short_trace(const unsigned short& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const unsigned short& object;
-    unsigned short old_value;
-    unsigned short mask; 
-};
-
-
-vcd_unsigned_short_trace::vcd_unsigned_short_trace(const unsigned short& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 16) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffff;
-    }
-
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-
-bool vcd_unsigned_short_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void vcd_unsigned_short_trace::write(FILE* f)
-{
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
-}
-
-/**************************************************************************************/
-
-class vcd_unsigned_char_trace : public vcd_trace {
-public:
-    vcd_unsigned_char_trace(const unsigned char& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const unsigned char& object;
-    unsigned char old_value;
-    unsigned char mask; 
-};
-
-
-vcd_unsigned_char_trace::vcd_unsigned_char_trace(const unsigned char& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 8) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xff;
-    }
-
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-
-bool vcd_unsigned_char_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void vcd_unsigned_char_trace::write(FILE* f)
-{
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
-}
-
-/**************************************************************************************/
-
-class vcd_unsigned_long_trace : public vcd_trace {
-public:
-    vcd_unsigned_long_trace(const unsigned long& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const unsigned long& object;
-    unsigned long old_value;
-    unsigned long mask; 
-};
-
-
-vcd_unsigned_long_trace::vcd_unsigned_long_trace(const unsigned long& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-
-bool vcd_unsigned_long_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void vcd_unsigned_long_trace::write(FILE* f)
-{
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
-}
-
-/**************************************************************************************/
-
-class vcd_signed_int_trace : public vcd_trace {
-public:
-    vcd_signed_int_trace(const int& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const int& object;
-    int old_value;
-    unsigned mask; 
-};
-
-
-vcd_signed_int_trace::vcd_signed_int_trace(const signed& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
-
-
-bool vcd_signed_int_trace::changed()
+vcd_buffer::vcd_buffer(FILE* f, int size)
+    : fp(f), writer(0), buf(0)
 {
-    return object != old_value;
+    resize(size);
 }
 
+vcd_buffer::vcd_buffer(vcd_writer* w, int size)
+    : fp(0), writer(0), buf(0)
+{
+    resize(size);
+    writer = w;
+}
 
-void vcd_signed_int_trace::write(FILE* f)
+vcd_buffer::~vcd_buffer()
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
+    flush();
+    delete[] buf;
+}
 
-    // Check for overflow
-    if (((unsigned) object & mask) != (unsigned) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
+void vcd_buffer::put(const char* s, int n)
+{
+    if (writer == 0) {
+        memcpy(reserve(n), s, n);
+        pos += n;
+        return;
     }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
+    // Text goes in records no larger than the minimum buffer size
+    while (n > 0) {
+        int k = (n < 1024) ? n : 1024;
+        char* p = reserve(1 + sizeof(int) + k);
+        *p++ = vcd_rec_text;
+        memcpy(p, &k, sizeof(int));
+        p += sizeof(int);
+        memcpy(p, s, k);
+        pos = p + k;
+        s += k;
+        n -= k;
+    }
+}
+
+void vcd_buffer::flush()
+{
+    if (pos != buf) {
+        if (writer != 0) {
+            int size = end - buf;
+            buf = writer->exchange(buf, pos - buf);
+            end = buf + size;
         }
+        else if (fwrite(buf, 1, pos - buf, fp) != (size_t) (pos - buf))
+            vcd_put_error_message("Cannot write to VCD trace file.", false);
+        pos = buf;
     }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
 }
 
-/**************************************************************************************/
+void vcd_buffer::resize(int size)
+{
+    // The writer thread relies on raw buffers keeping their size
+    assert(writer == 0);
+    if (buf != 0)
+        flush();
+    if (size < 4096)
+        size = 4096;
+    delete[] buf;
+    buf = new char[size];
+    pos = buf;
+    end = buf + size;
+}
+
+void vcd_buffer::make_room(int n)
+{
+    flush();
+    // A single value that does not fit into the whole buffer; raw
+    // buffers are made large enough for any record.
+    if (end - buf < n)
+        resize(n);
+}
 
-class vcd_signed_short_trace : public vcd_trace {
-public:
-    vcd_signed_short_trace(const short& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
+/*****************************************************************************/
 
-protected:
-    const short& object;
-    short old_value;
-    unsigned short mask; 
-};
+// Hand-rolled formatting; each function writes at p and returns the
+// end of what it wrote.
 
+static char vcd_byte_bits[256][8];
 
-vcd_signed_short_trace::vcd_signed_short_trace(const short& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
+static void
+vcd_init_byte_bits()
 {
-    bit_width = _width;
-    if (bit_width < 16) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffff;
+    static bool done = false;
+    if (done)
+        return;
+    for (int v = 0; v < 256; v++) {
+        for (int i = 0; i < 8; i++)
+            vcd_byte_bits[v][i] = (char) ('0' + ((v >> (7 - i)) & 1));
     }
-
-    vcd_var_typ_name = "wire";
-    old_value = object;
+    done = true;
 }
 
-
-bool vcd_signed_short_trace::changed()
+// The n low bits of v, most significant first
+static char*
+vcd_put_bits(char* p, unsigned long v, int n)
 {
-    return object != old_value;
+    while (n & 7) {
+        --n;
+        *p++ = (char) ('0' + ((v >> n) & 1));
+    }
+    while (n > 0) {
+        n -= 8;
+        memcpy(p, vcd_byte_bits[(v >> n) & 0xff], 8);
+        p += 8;
+    }
+    return p;
 }
 
+// Number of bits needed for v, at least 1
+static int
+vcd_bit_length(unsigned long v)
+{
+    int n = 1;
+    while (v >> 8) {
+        v >>= 8;
+        n += 8;
+    }
+    while (v >> 1) {
+        v >>= 1;
+        n++;
+    }
+    return n;
+}
 
-void vcd_signed_short_trace::write(FILE* f)
+static char*
+vcd_put_decimal(char* p, unsigned v)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
+    char tmp[10];
+    int n = 0;
+    do {
+        tmp[n++] = (char) ('0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    while (n > 0)
+        *p++ = tmp[--n];
+    return p;
+}
 
-    // Check for overflow
-    if (((unsigned short) object & mask) != (unsigned short) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
+// Exactly 9 digits, with leading zeros
+static char*
+vcd_put_decimal9(char* p, unsigned v)
+{
+    for (int i = 8; i >= 0; i--) {
+        p[i] = (char) ('0' + v % 10);
+        v /= 10;
     }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
+    return p + 9;
+}
+
+// Number of leading bits of a vector value that VCD lets us drop:
+//    b000z100    -> b0z100
+//    b00000xxx   -> b0xxx
+//    b000        -> b0
+//    bzzzzz1     -> bz1
+//    bxxxz10     -> bxz10
+// Leading 0's followed by 1 are removed altogether:
+//    b0000010101 -> b10101
+static int
+vcd_strip_count(const char* bits, int n)
+{
+    char first_char = bits[0];
+    if (n < 2 || (first_char != 'z' && first_char != 'x' && first_char != '0'))
+        return 0;
+    int i = 1;
+    while (i < n && bits[i] == first_char)
+        i++;
+    if (first_char == '0' && i < n && bits[i] == '1')
+        return i;
+    return i - 1;
 }
 
-/**************************************************************************************/
+/*****************************************************************************/
 
-class vcd_signed_char_trace : public vcd_trace {
+// Base class for the traces
+class vcd_trace {
 public:
-    vcd_signed_char_trace(const char& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
+    vcd_trace(const sc_string& _name, const sc_string& _vcd_name);
 
-protected:
-    const char& object;
-    char old_value;
-    unsigned char mask; 
-};
+    // Needs to be pure virtual as has to be defined by the particular
+    // type being traced
+    virtual void write(vcd_buffer& out) = 0;
+    
+    virtual void set_width();
 
+    // Comparison function needs to be pure virtual too
+    virtual bool changed() = 0;
 
-vcd_signed_char_trace::vcd_signed_char_trace(const char& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 8) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xff;
-    }
+    // Make this virtual as some derived classes may overwrite
+    virtual void print_variable_declaration_line(vcd_buffer& out);
+
+    // Value formatting for write().  Vector bits are written by the
+    // caller, most significant first, between begin_vector() and
+    // end_vector().  For a raw buffer, these write the value as a
+    // record instead.
+    void put_scalar(vcd_buffer& out, char c);
+    void put_integer(vcd_buffer& out, unsigned long v, bool overflow);
+    void put_real(vcd_buffer& out, double v);
+    char* begin_vector(vcd_buffer& out);
+    void end_vector(vcd_buffer& out, char* bits);
 
-    vcd_var_typ_name = "wire";
-    old_value = object;
-}
+    virtual ~vcd_trace();
+
+    const sc_string name;
+    const sc_string vcd_name;
+    const char* vcd_var_typ_name;
+    int bit_width; 
+    int vcd_name_length;
+    int trace_index;            // in the trace file, set by initialize()
+};
 
 
-bool vcd_signed_char_trace::changed()
+vcd_trace::vcd_trace(const sc_string& _name, const sc_string& _vcd_name)
+       : name(_name), vcd_name(_vcd_name), bit_width(0), trace_index(0)
 {
-    return object != old_value;
+    vcd_name_length = vcd_name.length();
 }
 
+// Starts a record of this trace in a raw buffer
+static inline char*
+vcd_put_record(char* p, char tag, int trace_index)
+{
+    *p++ = tag;
+    memcpy(p, &trace_index, sizeof(int));
+    return p + sizeof(int);
+}
 
-void vcd_signed_char_trace::write(FILE* f)
+void vcd_trace::put_scalar(vcd_buffer& out, char c)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
+    if (out.is_raw()) {
+        char* p = out.reserve(vcd_rec_header_size + 1);
+        p = vcd_put_record(p, vcd_rec_scalar, trace_index);
+        *p++ = c;
+        out.advance(p);
+        return;
+    }
+    char* p = out.reserve(vcd_name_length + 1);
+    *p++ = c;
+    memcpy(p, vcd_name.c_str(), vcd_name_length);
+    out.advance(p + vcd_name_length);
+}
 
-    // Check for overflow
-    if (((unsigned char) object & mask) != (unsigned char) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
+void vcd_trace::put_integer(vcd_buffer& out, unsigned long v, bool overflow)
+{
+    if (bit_width == 0)
+        return;
+    if (out.is_raw()) {
+        char* p = out.reserve(vcd_rec_header_size + sizeof(long) + 1);
+        p = vcd_put_record(p, vcd_rec_integer, trace_index);
+        memcpy(p, &v, sizeof(long));
+        p += sizeof(long);
+        *p++ = overflow;
+        out.advance(p);
+        return;
     }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
+    char* p = out.reserve(bit_width + vcd_name_length + 3);
+    if (bit_width == 1) {
+        *p++ = overflow ? 'x' : (char) ('0' + (v & 1));
     }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
+    else {
+        *p++ = 'b';
+        if (overflow)
+            *p++ = 'x';
+        else
+            p = vcd_put_bits(p, v, vcd_bit_length(v));
+        *p++ = ' ';
+    }
+    memcpy(p, vcd_name.c_str(), vcd_name_length);
+    out.advance(p + vcd_name_length);
 }
 
-/**************************************************************************************/
-
-class vcd_signed_long_trace : public vcd_trace {
-public:
-    vcd_signed_long_trace(const long& object, const sc_string& _name, const sc_string& _vcd_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const long& object;
-    long old_value;
-    unsigned long mask; 
-};
-
-
-vcd_signed_long_trace::vcd_signed_long_trace(const long& _object, const sc_string& _name, const sc_string& _vcd_name, int _width) 
-  : vcd_trace(_name, _vcd_name), object(_object)
+void vcd_trace::put_real(vcd_buffer& out, double v)
 {
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
+    if (out.is_raw()) {
+        char* p = out.reserve(vcd_rec_header_size + sizeof(double));
+        p = vcd_put_record(p, vcd_rec_real, trace_index);
+        memcpy(p, &v, sizeof(double));
+        out.advance(p + sizeof(double));
+        return;
     }
-
-    vcd_var_typ_name = "wire";
-    old_value = object;
+    char* p = out.reserve(vcd_name_length + 32);
+    p += sprintf(p, "r%.16g ", v);
+    memcpy(p, vcd_name.c_str(), vcd_name_length);
+    out.advance(p + vcd_name_length);
 }
 
-
-bool vcd_signed_long_trace::changed()
+char* vcd_trace::begin_vector(vcd_buffer& out)
 {
-    return object != old_value;
+    if (out.is_raw()) {
+        char* p = out.reserve(vcd_rec_header_size + bit_width);
+        return vcd_put_record(p, vcd_rec_vector, trace_index);
+    }
+    return out.reserve(bit_width + vcd_name_length + 3) + 1;
 }
 
+void vcd_trace::end_vector(vcd_buffer& out, char* bits)
+{
+    char* p = bits - 1;
+    if (bit_width == 0)
+        return;
+    if (out.is_raw()) {
+        out.advance(bits + bit_width);
+        return;
+    }
+    if (bit_width == 1) {
+        *p++ = bits[0];
+    }
+    else {
+        int n = vcd_strip_count(bits, bit_width);
+        *p = 'b';
+        if (n > 0)
+            memmove(bits, bits + n, bit_width - n);
+        p = bits + bit_width - n;
+        *p++ = ' ';
+    }
+    memcpy(p, vcd_name.c_str(), vcd_name_length);
+    out.advance(p + vcd_name_length);
+}
 
-void vcd_signed_long_trace::write(FILE* f)
+void vcd_trace::print_variable_declaration_line(vcd_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
+    char buf[2000];
 
-    // Check for overflow
-    if (((unsigned long) object & mask) != (unsigned long) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
+    if(bit_width == 0){
+        sprintf(buf, "Traced object \"%s\" has 0 Bits, cannot be traced.", (const char *) name);
+        vcd_put_error_message(buf, false);
     }
     else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
+        sprintf(buf, "$var %s  % 3d  %s  ",
+                vcd_var_typ_name, bit_width, (const char *) vcd_name);
+        out.put(buf);
+        put_vcd_name(out, name);
+        out.put("       $end\n");
     }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
+}
+
+void vcd_trace::set_width()
+{
+  /* Intentionally Blank, should be defined for each type separately */
+}
+
+vcd_trace::~vcd_trace()
+{
+  /* Intentionally Blank */
 }
 
 
 /**********************************************************************************************/
 
-class vcd_float_trace : public vcd_trace {
-public:
-    vcd_float_trace(const float& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
+// Encoders of the kinds of values (see sc_trace_value.h)
 
-protected:    
-    const float& object;
-    float old_value;
-};
+static inline const char* vcd_var_type(sc_trace_real) { return "real"; }
+template< class K >
+inline const char* vcd_var_type(K) { return "wire"; }
 
-vcd_float_trace::vcd_float_trace(const float& _object, const sc_string& _name, const sc_string& _vcd_name)
-  : vcd_trace(_name, _vcd_name), object(_object)
+template< class T >
+inline void
+vcd_put_value(vcd_trace& t, vcd_buffer& out, const T& object, sc_trace_bit)
 {
-    vcd_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
+    t.put_scalar(out, object ? '1' : '0');
 }
 
-bool vcd_float_trace::changed()
+template< class T >
+inline void
+vcd_put_value(vcd_trace& t, vcd_buffer& out, const T& object, sc_trace_logic)
 {
-    return object != old_value;
+    t.put_scalar(out, map_sc_logic_state_to_vcd_state(object.to_char()));
 }
 
-void vcd_float_trace::write(FILE* f)
+template< class T >
+inline void
+vcd_put_value(vcd_trace& t, vcd_buffer& out, const T& object, sc_trace_bits)
 {
-    fprintf(f, "r%.16g %s", object, (const char *) vcd_name);
-    old_value = object;
+    char* const bits = t.begin_vector(out);
+    sc_trace_get_bits(object, t.bit_width, bits);
+    t.end_vector(out, bits);
 }
 
-/**********************************************************************************************/
-
-class vcd_double_trace : public vcd_trace {
-public:
-    vcd_double_trace(const double& object, const sc_string& _name, const sc_string& _vcd_name);
-    void write(FILE* f);
-    bool changed();
-
-protected:    
-    const double& object;
-    double old_value;
-};
-
-vcd_double_trace::vcd_double_trace(const double& _object, const sc_string& _name, const sc_string& _vcd_name)
-  : vcd_trace(_name, _vcd_name), object(_object)
+template< class T >
+inline void
+vcd_put_value(vcd_trace& t, vcd_buffer& out, const T& object, sc_trace_logics)
 {
-    vcd_var_typ_name = "real";
-    bit_width = 1;
-    old_value = object;
+    char* const bits = t.begin_vector(out);
+    sc_trace_get_bits(object, t.bit_width, bits);
+    for (int i = 0; i < t.bit_width; ++i)
+        bits[i] = map_sc_logic_state_to_vcd_state(bits[i]);
+    t.end_vector(out, bits);
 }
 
-bool vcd_double_trace::changed()
+template< class T >
+inline void
+vcd_put_value(vcd_trace& t, vcd_buffer& out, const T& object, sc_trace_integer)
 {
-    return object != old_value;
+    // Check for overflow
+    unsigned long v;
+    bool fits = sc_trace_get_integer(object, t.bit_width, v);
+    t.put_integer(out, v, !fits);
 }
 
-void vcd_double_trace::write(FILE* f)
+template< class T >
+inline void
+vcd_put_value(vcd_trace& t, vcd_buffer& out, const T& object, sc_trace_real)
 {
-    fprintf(f, "r%.16g %s", object, (const char *) vcd_name);
-    old_value = object;
+    t.put_real(out, sc_trace_to_double(object));
 }
 
+// The trace of an object of any traced type but enumerations
+template< class T >
+class vcd_typed_trace : public vcd_trace {
+public:
+    typedef typename sc_trace_traits<T>::kind kind;
+
+    vcd_typed_trace(const T& _object, const sc_string& _name, const sc_string& _vcd_name, int _width = 1)
+      : vcd_trace(_name, _vcd_name), value(_object)
+    {
+        vcd_var_typ_name = vcd_var_type(kind());
+        bit_width = sc_trace_width(_object, _width);
+    }
+
+    void write(vcd_buffer& out)
+    {
+        vcd_put_value(*this, out, value.object, kind());
+        value.update_old();
+    }
+
+    bool changed() { return value.changed(); }
+
+    // Vectors may have been resized since they were traced
+    void set_width() { bit_width = sc_trace_width(value.object, bit_width); }
+
+protected:
+    sc_trace_value<T> value;
+};
 
 /********************************************************************************************/
 
 class vcd_enum_trace : public vcd_trace {
 public:
     vcd_enum_trace(const unsigned& _object, const sc_string& _name, const sc_string& _vcd_name, const char** enum_literals);
-    void write(FILE* f);
+    void write(vcd_buffer& out);
     bool changed();
 
 protected:
@@ -1384,31 +709,241 @@ bool vcd_enum_trace::changed()
     return object != old_value;
 }
 
-void vcd_enum_trace::write(FILE* f)
+void vcd_enum_trace::write(vcd_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
+    put_integer(out, object, (object & mask) != object);
+    old_value = object;
+}
+
+
+// Writes "#<time>\n"
+static void
+put_vcd_time(vcd_buffer& out, unsigned high, unsigned low)
+{
+    char* p;
+    if (out.is_raw()) {
+        p = out.reserve(1 + 2 * sizeof(unsigned));
+        *p++ = vcd_rec_time;
+        memcpy(p, &high, sizeof(unsigned));
+        memcpy(p + sizeof(unsigned), &low, sizeof(unsigned));
+        out.advance(p + 2 * sizeof(unsigned));
+        return;
     }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
+    p = out.reserve(24);
+    *p++ = '#';
+    if (high) {
+        p = vcd_put_decimal(p, high);
+        p = vcd_put_decimal9(p, low);
+    }
+    else {
+        p = vcd_put_decimal(p, low);
+    }
+    *p++ = '\n';
+    out.advance(p);
+}
+
+
+/**************************************************************************************************
+           vcd_writer functions
+***************************************************************************************************/
+
+
+vcd_writer::vcd_writer(vcd_trace* const* _traces, int n, vcd_buffer* _out, int size)
+    : n_traces(n), out(_out)
+{
+    // The trace file may still grow, so keep a copy of the array
+    traces = new vcd_trace*[n];
+    for (int i = 0; i < n; i++)
+        traces[i] = _traces[i];
+
+    full = 0;
+    full_len = 0;
+    empty = new char[size];
+    stopping = false;
+
+#ifdef WIN32
+    InitializeCriticalSection(&mutex);
+    ready_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    done_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    DWORD id;
+    thread = CreateThread(NULL, 0, &vcd_writer::thread_main, this, 0, &id);
+    bool failed = (thread == NULL);
+#else
+    pthread_mutex_init(&mutex, 0);
+    pthread_cond_init(&ready_cond, 0);
+    pthread_cond_init(&done_cond, 0);
+    bool failed = (pthread_create(&thread, 0, &vcd_writer::thread_main, this) != 0);
+#endif
+    if (failed) {
+        fprintf(stderr, "FATAL: Cannot start the VCD writer thread\n");
+        exit(1);
+    }
+}
+
+vcd_writer::~vcd_writer()
+{
+    lock();
+    stopping = true;
+    signal_ready();
+    unlock();
+#ifdef WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+    CloseHandle(ready_event);
+    CloseHandle(done_event);
+    DeleteCriticalSection(&mutex);
+#else
+    pthread_join(thread, 0);
+    pthread_cond_destroy(&ready_cond);
+    pthread_cond_destroy(&done_cond);
+    pthread_mutex_destroy(&mutex);
+#endif
+    delete[] empty;
+    delete out;
+    delete[] traces;
+}
+
+char* vcd_writer::exchange(char* buf, int n)
+{
+    lock();
+    // Back-pressure: the writer thread still has the other buffer
+    while (empty == 0)
+        wait_done();
+    char* e = empty;
+    empty = 0;
+    full = buf;
+    full_len = n;
+    signal_ready();
+    unlock();
+    return e;
+}
+
+#ifdef WIN32
+DWORD WINAPI vcd_writer::thread_main(LPVOID arg)
+{
+    ((vcd_writer*) arg)->run();
+    return 0;
+}
+#else
+void* vcd_writer::thread_main(void* arg)
+{
+    ((vcd_writer*) arg)->run();
+    return 0;
+}
+#endif
+
+void vcd_writer::run()
+{
+    lock();
+    while (true) {
+        while (full == 0 && ! stopping)
+            wait_ready();
+        if (full == 0)
+            break;
+        char* buf = full;
+        int n = full_len;
+        full = 0;
+        unlock();
+
+        write_records(buf, buf + n);
+
+        lock();
+        empty = buf;
+        signal_done();
+    }
+    unlock();
+    out->flush();
+}
+
+void vcd_writer::write_records(const char* p, const char* q)
+{
+    vcd_buffer& o = *out;
+    while (p < q) {
+        char tag = *p++;
+        if (tag == vcd_rec_time) {
+            unsigned high, low;
+            memcpy(&high, p, sizeof(unsigned));
+            memcpy(&low, p + sizeof(unsigned), sizeof(unsigned));
+            p += 2 * sizeof(unsigned);
+            put_vcd_time(o, high, low);
+            continue;
+        }
+        if (tag == vcd_rec_text) {
+            int n;
+            memcpy(&n, p, sizeof(int));
+            p += sizeof(int);
+            o.put(p, n);
+            p += n;
+            continue;
+        }
+        if (tag < vcd_rec_scalar || tag > vcd_rec_vector) {
+            o.put(tag);
+            continue;
+        }
+
+        int i;
+        memcpy(&i, p, sizeof(int));
+        p += sizeof(int);
+        assert(i < n_traces);
+        vcd_trace* t = traces[i];
+        switch (tag) {
+        case vcd_rec_scalar:
+            t->put_scalar(o, *p++);
+            break;
+        case vcd_rec_integer: {
+            unsigned long v;
+            memcpy(&v, p, sizeof(long));
+            p += sizeof(long);
+            t->put_integer(o, v, *p++ != 0);
+            break;
+        }
+        case vcd_rec_real: {
+            double v;
+            memcpy(&v, p, sizeof(double));
+            p += sizeof(double);
+            t->put_real(o, v);
+            break;
+        }
+        case vcd_rec_vector: {
+            char* bits = t->begin_vector(o);
+            memcpy(bits, p, t->bit_width);
+            p += t->bit_width;
+            t->end_vector(o, bits);
+            break;
+        }
         }
     }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata);
-    fputs(compdata, f);
-    old_value = object;
 }
 
+#ifdef WIN32
+// Each event has a single waiter, and a SetEvent() with no waiter
+// stays signaled, so no wakeup is lost.
+void vcd_writer::lock()          { EnterCriticalSection(&mutex); }
+void vcd_writer::unlock()        { LeaveCriticalSection(&mutex); }
+void vcd_writer::wait_ready()
+{
+    LeaveCriticalSection(&mutex);
+    WaitForSingleObject(ready_event, INFINITE);
+    EnterCriticalSection(&mutex);
+}
+void vcd_writer::signal_ready()  { SetEvent(ready_event); }
+void vcd_writer::wait_done()
+{
+    LeaveCriticalSection(&mutex);
+    WaitForSingleObject(done_event, INFINITE);
+    EnterCriticalSection(&mutex);
+}
+void vcd_writer::signal_done()   { SetEvent(done_event); }
+#else
+void vcd_writer::lock()          { pthread_mutex_lock(&mutex); }
+void vcd_writer::unlock()        { pthread_mutex_unlock(&mutex); }
+void vcd_writer::wait_ready()    { pthread_cond_wait(&ready_cond, &mutex); }
+void vcd_writer::signal_ready()  { pthread_cond_signal(&ready_cond); }
+void vcd_writer::wait_done()     { pthread_cond_wait(&done_cond, &mutex); }
+void vcd_writer::signal_done()   { pthread_cond_signal(&done_cond); }
+#endif
+
 
 /**************************************************************************************************
            vcd_trace_file functions
@@ -1425,6 +960,14 @@ vcd_trace_file::vcd_trace_file(const char *name)
         fprintf(stderr, "FATAL: %s\n", (const char *) msg);
         exit(1);
     }
+    // All output goes through the vcd_buffer, so that each flush
+    // is a single write to the file
+    setvbuf(fp, 0, _IONBF, 0);
+    buffer_size = default_buffer_size;
+    out = new vcd_buffer(fp, buffer_size);
+    writer = 0;
+    async = false;
+    vcd_init_byte_bits();
     trace_delta_cycles = false; // Make this the default
     initialized = false;
     vcd_name_index = 0;
@@ -1445,10 +988,14 @@ void vcd_trace_file::initialize()
     struct tm* p_tm;
     p_tm = localtime(&long_time);
     strftime(buf, 199, "%b %d, %Y       %H:%M:%S", p_tm);
-    fprintf(fp, "$date\n     %s\n$end\n\n", buf);
+    out->put("$date\n     ");
+    out->put(buf);
+    out->put("\n$end\n\n");
 
     //version:
-    fprintf(fp, "$version\n %s\n$end\n\n", sc_version());
+    out->put("$version\n ");
+    out->put(sc_version());
+    out->put("\n$end\n\n");
 
     //timescale:
     if     (timescale_unit == 1e-15) sprintf(buf, "1 fs");
@@ -1469,7 +1016,9 @@ void vcd_trace_file::initialize()
     else if(timescale_unit == 1e0)   sprintf(buf, "1 s");
     else if(timescale_unit == 1e1)   sprintf(buf, "10 s");
     else if(timescale_unit == 1e2)   sprintf(buf, "100 s");
-    fprintf(fp,"$timescale\n     %s\n$end\n\n",buf);
+    out->put("$timescale\n     ");
+    out->put(buf);
+    out->put("\n$end\n\n");
 
     running_regression = (getenv("SCENIC_REGRESSION") == NULL);
     // Don't print message if running regression
@@ -1478,19 +1027,20 @@ void vcd_trace_file::initialize()
     }
 
     // Create a dummy scope
-    fputs("$scope module SystemC $end\n", fp);
+    out->put("$scope module SystemC $end\n");
 
     //variable definitions:
     int i;
     for (i = 0; i < traces.size(); i++) {
         vcd_trace* t = traces[i];
         t->set_width(); // needed for all vectors
-        t->print_variable_declaration_line(fp);
+        t->trace_index = i;
+        t->print_variable_declaration_line(*out);
     }
 
-    fputs("$upscope $end\n", fp);
+    out->put("$upscope $end\n");
 
-    fputs("$enddefinitions  $end\n\n", fp);
+    out->put("$enddefinitions  $end\n\n");
 
     double inittime = sc_simulation_time();
     sprintf(buf,
@@ -1505,13 +1055,34 @@ void vcd_trace_file::initialize()
                             &previous_time_units_low );
 
 
-    fputs("$dumpvars\n",fp);
+    init_change_detection(traces.size());
+
+    out->put("$dumpvars\n");
     for (i = 0; i < traces.size(); i++) {
         vcd_trace* t = traces[i];
-        t->write(fp);
-        fputc('\n', fp);
+        t->write(*out);
+        out->put('\n');
+    }
+    out->put("$end\n\n");
+
+    if (async)
+        start_writer();
+}
+
+
+// From now on the simulation only records the value changes, and the
+// writer thread writes the file
+void vcd_trace_file::start_writer()
+{
+    // Room for a record of any trace
+    int size = buffer_size;
+    for (int i = 0; i < traces.size(); i++) {
+        int n = 2 * (vcd_rec_header_size + traces[i]->bit_width + 8);
+        if (size < n)
+            size = n;
     }
-    fputs("$end\n\n", fp);
+    writer = new vcd_writer(traces.raw_data(), traces.size(), out, size);
+    out = new vcd_buffer(writer, size);
 }
 
 
@@ -1564,7 +1135,8 @@ void vcd_trace_file::trace(const bool& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_bool_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<bool>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const sc_bool_vector& object, const sc_string& name)
@@ -1575,7 +1147,8 @@ void vcd_trace_file::trace(const sc_bool_vector& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_bool_vector_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_bool_vector>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 
@@ -1587,7 +1160,8 @@ void vcd_trace_file::trace(const sc_logic& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_logic_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_logic>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const sc_logic_vector& object, const sc_string& name)
@@ -1598,7 +1172,8 @@ void vcd_trace_file::trace(const sc_logic_vector& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_logic_vector_trace(object,name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_logic_vector>(object,name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const unsigned& object, const sc_string& name, int _width)
@@ -1609,7 +1184,8 @@ void vcd_trace_file::trace(const unsigned& object, const sc_string& name, int _w
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_unsigned_int_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<unsigned>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const unsigned char& object, const sc_string& name, int _width)
@@ -1620,7 +1196,8 @@ void vcd_trace_file::trace(const unsigned char& object, const sc_string& name, i
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_unsigned_char_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<unsigned char>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const unsigned short& object, const sc_string& name, int _width)
@@ -1631,7 +1208,8 @@ void vcd_trace_file::trace(const unsigned short& object, const sc_string& name,
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_unsigned_short_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<unsigned short>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const unsigned long& object, const sc_string& name, int _width)
@@ -1642,7 +1220,8 @@ void vcd_trace_file::trace(const unsigned long& object, const sc_string& name, i
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_unsigned_long_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<unsigned long>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const int& object, const sc_string& name, int _width)
@@ -1653,7 +1232,8 @@ void vcd_trace_file::trace(const int& object, const sc_string& name, int _width)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_signed_int_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<int>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const char& object, const sc_string& name, int _width)
@@ -1664,7 +1244,8 @@ void vcd_trace_file::trace(const char& object, const sc_string& name, int _width
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_signed_char_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<char>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const short& object, const sc_string& name, int _width)
@@ -1675,7 +1256,8 @@ void vcd_trace_file::trace(const short& object, const sc_string& name, int _widt
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_signed_short_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<short>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const long& object, const sc_string& name, int _width)
@@ -1686,7 +1268,8 @@ void vcd_trace_file::trace(const long& object, const sc_string& name, int _width
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_signed_long_trace(object, name, temp_vcd_name, _width));
+    traces.push_back(new vcd_typed_trace<long>(object, name, temp_vcd_name, _width));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const float& object, const sc_string& name)
@@ -1697,7 +1280,8 @@ void vcd_trace_file::trace(const float& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_float_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<float>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const double& object, const sc_string& name)
@@ -1708,7 +1292,8 @@ void vcd_trace_file::trace(const double& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_double_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<double>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const sc_unsigned& object, const sc_string& name)
@@ -1719,7 +1304,8 @@ void vcd_trace_file::trace(const sc_unsigned& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_unsigned_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_unsigned>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const sc_signed& object, const sc_string& name)
@@ -1730,7 +1316,8 @@ void vcd_trace_file::trace(const sc_signed& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_signed_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_signed>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const sc_uint_base& object, const sc_string& name)
@@ -1741,7 +1328,8 @@ void vcd_trace_file::trace(const sc_uint_base& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_uint_base_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_uint_base>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const sc_int_base& object, const sc_string& name)
@@ -1752,7 +1340,8 @@ void vcd_trace_file::trace(const sc_int_base& object, const sc_string& name)
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_int_base_trace(object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_int_base>(object, name, temp_vcd_name));
+    sc_share_trace(this, object);
 }
 
 
@@ -1769,9 +1358,9 @@ vcd_trace_file::trace( const tp& object, const sc_string& name )              \
                                                                               \
     sc_string temp_vcd_name;                                                  \
     create_vcd_name( &temp_vcd_name );                                        \
-    traces.push_back( new vcd_ ## tp ## _trace( object,                       \
-						name,                         \
-						temp_vcd_name ) );            \
+    traces.push_back( new vcd_typed_trace<tp>( object,                        \
+					       name,                          \
+					       temp_vcd_name ) );             \
 }
 
 DEFN_TRACE_METHOD(sc_fxval)
@@ -1793,6 +1382,7 @@ void vcd_trace_file::trace(const unsigned& object, const sc_string& name, const
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
     traces.push_back(new vcd_enum_trace(object, name, temp_vcd_name, enum_literals));
+    sc_share_trace(this, object);
 }
 
 void vcd_trace_file::trace(const sc_signal_bool_vector& object, const sc_string& name)
@@ -1803,7 +1393,8 @@ void vcd_trace_file::trace(const sc_signal_bool_vector& object, const sc_string&
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_bool_vector_trace((const sc_bool_vector&) object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_bool_vector>((const sc_bool_vector&) object, name, temp_vcd_name));
+    sc_share_trace(this, (const sc_bool_vector&) object);
 }
 
 void vcd_trace_file::trace(const sc_signal_logic_vector& object, const sc_string& name)
@@ -1814,7 +1405,8 @@ void vcd_trace_file::trace(const sc_signal_logic_vector& object, const sc_string
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_logic_vector_trace((const sc_logic_vector&) object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name, temp_vcd_name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
 }
 
 void vcd_trace_file::trace(const sc_signal_resolved& object, const sc_string& name)
@@ -1825,7 +1417,8 @@ void vcd_trace_file::trace(const sc_signal_resolved& object, const sc_string& na
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_logic_trace((const sc_logic&) *(object.get_data_ptr()), name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_logic>((const sc_logic&) *(object.get_data_ptr()), name, temp_vcd_name));
+    sc_share_trace(this, (const sc_logic&) *(object.get_data_ptr()));
 }
 
 void vcd_trace_file::trace(const sc_signal_resolved_vector& object, const sc_string& name)
@@ -1836,15 +1429,16 @@ void vcd_trace_file::trace(const sc_signal_resolved_vector& object, const sc_str
 
     sc_string temp_vcd_name;
     create_vcd_name(&temp_vcd_name);
-    traces.push_back(new vcd_sc_logic_vector_trace((const sc_logic_vector&) object, name, temp_vcd_name));
+    traces.push_back(new vcd_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name, temp_vcd_name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
 }
 
 void vcd_trace_file::write_comment(const sc_string& comment)
 {
     //no newline in comments allowed, as some viewers may crash
-    fputs("$comment\n", fp);
-    fputs((const char *) comment, fp);
-    fputs("\n$end\n\n", fp);
+    out->put("$comment\n");
+    out->put((const char *) comment);
+    out->put("\n$end\n\n");
 }
 
 
@@ -1853,6 +1447,16 @@ void vcd_trace_file::delta_cycles(bool flag)
     trace_delta_cycles = flag;
 }
 
+int vcd_trace_file::num_traces() const
+{
+    return traces.size();
+}
+
+const char* vcd_trace_file::trace_name(int i) const
+{
+    return (const char *) traces[i]->name;
+}
+
 void vcd_trace_file::cycle(bool this_is_a_delta_cycle)
 {
     char message[4000];
@@ -1956,29 +1560,36 @@ void vcd_trace_file::cycle(bool this_is_a_delta_cycle)
     // Now do the actual printing 
     bool time_printed = false;
     vcd_trace* const* const l_traces = traces.raw_data();
-    for (int i = 0; i < traces.size(); i++) {
-        vcd_trace* t = l_traces[i];
+    const int* const l_candidates = candidates();
+    const int n_candidates = num_candidates();
+    for (int k = 0; k < n_candidates; k++) {
+        vcd_trace* t = l_traces[l_candidates[k]];
         if(t->changed()){
             if(time_printed == false){
-                char buf[200];
-                if(this_time_units_high){
-                    sprintf(buf, "#%u%09u", this_time_units_high, this_time_units_low);
-                }
-                else{ 
-                    sprintf(buf, "#%u", this_time_units_low);
-                }
-                fputs(buf, fp);
-                fputc('\n', fp);
+                put_vcd_time(*out, this_time_units_high, this_time_units_low);
                 time_printed = true;
             }
 
 	    // Write the variable
-            t->write(fp);
-            fputc('\n', fp);
+            t->write(*out);
+            out->put('\n');
+        }
+    }
+    // Traces just enabled again
+    const int* const l_forced = forced();
+    const int n_forced = num_forced();
+    for (int k = 0; k < n_forced; k++) {
+        if(time_printed == false){
+            put_vcd_time(*out, this_time_units_high, this_time_units_low);
+            time_printed = true;
         }
+        l_traces[l_forced[k]]->write(*out);
+        out->put('\n');
     }
+    clear_dirty();
+
     // Put another newline after all values are printed
-    if(time_printed) fputc('\n', fp);
+    if(time_printed) out->put('\n');
 
     if(time_printed){
         // We update previous_time_units only when we print time because
@@ -1990,31 +1601,54 @@ void vcd_trace_file::cycle(bool this_is_a_delta_cycle)
 }
 
 
+// VCD identifiers are the shortest strings of the printable characters
+// '!' .. '~': the first 94 traces get one character, the next 94*94
+// two, and so on, which keeps the value change lines short.
 void vcd_trace_file::create_vcd_name(sc_string* p_destination)
 {
-    const char first_type_used = 'a';
-    const int used_types_count = 'z' - 'a' + 1;
-    int result;
-
-    char char4 = (char)(vcd_name_index % used_types_count);
-
-    result = vcd_name_index / used_types_count;
-    char char3 = (char)(result % used_types_count);
-
-    result = result / used_types_count;
-    char char2 = (char)(result % used_types_count);
+    const int used_types_count = '~' - '!' + 1;
+    unsigned n = vcd_name_index;
 
-    char buf[20];
-    sprintf(buf, "%c%c%c",
-            char2 + first_type_used,
-            char3 + first_type_used,
-            char4 + first_type_used);
+    char buf[8];
+    char* p = buf;
+    do {
+        *p++ = (char) ('!' + n % used_types_count);
+        n /= used_types_count;
+    } while (n-- != 0);
+    *p = 0;
     *p_destination = buf; 
     vcd_name_index++;
 }
 
+void vcd_trace_file::sc_set_vcd_buffer_size(int bytes)
+{
+    if (writer != 0) {
+        vcd_put_error_message("VCD buffer size cannot be changed once the writer thread runs.",
+                              false);
+        return;
+    }
+    buffer_size = bytes;
+    out->resize(bytes);
+}
+
+void vcd_trace_file::sc_set_vcd_async(bool flag)
+{
+    if(initialized){
+        vcd_put_error_message("VCD writer thread cannot be switched once tracing has begun.",
+                              false);
+        return;
+    }
+    async = flag;
+}
+
 vcd_trace_file::~vcd_trace_file()
 {
+    // Hands the last records to the writer thread, if any, which
+    // then finishes the file. The thread formats them through the
+    // traces, so these go only after it has been joined.
+    delete out;
+    delete writer;
+
     int i;
     for (i = 0; i < traces.size(); i++) {
         vcd_trace* t = traces[i];
@@ -2070,22 +1704,22 @@ vcd_put_error_message(const char* msg, bool just_warning)
 
 
 static void
-remove_vcd_name_problems(sc_string& name)
+put_vcd_name(vcd_buffer& out, const sc_string_view& name)
 {
     char message[4000];
     static bool warned = false;
 
     bool braces_removed = false;
-    for (int i = 0; i< name.length(); i++) {
-      if (name[i] == '[') {
-	name.set(i, '(');
-	braces_removed = true;
-      }
-      else if (name[i] == ']') {
-	name.set(i, ')');
+    int start = 0;
+    for (int i = 0; i < name.length(); i++) {
+      if (name[i] == '[' || name[i] == ']') {
+	out.put(name.data() + start, i - start);
+	out.put((name[i] == '[') ? '(' : ')');
+	start = i + 1;
 	braces_removed = true;
       }
     }
+    out.put(name.data() + start, name.length() - start);
 
     if(braces_removed && !warned){
         sprintf(message,
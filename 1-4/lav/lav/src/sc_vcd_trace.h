@@ -55,12 +55,25 @@
 #include "sc_vector.h"
 
 class vcd_trace;  // defined in vcd_trace.cc
+class vcd_buffer; // defined in vcd_trace.cc
+class vcd_writer; // defined in vcd_trace.cc
 
 
 class vcd_trace_file : public sc_trace_file {
 public:
     void sc_set_vcd_time_unit(int exponent10_seconds); // -7 -> 100ns
 
+    // Size of the output buffer; the file is written in chunks of
+    // this size.  The default is default_buffer_size.
+    void sc_set_vcd_buffer_size(int bytes);
+    enum { default_buffer_size = 1 << 20 };
+
+    // If flag is true, a separate writer thread formats the values
+    // and writes the file; the simulation only records the value
+    // changes, in two buffers of the above size.  Must be called
+    // before tracing begins.
+    void sc_set_vcd_async(bool flag);
+
     // Create a Vcd trace file.
     // `Name' forms the base of the name to which `.vcd' is added.
     vcd_trace_file(const char *name);
@@ -163,6 +176,12 @@ protected:
     // Also trace transitions between delta cycles if flag is true.
      void delta_cycles(bool flag);
 
+    // Number of traces, for dirty-list change detection
+     int num_traces() const;
+
+    // Name of trace i, for enable() and disable()
+     const char* trace_name(int i) const;
+
     // Write trace info for cycle.
      void cycle(bool delta_cycle);
     
@@ -171,11 +190,19 @@ private:
     void initialize();
     // Create VCD names for each variable
     void create_vcd_name(sc_string* p_destination);
+    // Start the writer thread
+    void start_writer();
     
     // Array to store the variables traced
     sc_pvector<vcd_trace*> traces;
     // Pointer to the file that needs to be written
     FILE* fp;
+    // All output is formatted into this buffer, or recorded in it for
+    // the writer thread
+    vcd_buffer* out;
+    int buffer_size;
+    vcd_writer* writer;         // 0 unless async
+    bool async;                 // = 1 means use a writer thread
 
     double timescale_unit;      // in seconds
     bool timescale_set_by_user; // = 1 means set by user
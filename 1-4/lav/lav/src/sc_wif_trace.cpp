@@ -68,6 +68,7 @@
 #include "sc_wif_trace.h"
 #include "sc_ver.h"
 #include "sc_simcontext.h"
+#include "sc_trace_registry.h"
 #include "numeric_bit/numeric_bit.h"
 #include "sc_resolved.h"
 #include "sc_dump.h"
@@ -96,1160 +97,164 @@ public:
     // Got to declare this virtual as this will be overwritten by one base class
     virtual void print_variable_declaration_line(FILE* f);
 
-    virtual ~wif_trace();
-
-    const sc_string name;     // Name of the variable
-    const sc_string wif_name; // Name of the variable in WIF file
-    const char* wif_type;     // WIF data type
-    int bit_width; 
-};
-
-
-wif_trace::wif_trace(const sc_string& _name, const sc_string& _wif_name)
-        : name(_name), wif_name(_wif_name), bit_width(0)
-{
-    /* Intentionally blank */
-}
-        
-void wif_trace::print_variable_declaration_line(FILE* f)
-{
-    char buf[2000];
-
-    if(bit_width == 0){
-        sprintf(buf, "Traced object \"%s\" has 0 Bits, cannot be traced.", (const char *) name);
-        wif_put_error_message(buf, false);
-    }
-    else{
-        fprintf(f, "declare  %s   \"%s\"  %s  ",
-                (const char *) wif_name, (const char *) name, wif_type);
-	if (bit_width > 1)
-	  fprintf(f, "0 %d ", bit_width-1);
-	fprintf(f, "variable ;\n");
-	fprintf(f, "start_trace %s ;\n", (const char *) wif_name);
-    }
-}
-
-void wif_trace::set_width()
-{
-    /* Intentionally Blank, should be defined for each type separately */
-}
-
-wif_trace::~wif_trace()
-{
-    /* Intentionally Blank */
-}
-
-// Classes for tracing individual data types
-
-/**********************************************************************************************/
-
-class wif_bool_trace : public wif_trace {
-public:
-    wif_bool_trace(const bool& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-
-protected:    
-    const bool& object;
-    bool old_value;
-};
-
-wif_bool_trace::wif_bool_trace(const bool& _object, const sc_string& _name, const sc_string& _wif_name)
-    : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = 1;
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool wif_bool_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_bool_trace::write(FILE* f)
-{
-    if (object == true) fprintf(f, "assign %s \'1\' ;\n", (const char *) wif_name);
-    else fprintf(f, "assign %s \'0\' ;\n", (const char *) wif_name);
-    old_value = object;
-}
-
-/*******************************************************************************************/
-
-class wif_sc_logic_trace: public wif_trace {
-public:
-    wif_sc_logic_trace(const sc_logic& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-
-protected:    
-    const sc_logic& object;
-    sc_logic old_value;
-};
-
-
-wif_sc_logic_trace::wif_sc_logic_trace(const sc_logic& _object, const sc_string& _name, const sc_string& _wif_name) 
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = 1;
-    old_value = object;
-    wif_type = "MVL";
-}
-
-
-bool wif_sc_logic_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void wif_sc_logic_trace::write(FILE* f)
-{
-    char wif_char;
-    fprintf(f, "assign %s \'", (const char *) wif_name);
-    wif_char = map_sc_logic_state_to_wif_state(object.to_char());
-    fputc(wif_char, f); 
-    fprintf(f,"\' ;\n");
-    old_value = object;
-}
-
-/******************************************************************************************/
-
-class wif_bool_vector_trace: public wif_trace {
-public:
-    wif_bool_vector_trace(const sc_bool_vector& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_bool_vector& object;
-    sc_bool_vector old_value;
-};
-
-
-wif_bool_vector_trace::wif_bool_vector_trace(const sc_bool_vector& _object, const sc_string& _name, const sc_string& _wif_name) 
-  : wif_trace(_name, _wif_name), object(_object), old_value(_object.length())
-{
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool wif_bool_vector_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_bool_vector_trace::write(FILE* f)
-{
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for(bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *buf_ptr++ = "01"[(object)[bitindex]];
-    }
-    *buf_ptr = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-void wif_bool_vector_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-
-/********************************************************************************/
-
-class wif_sc_logic_vector_trace: public wif_trace {
-public:
-    wif_sc_logic_vector_trace(const sc_logic_vector& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_logic_vector& object;
-    sc_logic_vector old_value;
-};
-
-wif_sc_logic_vector_trace::wif_sc_logic_vector_trace(const sc_logic_vector& _object, const sc_string& _name, const sc_string& _wif_name) 
-  : wif_trace(_name, _wif_name), object(_object), old_value(_object.length())
-{
-    old_value = object;
-    wif_type = "MVL";
-}
-
-bool wif_sc_logic_vector_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void wif_sc_logic_vector_trace::write(FILE* f)
-{
-    char in_char;
-    char out_char;
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for(bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        in_char = (object)[bitindex].to_char();
-        out_char = map_sc_logic_state_to_wif_state(in_char);
-        *buf_ptr++ = out_char; 
-    }
-    *buf_ptr = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-
-void wif_sc_logic_vector_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-/******************************************************************************************/
-
-class wif_sc_unsigned_trace: public wif_trace {
-public:
-    wif_sc_unsigned_trace(const sc_unsigned& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_unsigned& object;
-    sc_unsigned old_value;
-};
-
-
-wif_sc_unsigned_trace::wif_sc_unsigned_trace(const sc_unsigned& _object, const sc_string& _name, const sc_string& _wif_name) 
-  : wif_trace(_name, _wif_name), object(_object), old_value(_object.length())
-{
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool wif_sc_unsigned_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_sc_unsigned_trace::write(FILE* f)
-{
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for(bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *buf_ptr++ = "01"[(object)[bitindex]];
-    }
-    *buf_ptr = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-void wif_sc_unsigned_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-
-/******************************************************************************************/
-
-class wif_sc_signed_trace: public wif_trace {
-public:
-    wif_sc_signed_trace(const sc_signed& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_signed& object;
-    sc_signed old_value;
-};
-
-
-wif_sc_signed_trace::wif_sc_signed_trace(const sc_signed& _object, const sc_string& _name, const sc_string& _wif_name) 
-  : wif_trace(_name, _wif_name), object(_object), old_value(_object.length())
-{
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool wif_sc_signed_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_sc_signed_trace::write(FILE* f)
-{
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for(bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *buf_ptr++ = "01"[(object)[bitindex]];
-    }
-    *buf_ptr = '\0';
-
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-void wif_sc_signed_trace::set_width()
-{
-    bit_width = object.length();
-}
-
-/******************************************************************************************/
-
-class wif_sc_uint_base_trace: public wif_trace {
-public:
-    wif_sc_uint_base_trace(const sc_uint_base& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_uint_base& object;
-    sc_uint_base old_value;
-};
-
-
-wif_sc_uint_base_trace::wif_sc_uint_base_trace(const sc_uint_base& _object, const sc_string& _name, const sc_string& _wif_name) 
-  : wif_trace(_name, _wif_name), object(_object), old_value(_object.width)
-{
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool wif_sc_uint_base_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_sc_uint_base_trace::write(FILE* f)
-{
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for(bitindex = object.width - 1; bitindex >= 0; --bitindex) {
-        *buf_ptr++ = "01"[(object)[bitindex]];
-    }
-    *buf_ptr = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-void wif_sc_uint_base_trace::set_width()
-{
-    bit_width = object.width;
-}
-
-
-/******************************************************************************************/
-
-class wif_sc_int_base_trace: public wif_trace {
-public:
-    wif_sc_int_base_trace(const sc_int_base& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-    void set_width();
-
-protected:    
-    const sc_int_base& object;
-    sc_int_base old_value;
-};
-
-
-wif_sc_int_base_trace::wif_sc_int_base_trace(const sc_int_base& _object, const sc_string& _name, const sc_string& _wif_name) 
-  : wif_trace(_name, _wif_name), object(_object), old_value(_object.width)
-{
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool wif_sc_int_base_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_sc_int_base_trace::write(FILE* f)
-{
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for(bitindex = object.width - 1; bitindex >= 0; --bitindex) {
-        *buf_ptr++ = "01"[(object)[bitindex]];
-    }
-    *buf_ptr = '\0';
-
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-void wif_sc_int_base_trace::set_width()
-{
-    bit_width = object.width;
-}
-
-
-#ifdef SC_INCLUDE_FX
-
-/*****************************************************************************/
-
-class wif_sc_fxval_trace: public wif_trace
-{
-public:
-
-    wif_sc_fxval_trace( const sc_fxval& object,
-			const sc_string& _name,
-			const sc_string& _wif_name );
-    void write( FILE* f );
-    bool changed();
-
-protected:
-
-    const sc_fxval& object;
-    sc_fxval old_value;
-
-};
-
-wif_sc_fxval_trace::wif_sc_fxval_trace( const sc_fxval& _object,
-				        const sc_string& _name,
-					const sc_string& _wif_name )
-: wif_trace( _name, _wif_name ),
-  object( _object )
-{
-    bit_width = 1;
-    old_value = object;
-    wif_type = "real";
-}
-
-bool
-wif_sc_fxval_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-wif_sc_fxval_trace::write( FILE* f )
-{
-    fprintf( f, "assign  %s %f ; \n", (const char *) wif_name,
-	     object.to_double() );
-    old_value = object;
-}
-
-/*****************************************************************************/
-
-class wif_sc_fxval_fast_trace: public wif_trace
-{
-public:
-
-    wif_sc_fxval_fast_trace( const sc_fxval_fast& object,
-			     const sc_string& _name,
-			     const sc_string& _wif_name );
-    void write( FILE* f );
-    bool changed();
-
-protected:
-
-    const sc_fxval_fast& object;
-    sc_fxval_fast old_value;
-
-};
-
-wif_sc_fxval_fast_trace::wif_sc_fxval_fast_trace( const sc_fxval_fast& _object,
-						  const sc_string& _name,
-						  const sc_string& _wif_name )
-: wif_trace( _name, _wif_name ),
-  object( _object )
-{
-    bit_width = 1;
-    old_value = object;
-    wif_type = "real";
-}
-
-bool
-wif_sc_fxval_fast_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-wif_sc_fxval_fast_trace::write( FILE* f )
-{
-    fprintf( f, "assign  %s %f ; \n", (const char *) wif_name,
-	     object.to_double() );
-    old_value = object;
-}
-
-/*****************************************************************************/
-
-class wif_sc_fxnum_trace: public wif_trace
-{
-public:
-
-    wif_sc_fxnum_trace( const sc_fxnum& object,
-			const sc_string& _name,
-			const sc_string& _wif_name );
-    void write( FILE* f );
-    bool changed();
-    void set_width();
-
-protected:
-
-    const sc_fxnum& object;
-    sc_fxnum old_value;
-
-};
-
-wif_sc_fxnum_trace::wif_sc_fxnum_trace( const sc_fxnum& _object,
-				        const sc_string& _name,
-					const sc_string& _wif_name )
-: wif_trace( _name, _wif_name ),
-  object( _object ),
-  old_value( _object._params.type_params(),
-	     _object._params.enc(),
-	     _object._params.cast_switch(),
-	     0 )
-{
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool
-wif_sc_fxnum_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-wif_sc_fxnum_trace::write( FILE* f )
-{
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for( bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
-    {
-        *buf_ptr ++ = "01"[(object)[bitindex]];
-    }
-    *buf_ptr = '\0';
-
-    fprintf( f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf );
-    old_value = object;
-}
-
-void
-wif_sc_fxnum_trace::set_width()
-{
-    bit_width = object.wl();
-}
-
-/*****************************************************************************/
-
-class wif_sc_fxnum_fast_trace: public wif_trace
-{
-public:
-
-    wif_sc_fxnum_fast_trace( const sc_fxnum_fast& object,
-			     const sc_string& _name,
-			     const sc_string& _wif_name );
-    void write( FILE* f );
-    bool changed();
-    void set_width();
-
-protected:
-
-    const sc_fxnum_fast& object;
-    sc_fxnum_fast old_value;
-
-};
-
-wif_sc_fxnum_fast_trace::wif_sc_fxnum_fast_trace( const sc_fxnum_fast& _object,
-						  const sc_string& _name,
-						  const sc_string& _wif_name )
-: wif_trace( _name, _wif_name ),
-  object( _object ),
-  old_value( _object._params.type_params(),
-	     _object._params.enc(),
-	     _object._params.cast_switch(),
-	     0 )
-{
-    old_value = object;
-    wif_type = "BIT";
-}
-
-bool
-wif_sc_fxnum_fast_trace::changed()
-{
-    return object != old_value;
-}
-
-void
-wif_sc_fxnum_fast_trace::write( FILE* f )
-{
-    char buf[1000], *buf_ptr = buf;
-
-    int bitindex;
-    for( bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
-    {
-        *buf_ptr ++ = "01"[(object)[bitindex]];
-    }
-    *buf_ptr = '\0';
-
-    fprintf( f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf );
-    old_value = object;
-}
-
-void
-wif_sc_fxnum_fast_trace::set_width()
-{
-    bit_width = object.wl();
-}
-
-#endif
-
-
-/**************************************************************************************/
-
-class wif_unsigned_int_trace: public wif_trace {
-public:
-    wif_unsigned_int_trace(const unsigned& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const unsigned& object;
-    unsigned old_value;
-    unsigned mask; 
-};
-
-
-wif_unsigned_int_trace::wif_unsigned_int_trace(const unsigned& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    old_value = object;
-    wif_type = "BIT";
-}
-
-
-bool wif_unsigned_int_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void wif_unsigned_int_trace::write(FILE* f)
-{
-    char buf[1000];
-    int bitindex;
+    // Room for the bit_width characters of a vector value and a null
+    char* bits_buffer();
 
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex] = '0';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-
-/**************************************************************************************/
+    virtual ~wif_trace();
 
-class wif_unsigned_short_trace: public wif_trace {
-public:
-    wif_unsigned_short_trace(const unsigned short& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
+    const sc_string name;     // Name of the variable
+    const sc_string wif_name; // Name of the variable in WIF file
+    const char* wif_type;     // WIF data type
+    int bit_width; 
 
-protected:
-    const unsigned short& object;
-    unsigned short old_value;
-    unsigned short mask; 
+private:
+    char* bits;               // Allocated by bits_buffer()
 };
 
 
-wif_unsigned_short_trace::wif_unsigned_short_trace(const unsigned short& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
+wif_trace::wif_trace(const sc_string& _name, const sc_string& _wif_name)
+        : name(_name), wif_name(_wif_name), bit_width(0), bits(0)
 {
-    bit_width = _width;
-    if (bit_width < 16) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffff;
-    }
-
-    old_value = object;
-    wif_type = "BIT";
+    /* Intentionally blank */
 }
 
-
-bool wif_unsigned_short_trace::changed()
+char* wif_trace::bits_buffer()
 {
-    return object != old_value;
+    if (bits == 0)
+        bits = new char[bit_width + 1];
+    return bits;
 }
-
-
-void wif_unsigned_short_trace::write(FILE* f)
+        
+void wif_trace::print_variable_declaration_line(FILE* f)
 {
-    char buf[1000];
-    int bitindex;
+    char buf[2000];
 
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex]='0';
-        }
+    if(bit_width == 0){
+        sprintf(buf, "Traced object \"%s\" has 0 Bits, cannot be traced.", (const char *) name);
+        wif_put_error_message(buf, false);
     }
     else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-/**************************************************************************************/
-
-class wif_unsigned_char_trace: public wif_trace {
-public:
-    wif_unsigned_char_trace(const unsigned char& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const unsigned char& object;
-    unsigned char old_value;
-    unsigned char mask; 
-};
-
-
-wif_unsigned_char_trace::wif_unsigned_char_trace(const unsigned char& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 8) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xff;
+        fprintf(f, "declare  %s   \"%s\"  %s  ",
+                (const char *) wif_name, (const char *) name, wif_type);
+	if (bit_width > 1)
+	  fprintf(f, "0 %d ", bit_width-1);
+	fprintf(f, "variable ;\n");
+	fprintf(f, "start_trace %s ;\n", (const char *) wif_name);
     }
-
-    old_value = object;
-    wif_type = "BIT";
 }
 
-
-bool wif_unsigned_char_trace::changed()
+void wif_trace::set_width()
 {
-    return object != old_value;
+    /* Intentionally Blank, should be defined for each type separately */
 }
 
-
-void wif_unsigned_char_trace::write(FILE* f)
+wif_trace::~wif_trace()
 {
-    char buf[1000];
-    int bitindex;
-
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex]='0';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
+    delete[] bits;
 }
 
-/**************************************************************************************/
-
-class wif_unsigned_long_trace: public wif_trace {
-public:
-    wif_unsigned_long_trace(const unsigned long& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const unsigned long& object;
-    unsigned long old_value;
-    unsigned long mask; 
-};
-
+// Classes for tracing individual data types
 
-wif_unsigned_long_trace::wif_unsigned_long_trace(const unsigned long& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
+/**********************************************************************************************/
 
-    old_value = object;
-    wif_type = "BIT";
-}
+// Encoders of the kinds of values (see sc_trace_value.h)
 
+static inline const char* wif_data_type(sc_trace_logic) { return "MVL"; }
+static inline const char* wif_data_type(sc_trace_logics) { return "MVL"; }
+static inline const char* wif_data_type(sc_trace_real) { return "real"; }
+template< class K >
+inline const char* wif_data_type(K) { return "BIT"; }
 
-bool wif_unsigned_long_trace::changed()
+template< class T >
+inline void
+wif_put_value(wif_trace& t, FILE* f, const T& object, sc_trace_bit)
 {
-    return object != old_value;
+    fprintf(f, "assign %s \'%c\' ;\n", (const char *) t.wif_name, object ? '1' : '0');
 }
 
-
-void wif_unsigned_long_trace::write(FILE* f)
+template< class T >
+inline void
+wif_put_value(wif_trace& t, FILE* f, const T& object, sc_trace_logic)
 {
-    char buf[1000];
-    int bitindex;
-
-    // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex]='0';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
+    fprintf(f, "assign %s \'%c\' ;\n", (const char *) t.wif_name,
+            map_sc_logic_state_to_wif_state(object.to_char()));
 }
 
-/**************************************************************************************/
-
-class wif_signed_int_trace: public wif_trace {
-public:
-    wif_signed_int_trace(const int& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const int& object;
-    int old_value;
-    unsigned mask; 
-};
-
-
-wif_signed_int_trace::wif_signed_int_trace(const signed& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
+template< class T >
+inline void
+wif_put_value(wif_trace& t, FILE* f, const T& object, sc_trace_bits)
 {
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    old_value = object;
-    wif_type = "BIT";
+    char* buf = t.bits_buffer();
+    sc_trace_get_bits(object, t.bit_width, buf);
+    buf[t.bit_width] = '\0';
+    fprintf(f, "assign %s \"%s\" ;\n", (const char *) t.wif_name, buf); 
 }
 
-
-bool wif_signed_int_trace::changed()
+template< class T >
+inline void
+wif_put_value(wif_trace& t, FILE* f, const T& object, sc_trace_logics)
 {
-    return object != old_value;
+    char* buf = t.bits_buffer();
+    sc_trace_get_bits(object, t.bit_width, buf);
+    for (int i = 0; i < t.bit_width; ++i)
+        buf[i] = map_sc_logic_state_to_wif_state(buf[i]);
+    buf[t.bit_width] = '\0';
+    fprintf(f, "assign %s \"%s\" ;\n", (const char *) t.wif_name, buf); 
 }
 
-
-void wif_signed_int_trace::write(FILE* f)
+template< class T >
+inline void
+wif_put_value(wif_trace& t, FILE* f, const T& object, sc_trace_integer)
 {
-    char buf[1000];
-    int bitindex;
+    char* buf = t.bits_buffer();
+    unsigned long v;
 
     // Check for overflow
-    if (((unsigned) object & mask) != (unsigned) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex]='0';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-/**************************************************************************************/
-
-class wif_signed_short_trace: public wif_trace {
-public:
-    wif_signed_short_trace(const short& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const short& object;
-    short old_value;
-    unsigned short mask; 
-};
-
-
-wif_signed_short_trace::wif_signed_short_trace(const short& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 16) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffff;
+    if (! sc_trace_get_integer(object, t.bit_width, v))
+        v = 0;
+    for (int i = 0; i < t.bit_width; i++) {
+        int bitindex = t.bit_width - 1 - i;
+        buf[i] = (bitindex < (int) (8 * sizeof(long)) && ((v >> bitindex) & 1)) ? '1' : '0';
     }
-
-    old_value = object;
-    wif_type = "BIT";
-}
-
-
-bool wif_signed_short_trace::changed()
-{
-    return object != old_value;
+    buf[t.bit_width] = '\0';
+    fprintf(f, "assign %s \"%s\" ;\n", (const char *) t.wif_name, buf); 
 }
 
-
-void wif_signed_short_trace::write(FILE* f)
+template< class T >
+inline void
+wif_put_value(wif_trace& t, FILE* f, const T& object, sc_trace_real)
 {
-    char buf[1000];
-    int bitindex;
-
-    // Check for overflow
-    if (((unsigned short) object & mask) != (unsigned short) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex]='0';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
+    fprintf(f,"assign  %s %f ; \n", (const char *) t.wif_name, sc_trace_to_double(object));
 }
 
-/**************************************************************************************/
-
-class wif_signed_char_trace: public wif_trace {
+// The trace of an object of any traced type but enumerations
+template< class T >
+class wif_typed_trace : public wif_trace {
 public:
-    wif_signed_char_trace(const char& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
-
-protected:
-    const char& object;
-    char old_value;
-    unsigned char mask; 
-};
+    typedef typename sc_trace_traits<T>::kind kind;
 
-
-wif_signed_char_trace::wif_signed_char_trace(const char& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 8) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xff;
+    wif_typed_trace(const T& _object, const sc_string& _name, const sc_string& _wif_name, int _width = 1)
+      : wif_trace(_name, _wif_name), value(_object)
+    {
+        bit_width = sc_trace_width(_object, _width);
+        wif_type = wif_data_type(kind());
     }
 
-    old_value = object;
-    wif_type = "BIT";
-}
-
-
-bool wif_signed_char_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void wif_signed_char_trace::write(FILE* f)
-{
-    char buf[1000];
-    int bitindex;
-
-    // Check for overflow
-    if (((unsigned char) object & mask) != (unsigned char) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex]='0';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
+    void write(FILE* f)
+    {
+        wif_put_value(*this, f, value.object, kind());
+        value.update_old();
     }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
 
-/**************************************************************************************/
+    bool changed() { return value.changed(); }
 
-class wif_signed_long_trace: public wif_trace {
-public:
-    wif_signed_long_trace(const long& object, const sc_string& _name, const sc_string& _wif_name, int _width);
-    void write(FILE* f);
-    bool changed();
+    // Vectors may have been resized since they were traced
+    void set_width() { bit_width = sc_trace_width(value.object, bit_width); }
 
 protected:
-    const long& object;
-    long old_value;
-    unsigned long mask; 
-};
-
-
-wif_signed_long_trace::wif_signed_long_trace(const long& _object, const sc_string& _name, const sc_string& _wif_name, int _width) 
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = _width;
-    if (bit_width < 32) {
-        mask = ~(-1 << bit_width);
-    } else {
-        mask = 0xffffffff;
-    }
-
-    old_value = object;
-    wif_type = "BIT";
-}
-
-
-bool wif_signed_long_trace::changed()
-{
-    return object != old_value;
-}
-
-
-void wif_signed_long_trace::write(FILE* f)
-{
-    char buf[1000];
-    int bitindex;
-
-    // Check for overflow
-    if (((unsigned long) object & mask) != (unsigned long) object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            buf[bitindex]='0';
-        }
-    }
-    else{
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            buf[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    buf[bitindex] = '\0';
-    fprintf(f, "assign %s \"%s\" ;\n", (const char *) wif_name, buf); 
-    old_value = object;
-}
-
-
-/**********************************************************************************************/
-
-class wif_float_trace: public wif_trace {
-public:
-    wif_float_trace(const float& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-
-protected:    
-    const float& object;
-    float old_value;
-};
-
-wif_float_trace::wif_float_trace(const float& _object, const sc_string& _name, const sc_string& _wif_name)
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = 1;
-    old_value = object;
-    wif_type = "real";
-}
-
-bool wif_float_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_float_trace::write(FILE* f)
-{
-    fprintf(f,"assign  %s %f ; \n", (const char *) wif_name, object);
-    old_value = object;
-}
-
-/**********************************************************************************************/
-
-class wif_double_trace: public wif_trace {
-public:
-    wif_double_trace(const double& object, const sc_string& _name, const sc_string& _wif_name);
-    void write(FILE* f);
-    bool changed();
-
-protected:    
-    const double& object;
-    double old_value;
+    sc_trace_value<T> value;
 };
 
-wif_double_trace::wif_double_trace(const double& _object, const sc_string& _name, const sc_string& _wif_name)
-  : wif_trace(_name, _wif_name), object(_object)
-{
-    bit_width = 1;
-    old_value = object;
-    wif_type = "real";
-}
-
-bool wif_double_trace::changed()
-{
-    return object != old_value;
-}
-
-void wif_double_trace::write(FILE* f)
-{
-    fprintf(f,"assign  %s %f ; \n", (const char *) wif_name, object);
-    old_value = object;
-}
-
-
 /********************************************************************************************/
 
 class wif_enum_trace : public wif_trace {
@@ -1427,6 +432,8 @@ void wif_trace_file::initialize()
 
     double_to_special_int64(inittime/timescale_unit, &previous_time_units_high, &previous_time_units_low );
 
+    init_change_detection(traces.size());
+
     for (i = 0; i < traces.size(); i++) {
         wif_trace* t = traces[i];
         t->write(fp);
@@ -1482,7 +489,8 @@ void wif_trace_file::trace(const bool& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_bool_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<bool>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const sc_bool_vector& object, const sc_string& name)
@@ -1493,7 +501,8 @@ void wif_trace_file::trace(const sc_bool_vector& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_bool_vector_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_bool_vector>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 
@@ -1505,7 +514,8 @@ void wif_trace_file::trace(const sc_logic& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_logic_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_logic>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const sc_logic_vector& object, const sc_string& name)
@@ -1516,7 +526,8 @@ void wif_trace_file::trace(const sc_logic_vector& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_logic_vector_trace(object,name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_logic_vector>(object,name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const unsigned& object, const sc_string& name, int _width)
@@ -1527,7 +538,8 @@ void wif_trace_file::trace(const unsigned& object, const sc_string& name, int _w
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_unsigned_int_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<unsigned>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const unsigned char& object, const sc_string& name, int _width)
@@ -1538,7 +550,8 @@ void wif_trace_file::trace(const unsigned char& object, const sc_string& name, i
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_unsigned_char_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<unsigned char>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const unsigned short& object, const sc_string& name, int _width)
@@ -1549,7 +562,8 @@ void wif_trace_file::trace(const unsigned short& object, const sc_string& name,
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_unsigned_short_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<unsigned short>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const unsigned long& object, const sc_string& name, int _width)
@@ -1560,7 +574,8 @@ void wif_trace_file::trace(const unsigned long& object, const sc_string& name, i
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_unsigned_long_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<unsigned long>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const int& object, const sc_string& name, int _width)
@@ -1571,7 +586,8 @@ void wif_trace_file::trace(const int& object, const sc_string& name, int _width)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_signed_int_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<int>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const char& object, const sc_string& name, int _width)
@@ -1582,7 +598,8 @@ void wif_trace_file::trace(const char& object, const sc_string& name, int _width
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_signed_char_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<char>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const short& object, const sc_string& name, int _width)
@@ -1593,7 +610,8 @@ void wif_trace_file::trace(const short& object, const sc_string& name, int _widt
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_signed_short_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<short>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const long& object, const sc_string& name, int _width)
@@ -1604,7 +622,8 @@ void wif_trace_file::trace(const long& object, const sc_string& name, int _width
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_signed_long_trace(object, name, temp_wif_name, _width));
+    traces.push_back(new wif_typed_trace<long>(object, name, temp_wif_name, _width));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const float& object, const sc_string& name)
@@ -1615,7 +634,8 @@ void wif_trace_file::trace(const float& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_float_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<float>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const double& object, const sc_string& name)
@@ -1626,7 +646,8 @@ void wif_trace_file::trace(const double& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_double_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<double>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const sc_unsigned& object, const sc_string& name)
@@ -1637,7 +658,8 @@ void wif_trace_file::trace(const sc_unsigned& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_unsigned_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_unsigned>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const sc_signed& object, const sc_string& name)
@@ -1648,7 +670,8 @@ void wif_trace_file::trace(const sc_signed& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_signed_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_signed>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const sc_int_base& object, const sc_string& name)
@@ -1659,7 +682,8 @@ void wif_trace_file::trace(const sc_int_base& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_int_base_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_int_base>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const sc_uint_base& object, const sc_string& name)
@@ -1670,7 +694,8 @@ void wif_trace_file::trace(const sc_uint_base& object, const sc_string& name)
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_uint_base_trace(object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_uint_base>(object, name, temp_wif_name));
+    sc_share_trace(this, object);
 }
 
 
@@ -1687,9 +712,9 @@ wif_trace_file::trace( const tp& object, const sc_string& name )              \
                                                                               \
     sc_string temp_wif_name;                                                  \
     create_wif_name( &temp_wif_name );                                        \
-    traces.push_back( new wif_ ## tp ## _trace( object,                       \
-						name,                         \
-						temp_wif_name ) );            \
+    traces.push_back( new wif_typed_trace<tp>( object,                        \
+					       name,                          \
+					       temp_wif_name ) );             \
 }
 
 DEFN_TRACE_METHOD(sc_fxval)
@@ -1711,6 +736,7 @@ void wif_trace_file::trace(const unsigned& object, const sc_string& name, const
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
     traces.push_back(new wif_enum_trace(object, name, temp_wif_name, enum_literals));
+    sc_share_trace(this, object);
 }
 
 void wif_trace_file::trace(const sc_signal_bool_vector& object, const sc_string& name)
@@ -1721,7 +747,8 @@ void wif_trace_file::trace(const sc_signal_bool_vector& object, const sc_string&
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_bool_vector_trace((const sc_bool_vector&) object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_bool_vector>((const sc_bool_vector&) object, name, temp_wif_name));
+    sc_share_trace(this, (const sc_bool_vector&) object);
 }
 
 void wif_trace_file::trace(const sc_signal_logic_vector& object, const sc_string& name)
@@ -1732,7 +759,8 @@ void wif_trace_file::trace(const sc_signal_logic_vector& object, const sc_string
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_logic_vector_trace((const sc_logic_vector&) object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name, temp_wif_name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
 }
 
 void wif_trace_file::trace(const sc_signal_resolved& object, const sc_string& name)
@@ -1743,7 +771,8 @@ void wif_trace_file::trace(const sc_signal_resolved& object, const sc_string& na
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_logic_trace((const sc_logic&) *(object.get_data_ptr()), name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_logic>((const sc_logic&) *(object.get_data_ptr()), name, temp_wif_name));
+    sc_share_trace(this, (const sc_logic&) *(object.get_data_ptr()));
 }
 
 void wif_trace_file::trace(const sc_signal_resolved_vector& object, const sc_string& name)
@@ -1754,7 +783,8 @@ void wif_trace_file::trace(const sc_signal_resolved_vector& object, const sc_str
 
     sc_string temp_wif_name;
     create_wif_name(&temp_wif_name);
-    traces.push_back(new wif_sc_logic_vector_trace((const sc_logic_vector&) object, name, temp_wif_name));
+    traces.push_back(new wif_typed_trace<sc_logic_vector>((const sc_logic_vector&) object, name, temp_wif_name));
+    sc_share_trace(this, (const sc_logic_vector&) object);
 }
 
 void wif_trace_file::write_comment(const sc_string& comment)
@@ -1769,6 +799,16 @@ void wif_trace_file::delta_cycles(bool flag)
     trace_delta_cycles = flag;
 }
 
+int wif_trace_file::num_traces() const
+{
+    return traces.size();
+}
+
+const char* wif_trace_file::trace_name(int i) const
+{
+    return (const char *) traces[i]->name;
+}
+
 void wif_trace_file::cycle(bool this_is_a_delta_cycle)
 {
     unsigned now_units_high, now_units_low;
@@ -1796,8 +836,10 @@ void wif_trace_file::cycle(bool this_is_a_delta_cycle)
     
     bool time_printed = false;
     wif_trace* const* const l_traces = traces.raw_data();
-    for (int i = 0; i < traces.size(); i++) {
-        wif_trace* t = l_traces[i];
+    const int* const l_candidates = candidates();
+    const int n_candidates = num_candidates();
+    for (int k = 0; k < n_candidates; k++) {
+        wif_trace* t = l_traces[l_candidates[k]];
         if(t->changed()){
             if(time_printed == false){
                 if(delta_units_high){
@@ -1813,6 +855,22 @@ void wif_trace_file::cycle(bool this_is_a_delta_cycle)
             t->write(fp);
         }
     }
+    // Traces just enabled again
+    const int* const l_forced = forced();
+    const int n_forced = num_forced();
+    for (int k = 0; k < n_forced; k++) {
+        if(time_printed == false){
+            if(delta_units_high){
+                fprintf(fp, "delta_time %u%09u ;\n", delta_units_high, delta_units_low);
+            }
+            else{ 
+                fprintf(fp, "delta_time %u ;\n", delta_units_low);
+            }
+            time_printed = true;
+        }
+        l_traces[l_forced[k]]->write(fp);
+    }
+    clear_dirty();
 
     if(time_printed) {
         fprintf(fp, "\n");     // Put another newline
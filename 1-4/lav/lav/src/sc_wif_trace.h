@@ -169,6 +169,12 @@ protected:
     // Also trace transitions between delta cycles if flag is true.
      void delta_cycles(bool flag);
 
+    // Number of traces, for dirty-list change detection
+     int num_traces() const;
+
+    // Name of trace i, for enable() and disable()
+     const char* trace_name(int i) const;
+
     // Write trace info for cycle.
      void cycle(bool delta_cycle);
     
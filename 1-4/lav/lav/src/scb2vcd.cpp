@@ -0,0 +1,67 @@
+/******************************************************************************
+    Copyright (c) 1996-2000 Synopsys, Inc.    ALL RIGHTS RESERVED
+
+  The contents of this file are subject to the restrictions and limitations
+  set forth in the SystemC(TM) Open Community License Software Download and
+  Use License Version 1.1 (the "License"); you may not use this file except
+  in compliance with such restrictions and limitations. You may obtain
+  instructions on how to receive a copy of the License at
+  http://www.systemc.org/. Software distributed by Original Contributor
+  under the License is distributed on an "AS IS" basis, WITHOUT WARRANTY OF
+  ANY KIND, either express or implied. See the License for the specific
+  language governing rights and limitations under the License.
+
+******************************************************************************/
+
+/******************************************************************************
+
+    scb2vcd.cpp -- Converts SCB binary waveform files to VCD.
+
+    This is a program of its own, built from scb2vcd.cpp, sc_scb.cpp
+    and sc_lz.cpp only; it is not part of the SystemC library.
+
+        scb2vcd file.scb [file.vcd]
+
+******************************************************************************/
+
+/******************************************************************************
+
+    MODIFICATION LOG - modifiers, enter your name, affliation and
+    changes you are making here:
+
+    Modifier Name & Affiliation:
+    Description of Modification:
+
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sc_scb.h"
+
+int
+main( int argc, char* argv[] )
+{
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: scb2vcd file.scb [file.vcd]\n");
+        return 2;
+    }
+
+    char vcd_name[1024];
+    if (argc == 3) {
+        strncpy(vcd_name, argv[2], sizeof(vcd_name) - 1);
+        vcd_name[sizeof(vcd_name) - 1] = 0;
+    }
+    else {
+        // file.scb -> file.vcd
+        strncpy(vcd_name, argv[1], sizeof(vcd_name) - 5);
+        vcd_name[sizeof(vcd_name) - 5] = 0;
+        char* dot = strrchr(vcd_name, '.');
+        if (dot != 0 && strcmp(dot, ".scb") == 0)
+            *dot = 0;
+        strcat(vcd_name, ".vcd");
+    }
+    return (scb_to_vcd(argv[1], vcd_name) == 0) ? 0 : 1;
+}
@@ -92,6 +92,8 @@ using std::hex;
 #include "sc_vcd_trace.h"
 #include "sc_wif_trace.h"
 #include "sc_isdb_trace.h"
+#include "sc_scb_trace.h"
+#include "sc_mem_trace.h"
 #include "numeric_bit/numeric_bit.h"
 #include "sc_externs.h"
 #include "sc_port.h"
@@ -100,6 +102,7 @@ using std::hex;
 #include "sc_bv.h"
 #include "sc_lv.h"
 #include "sc_signal_rv.h"
+#include "sc_signal_group.h"
 #ifdef __BCPLUSPLUS__
 #pragma hdrstop
 #endif